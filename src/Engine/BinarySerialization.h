@@ -0,0 +1,364 @@
+#pragma once
+
+#include "Reflection.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Chronicles of a Drifter - Binary Serialization
+// Compact little-endian format for reflected types, checked against a schema hash on load
+//
+// Layout:
+//   Header   "CHRB" | u16 version | u16 reserved (0) | u32 schema hash | u32 record count
+//   Records  the type's fields in declaration order, each record back to back:
+//            Bool 1 byte, Int/Float 4, Double 8, Vector2/Vector3/Color 2/3/4 floats,
+//            String u32 byte length + bytes. Custom fields are not stored.
+// A single object is an array of one record.
+
+namespace Chronicles {
+namespace Serialization {
+
+const uint32_t BinaryMagic = 0x42524843;  // "CHRB" read as little-endian
+const uint16_t BinaryVersion = 1;
+const size_t BinaryHeaderSize = 16;
+
+/// <summary>
+/// Hash of everything that decides the binary layout of a type: its name and each field's
+/// name, type and size, in declaration order. Offsets are not included, so reordering
+/// members in the C++ struct keeps old files loadable; renaming, retyping, adding,
+/// removing or reordering fields changes the hash.
+/// </summary>
+inline uint32_t GetSchemaHash(const Reflection::TypeInfo& typeInfo) {
+    uint32_t hash = 2166136261u;
+    auto mix = [&hash](uint32_t value) {
+        for (int i = 0; i < 4; i++) {
+            hash ^= (value >> (i * 8)) & 0xFF;
+            hash *= 16777619u;
+        }
+    };
+    
+    mix(typeInfo.GetId());
+    for (const Reflection::FieldInfo& field : typeInfo.GetFields()) {
+        mix(field.GetId());
+        mix(static_cast<uint32_t>(field.GetType()));
+        mix(static_cast<uint32_t>(field.GetSize()));
+    }
+    return hash;
+}
+
+/// <summary>
+/// Where and why reading a binary blob stopped
+/// </summary>
+struct BinaryError {
+    const char* message = nullptr;  // Null on success; static string
+    size_t offset = 0;              // Byte offset into the input
+};
+
+/// <summary>
+/// A type's fields flattened into copy steps. Fixed-size fields that sit next to each
+/// other in memory (in declaration order) merge into one memcpy, so a plain-data struct
+/// usually becomes a single step, and an array of tightly packed ones a single memcpy.
+/// </summary>
+class BinaryLayout {
+public:
+    enum class StepKind : uint8_t {
+        Raw,     // Fixed-size bytes, copied as-is on little-endian hosts
+        Bool,    // One byte, normalized to 0/1 on read
+        String   // std::string, stored as u32 length + bytes
+    };
+    
+    struct Step {
+        StepKind kind;
+        uint32_t elementSize;  // Scalar width inside a Raw step (for byte swapping)
+        size_t offset;         // In the instance
+        size_t size;           // In the instance and in the file (Raw/Bool)
+    };
+    
+    void Build(const Reflection::TypeInfo& typeInfo) {
+        using namespace Reflection;
+        
+        m_steps.clear();
+        m_fixedSize = 0;
+        m_schemaHash = Serialization::GetSchemaHash(typeInfo);
+        for (const FieldInfo& field : typeInfo.GetFields()) {
+            const PropertyType type = field.GetType();
+            if (type == PropertyType::Custom) {
+                continue;
+            }
+            if (type == PropertyType::String) {
+                m_steps.push_back({ StepKind::String, 0, field.GetOffset(), 0 });
+                continue;
+            }
+            if (type == PropertyType::Bool) {
+                m_steps.push_back({ StepKind::Bool, 1, field.GetOffset(), 1 });
+                m_fixedSize += 1;
+                continue;
+            }
+            
+            const size_t size = GetPropertySize(type);
+            const uint32_t elementSize = type == PropertyType::Double ? 8 : 4;
+            m_fixedSize += size;
+            if (!m_steps.empty()) {
+                Step& last = m_steps.back();
+                const bool sameWidth = std::endian::native == std::endian::little || last.elementSize == elementSize;
+                if (last.kind == StepKind::Raw && last.offset + last.size == field.GetOffset() && sameWidth) {
+                    last.size += size;
+                    continue;
+                }
+            }
+            m_steps.push_back({ StepKind::Raw, elementSize, field.GetOffset(), size });
+        }
+    }
+    
+    const std::vector<Step>& GetSteps() const { return m_steps; }
+    uint32_t GetSchemaHash() const { return m_schemaHash; }
+    
+    /// <summary>
+    /// Bytes per record, not counting string contents
+    /// </summary>
+    size_t GetFixedSize() const { return m_fixedSize; }
+    
+    /// <summary>
+    /// True if records are exactly stride bytes copied from offset 0, so a whole array is
+    /// one memcpy in either direction
+    /// </summary>
+    bool IsMemcpyable(size_t stride) const {
+        return std::endian::native == std::endian::little && m_steps.size() == 1 &&
+               m_steps[0].kind == StepKind::Raw && m_steps[0].offset == 0 && m_steps[0].size == stride;
+    }
+
+private:
+    std::vector<Step> m_steps;
+    size_t m_fixedSize = 0;
+    uint32_t m_schemaHash = 0;
+};
+
+namespace Detail {
+    inline void CopyLittleEndian(void* destination, const void* source, size_t size, uint32_t elementSize) {
+        if constexpr (std::endian::native == std::endian::little) {
+            (void)elementSize;
+            memcpy(destination, source, size);
+        } else {
+            const uint8_t* from = static_cast<const uint8_t*>(source);
+            uint8_t* to = static_cast<uint8_t*>(destination);
+            for (size_t element = 0; element < size; element += elementSize) {
+                for (uint32_t i = 0; i < elementSize; i++) {
+                    to[element + i] = from[element + elementSize - 1 - i];
+                }
+            }
+        }
+    }
+}
+
+/// <summary>
+/// Writes records into a fixed buffer or a growable arena. Like JsonWriter, a fixed buffer
+/// that runs out keeps counting, so GetLength() is then the size required.
+/// </summary>
+class BinaryWriter {
+public:
+    BinaryWriter(void* buffer, size_t capacity)
+        : m_data(static_cast<uint8_t*>(buffer)), m_capacity(buffer ? capacity : 0), m_arena(nullptr) {}
+    
+    explicit BinaryWriter(std::vector<uint8_t>& arena)
+        : m_data(arena.data()), m_capacity(arena.size()), m_arena(&arena) {}
+    
+    /// <summary>
+    /// Write the header and count records at base, stride bytes apart
+    /// </summary>
+    void WriteArray(const BinaryLayout& layout, const void* base, size_t stride, uint32_t count) {
+        WriteU32(BinaryMagic);
+        WriteU32(BinaryVersion);  // Version in the low half, reserved high half stays 0
+        WriteU32(layout.GetSchemaHash());
+        WriteU32(count);
+        
+        const uint8_t* records = static_cast<const uint8_t*>(base);
+        if (layout.IsMemcpyable(stride)) {
+            Append(records, stride * count);
+            return;
+        }
+        
+        for (uint32_t i = 0; i < count; i++) {
+            WriteRecord(layout, records + i * stride);
+        }
+    }
+    
+    size_t GetLength() const { return m_length; }
+    bool Overflowed() const { return m_length > m_capacity; }
+    const uint8_t* GetData() const { return m_data; }
+
+private:
+    void WriteRecord(const BinaryLayout& layout, const uint8_t* record) {
+        for (const BinaryLayout::Step& step : layout.GetSteps()) {
+            const uint8_t* field = record + step.offset;
+            switch (step.kind) {
+                case BinaryLayout::StepKind::Raw:
+                    if (Reserve(step.size)) {
+                        Detail::CopyLittleEndian(m_data + m_length, field, step.size, step.elementSize);
+                    }
+                    m_length += step.size;
+                    break;
+                case BinaryLayout::StepKind::Bool: {
+                    const uint8_t value = *reinterpret_cast<const bool*>(field) ? 1 : 0;
+                    Append(&value, 1);
+                    break;
+                }
+                case BinaryLayout::StepKind::String: {
+                    const std::string& text = *reinterpret_cast<const std::string*>(field);
+                    WriteU32(static_cast<uint32_t>(text.size()));
+                    Append(text.data(), text.size());
+                    break;
+                }
+            }
+        }
+    }
+    
+    void WriteU32(uint32_t value) {
+        if (Reserve(4)) {
+            Detail::CopyLittleEndian(m_data + m_length, &value, 4, 4);
+        }
+        m_length += 4;
+    }
+    
+    void Append(const void* bytes, size_t size) {
+        if (size > 0 && Reserve(size)) {
+            memcpy(m_data + m_length, bytes, size);
+        }
+        m_length += size;
+    }
+    
+    bool Reserve(size_t size) {
+        if (m_length + size <= m_capacity) {
+            return true;
+        }
+        if (!m_arena) {
+            return false;
+        }
+        m_arena->resize(std::max(m_arena->size() * 2, m_length + size + 256));
+        m_data = m_arena->data();
+        m_capacity = m_arena->size();
+        return true;
+    }
+    
+    uint8_t* m_data;
+    size_t m_capacity;
+    std::vector<uint8_t>* m_arena;
+    size_t m_length = 0;
+};
+
+/// <summary>
+/// Reads blobs written by BinaryWriter, rejecting any whose schema hash differs from the
+/// type's. Every read is bounds-checked; on error the instances may be partially updated.
+/// </summary>
+class BinaryReader {
+public:
+    BinaryReader(const void* data, size_t length)
+        : m_begin(static_cast<const uint8_t*>(data)), m_cursor(m_begin), m_end(m_begin + length) {}
+    
+    /// <summary>
+    /// Validate the header and return the record count it announces
+    /// </summary>
+    bool ReadHeader(const BinaryLayout& layout, uint32_t& outCount) {
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        uint32_t schemaHash = 0;
+        if (!ReadU32(magic) || !ReadU32(version) || !ReadU32(schemaHash) || !ReadU32(outCount)) {
+            return false;
+        }
+        if (magic != BinaryMagic) return Fail("Not a binary save", 0);
+        if (version != BinaryVersion) return Fail("Unsupported binary version", 4);
+        if (schemaHash != layout.GetSchemaHash()) return Fail("Schema hash does not match the type", 8);
+        return true;
+    }
+    
+    /// <summary>
+    /// Read count records into base, stride bytes apart
+    /// </summary>
+    bool ReadRecords(const BinaryLayout& layout, void* base, size_t stride, uint32_t count) {
+        // Catches most truncated blobs before any instance is touched
+        const size_t fixedSize = layout.GetFixedSize();
+        if (fixedSize > 0 && static_cast<size_t>(m_end - m_cursor) / fixedSize < count) {
+            return Fail("Unexpected end of data");
+        }
+        
+        uint8_t* records = static_cast<uint8_t*>(base);
+        if (layout.IsMemcpyable(stride)) {
+            const size_t size = stride * count;
+            memcpy(records, m_cursor, size);
+            m_cursor += size;
+        } else {
+            for (uint32_t i = 0; i < count; i++) {
+                if (!ReadRecord(layout, records + i * stride)) {
+                    return false;
+                }
+            }
+        }
+        return m_cursor == m_end || Fail("Unexpected data after the last record");
+    }
+    
+    const BinaryError& GetError() const { return m_error; }
+
+private:
+    bool ReadRecord(const BinaryLayout& layout, uint8_t* record) {
+        for (const BinaryLayout::Step& step : layout.GetSteps()) {
+            uint8_t* field = record + step.offset;
+            switch (step.kind) {
+                case BinaryLayout::StepKind::Raw:
+                    if (static_cast<size_t>(m_end - m_cursor) < step.size) {
+                        return Fail("Unexpected end of data");
+                    }
+                    Detail::CopyLittleEndian(field, m_cursor, step.size, step.elementSize);
+                    m_cursor += step.size;
+                    break;
+                case BinaryLayout::StepKind::Bool:
+                    if (m_cursor == m_end) {
+                        return Fail("Unexpected end of data");
+                    }
+                    // Any byte other than 0/1 would be an invalid bool
+                    *reinterpret_cast<bool*>(field) = *m_cursor++ != 0;
+                    break;
+                case BinaryLayout::StepKind::String: {
+                    uint32_t length = 0;
+                    if (!ReadU32(length)) {
+                        return false;
+                    }
+                    if (static_cast<size_t>(m_end - m_cursor) < length) {
+                        return Fail("String runs past the end of data");
+                    }
+                    reinterpret_cast<std::string*>(field)->assign(reinterpret_cast<const char*>(m_cursor), length);
+                    m_cursor += length;
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+    
+    bool ReadU32(uint32_t& value) {
+        if (static_cast<size_t>(m_end - m_cursor) < 4) {
+            return Fail("Unexpected end of data");
+        }
+        Detail::CopyLittleEndian(&value, m_cursor, 4, 4);
+        m_cursor += 4;
+        return true;
+    }
+    
+    bool Fail(const char* message) {
+        return Fail(message, static_cast<size_t>(m_cursor - m_begin));
+    }
+    
+    bool Fail(const char* message, size_t offset) {
+        m_error.message = message;
+        m_error.offset = offset;
+        return false;
+    }
+    
+    const uint8_t* m_begin;
+    const uint8_t* m_cursor;
+    const uint8_t* m_end;
+    BinaryError m_error;
+};
+
+} // namespace Serialization
+} // namespace Chronicles
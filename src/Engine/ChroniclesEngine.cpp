@@ -1,5 +1,10 @@
 #include "ChroniclesEngine.h"
 #include "IRenderer.h"
+#include "NullRenderer.h"
+#include "PhysicsWorld.h"
+#include "Profiler.h"
+#include "SpscRing.h"
+#include "TextureLoader.h"
 #ifdef HAS_SDL2
 #include "SDL2Renderer.h"
 #endif
@@ -12,9 +17,11 @@
 #ifdef HAS_SDL2
 #include <SDL2/SDL.h>
 #endif
-#include <map>
+#include <atomic>
 #include <chrono>
 #include <memory>
+#include <string>
+#include <vector>
 
 // Chronicles of a Drifter - Native Engine Implementation with Multiple Renderer Backends
 
@@ -30,18 +37,112 @@ namespace {
     int g_windowWidth = 0;
     int g_windowHeight = 0;
     
+    // Background texture decoding (created on first Renderer_LoadTextureAsync)
+    std::unique_ptr<Chronicles::TextureLoader> g_textureLoader;
+    size_t g_textureUploadBudget = 8 * 1024 * 1024;
+    
     // Timing
     std::chrono::high_resolution_clock::time_point g_lastFrameTime;
     
-    // Input state
-    std::map<int, bool> g_keyStates;
-    std::map<int, bool> g_keyPressed;
-    std::map<int, bool> g_keyReleased;
-    float g_mouseX = 0.0f;
-    float g_mouseY = 0.0f;
-    std::map<int, bool> g_mouseButtonStates;
-    std::map<int, bool> g_mouseButtonPressed;
-    std::map<int, bool> g_mouseButtonReleased;
+    // Input state (bitsets indexed by key slot, see INPUT_KEY_SLOTS)
+    InputSnapshot g_input = {};
+    
+    const int SdlScancodeMask = 1 << 30;
+    const int MaxMouseButtons = 32;
+    
+    // Timestamped event stream: produced by the event pump thread, drained by Input_ReadEvents.
+    // Off until a reader asks for it, so an unread ring does not fill up and count drops
+    Chronicles::SpscRing<InputEvent> g_inputEvents(INPUT_EVENT_CAPACITY);
+    std::atomic<bool> g_recordInputEvents{false};
+    std::atomic<uint32_t> g_droppedInputEvents{0};
+    const std::chrono::steady_clock::time_point g_inputClockOrigin = std::chrono::steady_clock::now();
+    
+    uint64_t InputTimestampUs() {
+        auto elapsed = std::chrono::steady_clock::now() - g_inputClockOrigin;
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    }
+    
+    void PushInputEvent(uint32_t type, int32_t code, float x, float y, uint64_t timestampUs) {
+        if (!g_recordInputEvents.load(std::memory_order_relaxed)) {
+            return;
+        }
+        InputEvent event = { type, code, x, y, timestampUs };
+        if (!g_inputEvents.TryPush(event)) {
+            g_droppedInputEvents.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    
+    int KeySlot(int keyCode) {
+        if (keyCode >= 0 && keyCode < INPUT_KEY_SLOTS / 2) {
+            return keyCode;
+        }
+        if ((keyCode & SdlScancodeMask) != 0) {
+            int scancode = keyCode & ~SdlScancodeMask;
+            if (scancode >= 0 && scancode < INPUT_KEY_SLOTS / 2) {
+                return INPUT_KEY_SLOTS / 2 + scancode;
+            }
+        }
+        return -1;
+    }
+    
+    bool TestBit(const uint32_t* words, int slot) {
+        return slot >= 0 && (words[slot >> 5] & (1u << (slot & 31))) != 0;
+    }
+    
+    void SetBit(uint32_t* words, int slot, bool value) {
+        if (slot < 0) return;
+        if (value) {
+            words[slot >> 5] |= 1u << (slot & 31);
+        } else {
+            words[slot >> 5] &= ~(1u << (slot & 31));
+        }
+    }
+    
+    void SetKey(int keyCode, bool isDown, bool isPressed, uint64_t timestampUs) {
+        int slot = KeySlot(keyCode);
+        SetBit(g_input.keysDown, slot, isDown);
+        if (isDown) {
+            if (isPressed) {
+                SetBit(g_input.keysPressed, slot, true);
+                PushInputEvent(INPUT_EVENT_KEY_DOWN, keyCode, g_input.mouseX, g_input.mouseY, timestampUs);
+            }
+        } else {
+            SetBit(g_input.keysReleased, slot, true);
+            PushInputEvent(INPUT_EVENT_KEY_UP, keyCode, g_input.mouseX, g_input.mouseY, timestampUs);
+        }
+    }
+    
+    void SetMouseButton(int button, bool isDown, uint64_t timestampUs) {
+        if (button < 0 || button >= MaxMouseButtons) return;
+        uint32_t bit = 1u << button;
+        if (isDown) {
+            g_input.mouseButtonsDown |= bit;
+            g_input.mouseButtonsPressed |= bit;
+        } else {
+            g_input.mouseButtonsDown &= ~bit;
+            g_input.mouseButtonsReleased |= bit;
+        }
+        PushInputEvent(isDown ? INPUT_EVENT_MOUSE_BUTTON_DOWN : INPUT_EVENT_MOUSE_BUTTON_UP,
+                       button, g_input.mouseX, g_input.mouseY, timestampUs);
+    }
+    
+    void SetMousePosition(float x, float y, uint64_t timestampUs) {
+        g_input.mouseX = x;
+        g_input.mouseY = y;
+        PushInputEvent(INPUT_EVENT_MOUSE_MOTION, 0, x, y, timestampUs);
+    }
+
+#ifdef HAS_SDL2
+    // SDL stamps events in milliseconds since SDL_Init; shift that onto the input clock
+    // so events queued earlier in the frame keep their real relative order and spacing
+    uint64_t SdlEventTimestampUs(Uint32 eventTicks, uint64_t pumpTimeUs, Uint32 pumpTicks) {
+        uint64_t ageUs = static_cast<uint64_t>(static_cast<Uint32>(pumpTicks - eventTicks)) * 1000;
+        return ageUs < pumpTimeUs ? pumpTimeUs - ageUs : 0;
+    }
+#endif
+
+    // Physics bodies stepped by Physics_Step
+    Chronicles::PhysicsWorld g_physics;
     
     // Callbacks
     InputCallbackFn g_inputCallback = nullptr;
@@ -59,11 +160,27 @@ namespace {
         printf("[Engine] ERROR: %s\n", message);
     }
     
+    // Reads a fixed-size command from the stream; the buffer may be unaligned
+    template<typename T>
+    bool ReadCommand(const uint8_t* data, size_t size, size_t& offset, T& out) {
+        if (size - offset < sizeof(T)) {
+            return false;
+        }
+        memcpy(&out, data + offset, sizeof(T));
+        offset += sizeof(T);
+        return true;
+    }
+    
+    // Backend name set by Engine_SetRendererBackend; empty = use the environment
+    std::string g_rendererOverride;
+    
     // Environment variable to select renderer backend
     // Default on Windows: DirectX 11 (broad hardware compatibility)
     // Set CHRONICLES_RENDERER=dx11 for DirectX 11 (Windows only, default)
     // Set CHRONICLES_RENDERER=dx12 for DirectX 12 (Windows only, high-performance)
     // Set CHRONICLES_RENDERER=sdl2 for SDL2 (cross-platform, if available)
+    // Set CHRONICLES_RENDERER=null for the headless renderer (no window or GPU, CI benchmarking)
+    // Set CHRONICLES_RENDERER=software for the headless renderer with a CPU rasterizer
     // Note: Renderer can be changed later in the settings menu (game will restart)
     Chronicles::RendererBackend GetRendererBackend() {
 #ifdef _WIN32
@@ -74,6 +191,9 @@ namespace {
 #else
         const char* rendererEnv = std::getenv("CHRONICLES_RENDERER");
 #endif
+        if (!g_rendererOverride.empty()) {
+            rendererEnv = g_rendererOverride.c_str();
+        }
         
         Chronicles::RendererBackend result = Chronicles::RendererBackend::DirectX11;
         
@@ -107,6 +227,18 @@ namespace {
 #endif
 #endif
             }
+            else if (backend == "sdl2" || backend == "sdl") {
+                result = Chronicles::RendererBackend::SDL2;
+            }
+            else if (backend == "null" || backend == "headless") {
+                result = Chronicles::RendererBackend::Null;
+            }
+            else if (backend == "software" || backend == "cpu") {
+                result = Chronicles::RendererBackend::Software;
+            }
+            else {
+                printf("[Engine] WARNING: Unknown renderer '%s', using default\n", backend.c_str());
+            }
         }
         else {
             // Default to DirectX 11 on Windows (configurable via environment variable)
@@ -131,6 +263,10 @@ namespace {
 
 // ===== Engine Initialization =====
 
+extern "C" ENGINE_API void Engine_SetRendererBackend(const char* backend) {
+    g_rendererOverride = backend ? backend : "";
+}
+
 extern "C" ENGINE_API bool Engine_Initialize(int width, int height, const char* title) {
     if (g_isInitialized) {
         return true;
@@ -165,6 +301,16 @@ extern "C" ENGINE_API bool Engine_Initialize(int width, int height, const char*
 #endif
                 break;
             
+            case Chronicles::RendererBackend::Null:
+                printf("[Engine] Using null renderer backend (headless)\n");
+                g_renderer = std::make_unique<Chronicles::NullRenderer>();
+                break;
+            
+            case Chronicles::RendererBackend::Software:
+                printf("[Engine] Using software renderer backend (headless)\n");
+                g_renderer = std::make_unique<Chronicles::NullRenderer>(true);
+                break;
+            
             case Chronicles::RendererBackend::SDL2:
             default:
 #ifdef HAS_SDL2
@@ -217,6 +363,9 @@ extern "C" ENGINE_API void Engine_Shutdown() {
     
     printf("[Engine] Shutting down\n");
     
+    // Stop texture decoding before the renderer that owns the textures goes away
+    g_textureLoader.reset();
+    
     // Shutdown renderer
     if (g_renderer) {
         g_renderer->Shutdown();
@@ -241,6 +390,8 @@ extern "C" ENGINE_API bool Engine_IsRunning() {
 // ===== Game Loop =====
 
 extern "C" ENGINE_API void Engine_BeginFrame() {
+    CHRONICLES_PROFILE_SCOPE("Engine_BeginFrame");
+    
     // Calculate delta time
     auto currentTime = std::chrono::high_resolution_clock::now();
     std::chrono::duration<float> elapsed = currentTime - g_lastFrameTime;
@@ -248,49 +399,76 @@ extern "C" ENGINE_API void Engine_BeginFrame() {
     g_lastFrameTime = currentTime;
     g_totalTime += g_deltaTime;
     
-    // Clear previous frame input states
-    g_keyPressed.clear();
-    g_keyReleased.clear();
-    g_mouseButtonPressed.clear();
-    g_mouseButtonReleased.clear();
+    // Clear previous frame input edges
+    memset(g_input.keysPressed, 0, sizeof(g_input.keysPressed));
+    memset(g_input.keysReleased, 0, sizeof(g_input.keysReleased));
+    g_input.mouseButtonsPressed = 0;
+    g_input.mouseButtonsReleased = 0;
+    g_input.frameIndex++;
     
 #ifdef HAS_SDL2
     // Process SDL events (for input and window management)
-    SDL_Event event;
-    while (SDL_PollEvent(&event)) {
-        switch (event.type) {
-            case SDL_QUIT:
-                g_isRunning = false;
-                if (g_renderer) {
-                    g_renderer->SetRunning(false);
-                }
-                break;
+    {
+        CHRONICLES_PROFILE_SCOPE("PollEvents");
+        SDL_Event event;
+        uint64_t pumpTimeUs = InputTimestampUs();
+        Uint32 pumpTicks = SDL_GetTicks();
+        while (SDL_PollEvent(&event)) {
+            uint64_t timestampUs = SdlEventTimestampUs(event.common.timestamp, pumpTimeUs, pumpTicks);
+            switch (event.type) {
+                case SDL_QUIT:
+                    g_isRunning = false;
+                    if (g_renderer) {
+                        g_renderer->SetRunning(false);
+                    }
+                    break;
+                
+                case SDL_KEYDOWN:
+                    if (!event.key.repeat) {
+                        SetKey(event.key.keysym.sym, true, true, timestampUs);
+                        if (g_inputCallback) {
+                            g_inputCallback(event.key.keysym.sym, true);
+                        }
+                    }
+                    break;
                 
-            case SDL_KEYDOWN:
-                if (!event.key.repeat) {
-                    g_keyStates[event.key.keysym.sym] = true;
-                    g_keyPressed[event.key.keysym.sym] = true;
+                case SDL_KEYUP:
+                    SetKey(event.key.keysym.sym, false, false, timestampUs);
                     if (g_inputCallback) {
-                        g_inputCallback(event.key.keysym.sym, true);
+                        g_inputCallback(event.key.keysym.sym, false);
                     }
-                }
-                break;
+                    break;
+                
+                case SDL_MOUSEMOTION:
+                    SetMousePosition(static_cast<float>(event.motion.x), static_cast<float>(event.motion.y), timestampUs);
+                    break;
                 
-            case SDL_KEYUP:
-                g_keyStates[event.key.keysym.sym] = false;
-                g_keyReleased[event.key.keysym.sym] = true;
-                if (g_inputCallback) {
-                    g_inputCallback(event.key.keysym.sym, false);
+                case SDL_MOUSEBUTTONDOWN:
+                case SDL_MOUSEBUTTONUP: {
+                    // Same numbering as the Windows backends: 0 = left, 1 = right, 2 = middle
+                    int button = event.button.button - 1;
+                    if (event.button.button == SDL_BUTTON_RIGHT) button = 1;
+                    else if (event.button.button == SDL_BUTTON_MIDDLE) button = 2;
+                    SetMouseButton(button, event.type == SDL_MOUSEBUTTONDOWN, timestampUs);
+                    break;
                 }
-                break;
                 
-            case SDL_MOUSEMOTION:
-                g_mouseX = static_cast<float>(event.motion.x);
-                g_mouseY = static_cast<float>(event.motion.y);
-                break;
+                case SDL_MOUSEWHEEL: {
+                    float sign = event.wheel.direction == SDL_MOUSEWHEEL_FLIPPED ? -1.0f : 1.0f;
+                    PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, event.wheel.preciseX * sign,
+                                   event.wheel.preciseY * sign, timestampUs);
+                    break;
+                }
+            }
         }
     }
 #endif
+
+    // Upload textures whose background decode has finished, within the frame budget
+    if (g_textureLoader && g_renderer) {
+        CHRONICLES_PROFILE_SCOPE("UploadTextures");
+        g_textureLoader->UploadCompleted(*g_renderer, g_textureUploadBudget);
+    }
     
     // Begin renderer frame
     if (g_renderer) {
@@ -299,6 +477,8 @@ extern "C" ENGINE_API void Engine_BeginFrame() {
 }
 
 extern "C" ENGINE_API void Engine_EndFrame() {
+    CHRONICLES_PROFILE_SCOPE("Engine_EndFrame");
+    
     // End renderer frame
     if (g_renderer) {
         g_renderer->EndFrame();
@@ -317,14 +497,46 @@ extern "C" ENGINE_API float Engine_GetTotalTime() {
 
 extern "C" ENGINE_API int Renderer_LoadTexture(const char* filePath) {
     if (!g_renderer) return -1;
+    CHRONICLES_PROFILE_SCOPE("Renderer_LoadTexture");
     return g_renderer->LoadTexture(filePath);
 }
 
 extern "C" ENGINE_API void Renderer_UnloadTexture(int textureId) {
     if (!g_renderer) return;
+    if (g_textureLoader) {
+        g_textureLoader->Cancel(textureId);
+    }
     g_renderer->UnloadTexture(textureId);
 }
 
+extern "C" ENGINE_API int Renderer_LoadTextureAsync(const char* filePath) {
+    if (!g_renderer) return -1;
+    if (!filePath) {
+        SetError("No texture path given");
+        return -1;
+    }
+    
+    int textureId = g_renderer->ReserveTextureId();
+    if (textureId < 0) {
+        SetError("Renderer backend does not support asynchronous texture loading");
+        return -1;
+    }
+    
+    if (!g_textureLoader) {
+        g_textureLoader = std::make_unique<Chronicles::TextureLoader>(0);
+    }
+    g_textureLoader->Request(textureId, filePath);
+    return textureId;
+}
+
+extern "C" ENGINE_API int Renderer_GetTextureState(int textureId) {
+    return g_textureLoader ? g_textureLoader->GetState(textureId) : TEXTURE_STATE_INVALID;
+}
+
+extern "C" ENGINE_API void Renderer_SetTextureUploadBudget(int bytesPerFrame) {
+    g_textureUploadBudget = bytesPerFrame > 0 ? static_cast<size_t>(bytesPerFrame) : 0;
+}
+
 extern "C" ENGINE_API void Renderer_DrawSprite(int textureId, float x, float y,
                                                float width, float height, float rotation) {
     if (!g_renderer) return;
@@ -342,33 +554,210 @@ extern "C" ENGINE_API void Renderer_DrawRect(float x, float y, float width, floa
     g_renderer->DrawRect(x, y, width, height, r, g, b, a);
 }
 
+extern "C" ENGINE_API void Renderer_DrawRects(const RectInstance* rects, int count) {
+    if (!g_renderer || !rects || count <= 0) return;
+    CHRONICLES_PROFILE_SCOPE("Renderer_DrawRects");
+    g_renderer->DrawRects(rects, count);
+}
+
+// ===== Texture Atlases =====
+
+extern "C" ENGINE_API int Renderer_LoadAtlas(const AtlasSpriteSource* sprites, int count, int pageSize) {
+    if (!g_renderer) return -1;
+    if (!sprites || count <= 0) {
+        SetError("Atlas needs at least one sprite");
+        return -1;
+    }
+    
+    CHRONICLES_PROFILE_SCOPE("Renderer_LoadAtlas");
+    int atlasId = g_renderer->LoadAtlas(sprites, count, pageSize);
+    if (atlasId < 0) {
+        SetError("Atlas creation failed");
+    }
+    return atlasId;
+}
+
+extern "C" ENGINE_API void Renderer_UnloadAtlas(int atlasId) {
+    if (!g_renderer) return;
+    g_renderer->UnloadAtlas(atlasId);
+}
+
+extern "C" ENGINE_API void Renderer_DrawSpriteRegion(int atlasId, int regionId, float x, float y,
+                                                     float width, float height, float rotation) {
+    if (!g_renderer) return;
+    g_renderer->DrawSpriteRegion(atlasId, regionId, x, y, width, height, rotation);
+}
+
+extern "C" ENGINE_API int Renderer_SubmitCommands(const void* buffer, int byteLength) {
+    if (!g_renderer) return 0;
+    CHRONICLES_PROFILE_SCOPE("Renderer_SubmitCommands");
+    if (!buffer || byteLength < static_cast<int>(sizeof(RenderCommandHeader))) {
+        SetError("Render command stream is too short");
+        return -1;
+    }
+    
+    const uint8_t* data = static_cast<const uint8_t*>(buffer);
+    const size_t size = static_cast<size_t>(byteLength);
+    size_t offset = 0;
+    
+    RenderCommandHeader header;
+    ReadCommand(data, size, offset, header);
+    if (header.version != RENDER_COMMAND_STREAM_VERSION) {
+        SetError("Unsupported render command stream version");
+        return -1;
+    }
+    
+    int executed = 0;
+    for (uint32_t i = 0; i < header.commandCount; i++) {
+        uint32_t type = 0;
+        if (size - offset < sizeof(type)) {
+            SetError("Render command stream truncated");
+            return -1;
+        }
+        memcpy(&type, data + offset, sizeof(type));
+        
+        switch (type) {
+            case RenderCommand_Clear: {
+                RenderCommandClear cmd;
+                if (!ReadCommand(data, size, offset, cmd)) break;
+                g_renderer->Clear(cmd.r, cmd.g, cmd.b, cmd.a);
+                executed++;
+                continue;
+            }
+            case RenderCommand_Rect: {
+                RenderCommandRect cmd;
+                if (!ReadCommand(data, size, offset, cmd)) break;
+                g_renderer->DrawRect(cmd.x, cmd.y, cmd.width, cmd.height, cmd.r, cmd.g, cmd.b, cmd.a);
+                executed++;
+                continue;
+            }
+            case RenderCommand_Sprite: {
+                RenderCommandSprite cmd;
+                if (!ReadCommand(data, size, offset, cmd)) break;
+                g_renderer->DrawSprite(cmd.textureId, cmd.x, cmd.y, cmd.width, cmd.height, cmd.rotation);
+                executed++;
+                continue;
+            }
+            case RenderCommand_OutlineRect: {
+                RenderCommandOutlineRect cmd;
+                if (!ReadCommand(data, size, offset, cmd)) break;
+                const float t = cmd.thickness;
+                const RectInstance edges[4] = {
+                    { cmd.x - t, cmd.y - t, cmd.width + 2 * t, t, cmd.r, cmd.g, cmd.b, cmd.a },           // Top
+                    { cmd.x - t, cmd.y + cmd.height, cmd.width + 2 * t, t, cmd.r, cmd.g, cmd.b, cmd.a },  // Bottom
+                    { cmd.x - t, cmd.y, t, cmd.height, cmd.r, cmd.g, cmd.b, cmd.a },                      // Left
+                    { cmd.x + cmd.width, cmd.y, t, cmd.height, cmd.r, cmd.g, cmd.b, cmd.a }               // Right
+                };
+                g_renderer->DrawRects(edges, 4);
+                executed++;
+                continue;
+            }
+            case RenderCommand_SpriteRegion: {
+                RenderCommandSpriteRegion cmd;
+                if (!ReadCommand(data, size, offset, cmd)) break;
+                g_renderer->DrawSpriteRegion(cmd.atlasId, cmd.regionId, cmd.x, cmd.y, cmd.width, cmd.height, cmd.rotation);
+                executed++;
+                continue;
+            }
+            default:
+                SetError("Unknown render command type");
+                return -1;
+        }
+        
+        // A known command ran past the end of the buffer
+        SetError("Render command stream truncated");
+        return -1;
+    }
+    
+    return executed;
+}
+
 extern "C" ENGINE_API void Renderer_Present() {
     if (!g_renderer) return;
+    CHRONICLES_PROFILE_SCOPE("Renderer_Present");
     g_renderer->Present();
 }
 
+extern "C" ENGINE_API bool Renderer_GetStats(RendererStats* outStats) {
+    if (!g_renderer || !outStats) return false;
+    return g_renderer->GetStats(*outStats);
+}
+
+extern "C" ENGINE_API bool Renderer_ReadPixels(uint8_t* outRgba, int bufferSize) {
+    if (!g_renderer || !outRgba || bufferSize <= 0) return false;
+    return g_renderer->ReadPixels(outRgba, static_cast<size_t>(bufferSize));
+}
+
+extern "C" ENGINE_API bool Renderer_SaveFramebuffer(const char* filePath) {
+    if (!g_renderer || !filePath) {
+        SetError("Renderer not initialized or no file path");
+        return false;
+    }
+    
+    const int width = g_renderer->GetWidth();
+    const int height = g_renderer->GetHeight();
+    std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+    if (pixels.empty() || !g_renderer->ReadPixels(pixels.data(), pixels.size())) {
+        SetError("Renderer has no CPU framebuffer");
+        return false;
+    }
+    
+    std::string error;
+    if (!Chronicles::WritePngFile(filePath, width, height, pixels.data(), error)) {
+        SetError(error.c_str());
+        return false;
+    }
+    return true;
+}
+
 // ===== Input =====
 
+extern "C" ENGINE_API void Input_GetSnapshot(InputSnapshot* outSnapshot) {
+    if (outSnapshot) {
+        memcpy(outSnapshot, &g_input, sizeof(InputSnapshot));
+    }
+}
+
 extern "C" ENGINE_API bool Input_IsKeyPressed(int keyCode) {
-    return g_keyPressed.find(keyCode) != g_keyPressed.end();
+    return TestBit(g_input.keysPressed, KeySlot(keyCode));
 }
 
 extern "C" ENGINE_API bool Input_IsKeyDown(int keyCode) {
-    auto it = g_keyStates.find(keyCode);
-    return it != g_keyStates.end() && it->second;
+    return TestBit(g_input.keysDown, KeySlot(keyCode));
 }
 
 extern "C" ENGINE_API bool Input_IsKeyReleased(int keyCode) {
-    return g_keyReleased.find(keyCode) != g_keyReleased.end();
+    return TestBit(g_input.keysReleased, KeySlot(keyCode));
 }
 
 extern "C" ENGINE_API void Input_GetMousePosition(float* outX, float* outY) {
-    if (outX) *outX = g_mouseX;
-    if (outY) *outY = g_mouseY;
+    if (outX) *outX = g_input.mouseX;
+    if (outY) *outY = g_input.mouseY;
 }
 
 extern "C" ENGINE_API bool Input_IsMouseButtonPressed(int button) {
-    return g_mouseButtonPressed.find(button) != g_mouseButtonPressed.end();
+    return button >= 0 && button < MaxMouseButtons && (g_input.mouseButtonsPressed & (1u << button)) != 0;
+}
+
+// ===== Input Events =====
+
+extern "C" ENGINE_API void Input_SetEventRecording(bool enabled) {
+    g_recordInputEvents.store(enabled, std::memory_order_relaxed);
+}
+
+extern "C" ENGINE_API int Input_ReadEvents(InputEvent* outEvents, int maxEvents) {
+    if (!outEvents || maxEvents <= 0) {
+        return 0;
+    }
+    return static_cast<int>(g_inputEvents.PopMany(outEvents, static_cast<size_t>(maxEvents)));
+}
+
+extern "C" ENGINE_API uint64_t Input_GetTimestampUs() {
+    return InputTimestampUs();
+}
+
+extern "C" ENGINE_API uint32_t Input_GetDroppedEventCount() {
+    return g_droppedInputEvents.load(std::memory_order_relaxed);
 }
 
 // ===== Audio =====
@@ -396,8 +785,66 @@ extern "C" ENGINE_API void Audio_StopMusic() {
 // ===== Physics =====
 
 extern "C" ENGINE_API void Physics_SetGravity(float x, float y) {
-    (void)x; (void)y;
-    // TODO: Set physics gravity
+    g_physics.SetGravity(x, y);
+}
+
+extern "C" ENGINE_API bool Physics_CreateBody(int entityId, float x, float y, float width, float height,
+                                              int flags, int layer, int collidesWith) {
+    if (!g_physics.CreateBody(entityId, x, y, width, height, static_cast<uint32_t>(flags),
+                              static_cast<uint32_t>(layer), static_cast<uint32_t>(collidesWith))) {
+        SetError("Physics_CreateBody: width and height must not be negative");
+        return false;
+    }
+    return true;
+}
+
+extern "C" ENGINE_API void Physics_DestroyBody(int entityId) {
+    g_physics.DestroyBody(entityId);
+}
+
+extern "C" ENGINE_API void Physics_ClearBodies() {
+    g_physics.Clear();
+}
+
+extern "C" ENGINE_API int Physics_GetBodyCount() {
+    return static_cast<int>(g_physics.GetBodyCount());
+}
+
+extern "C" ENGINE_API void Physics_SetBodyState(int entityId, float x, float y, float vx, float vy) {
+    if (Chronicles::PhysicsWorld::Body* body = g_physics.FindBody(entityId)) {
+        body->x = x;
+        body->y = y;
+        body->vx = vx;
+        body->vy = vy;
+    }
+}
+
+extern "C" ENGINE_API bool Physics_GetBodyState(int entityId, float* x, float* y, float* vx, float* vy) {
+    const Chronicles::PhysicsWorld::Body* body = g_physics.FindBody(entityId);
+    if (!body) {
+        return false;
+    }
+    if (x) *x = body->x;
+    if (y) *y = body->y;
+    if (vx) *vx = body->vx;
+    if (vy) *vy = body->vy;
+    return true;
+}
+
+extern "C" ENGINE_API void Physics_SetCellSize(float cellSize) {
+    g_physics.SetCellSize(cellSize);
+}
+
+extern "C" ENGINE_API void Physics_Step(float deltaTime) {
+    CHRONICLES_PROFILE_SCOPE("Physics_Step");
+    g_physics.Step(deltaTime);
+    if (g_collisionCallback) {
+        // A copy, so the callback may create, destroy or clear bodies
+        const auto contacts = g_physics.GetContacts();
+        for (const auto& [first, second] : contacts) {
+            g_collisionCallback(first, second);
+        }
+    }
 }
 
 extern "C" ENGINE_API bool Physics_CheckCollision(float x1, float y1, float w1, float h1,
@@ -424,15 +871,7 @@ extern "C" ENGINE_API void Engine_RegisterCollisionCallback(CollisionCallbackFn
 // ===== Internal Input Functions (called by renderers) =====
 
 extern "C" ENGINE_API void Engine_SetKeyState(int keyCode, bool isDown, bool isPressed) {
-    if (isDown) {
-        g_keyStates[keyCode] = true;
-        if (isPressed) {
-            g_keyPressed[keyCode] = true;
-        }
-    } else {
-        g_keyStates[keyCode] = false;
-        g_keyReleased[keyCode] = true;
-    }
+    SetKey(keyCode, isDown, isPressed, InputTimestampUs());
     
     // Call registered callback
     if (g_inputCallback) {
@@ -441,18 +880,15 @@ extern "C" ENGINE_API void Engine_SetKeyState(int keyCode, bool isDown, bool isP
 }
 
 extern "C" ENGINE_API void Engine_SetMousePosition(float x, float y) {
-    g_mouseX = x;
-    g_mouseY = y;
+    SetMousePosition(x, y, InputTimestampUs());
 }
 
 extern "C" ENGINE_API void Engine_SetMouseButtonState(int button, bool isDown) {
-    if (isDown) {
-        g_mouseButtonStates[button] = true;
-        g_mouseButtonPressed[button] = true;
-    } else {
-        g_mouseButtonStates[button] = false;
-        g_mouseButtonReleased[button] = true;
-    }
+    SetMouseButton(button, isDown, InputTimestampUs());
+}
+
+extern "C" ENGINE_API void Engine_SetMouseWheel(float deltaX, float deltaY) {
+    PushInputEvent(INPUT_EVENT_MOUSE_WHEEL, 0, deltaX, deltaY, InputTimestampUs());
 }
 
 // ===== Error Handling =====
@@ -10,12 +10,20 @@
     #define ENGINE_API
 #endif
 
+#include <cstdint>
+
 // Chronicles of a Drifter - Native Engine Interface
 // This header defines the C API for interop with C# game logic
 
 extern "C" {
     // ===== Engine Initialization =====
     
+    /// <summary>
+    /// Choose the renderer backend for the next Engine_Initialize, taking precedence over
+    /// CHRONICLES_RENDERER. Accepts the same names; null or empty goes back to the environment.
+    /// </summary>
+    ENGINE_API void Engine_SetRendererBackend(const char* backend);
+    
     /// <summary>
     /// Initialize the game engine with specified window parameters
     /// </summary>
@@ -60,6 +68,15 @@ extern "C" {
     
     // ===== Rendering =====
     
+    /// <summary>
+    /// Per-instance data for batched rectangle submission.
+    /// Layout must match the managed RectInstance struct (8 packed floats).
+    /// </summary>
+    struct RectInstance {
+        float x, y, width, height;
+        float r, g, b, a;
+    };
+    
     /// <summary>
     /// Load a texture from file
     /// </summary>
@@ -72,6 +89,36 @@ extern "C" {
     /// </summary>
     ENGINE_API void Renderer_UnloadTexture(int textureId);
     
+    /// <summary>
+    /// State of a texture requested with Renderer_LoadTextureAsync
+    /// </summary>
+    enum TextureState {
+        TEXTURE_STATE_INVALID = 0,  // Unknown ID, or unloaded
+        TEXTURE_STATE_PENDING = 1,  // Decoding or waiting for upload; draws are skipped
+        TEXTURE_STATE_READY = 2,
+        TEXTURE_STATE_FAILED = 3
+    };
+    
+    /// <summary>
+    /// Start loading a PNG or BMP texture in the background. The file is decoded on a
+    /// worker thread and uploaded during a later Engine_BeginFrame, within the per-frame
+    /// upload budget.
+    /// </summary>
+    /// <param name="filePath">Path to image file</param>
+    /// <returns>Texture ID (usable immediately; draws are skipped until it is ready) or -1 on failure</returns>
+    ENGINE_API int Renderer_LoadTextureAsync(const char* filePath);
+    
+    /// <summary>
+    /// Get the TextureState of a texture requested with Renderer_LoadTextureAsync
+    /// </summary>
+    ENGINE_API int Renderer_GetTextureState(int textureId);
+    
+    /// <summary>
+    /// Set how many bytes of decoded pixels may be uploaded per frame (default 8 MB).
+    /// At least one texture is uploaded per frame regardless of size.
+    /// </summary>
+    ENGINE_API void Renderer_SetTextureUploadBudget(int bytesPerFrame);
+    
     /// <summary>
     /// Draw a sprite with specified transform
     /// </summary>
@@ -89,13 +136,199 @@ extern "C" {
     ENGINE_API void Renderer_DrawRect(float x, float y, float width, float height,
                                      float r, float g, float b, float a);
     
+    /// <summary>
+    /// Draw many filled rectangles in one call. Rectangles are drawn in array order
+    /// and are batched by the renderer backend where supported.
+    /// </summary>
+    /// <param name="rects">Array of rectangle instances</param>
+    /// <param name="count">Number of elements in rects</param>
+    ENGINE_API void Renderer_DrawRects(const RectInstance* rects, int count);
+    
+    // ===== Texture Atlases =====
+    
+    /// <summary>
+    /// One image to pack into an atlas: either a sub-rectangle of an image file,
+    /// or (texturePath == null) a solid-color block. Layout must match the managed
+    /// AtlasSpriteSource struct.
+    /// </summary>
+    struct AtlasSpriteSource {
+        const char* texturePath;    // Image file, or null for a solid-color region
+        int32_t srcX, srcY;         // Top-left of the region in the image, in pixels
+        int32_t width, height;      // Region size in pixels
+        float r, g, b, a;           // Fill color when texturePath is null
+    };
+    
+    /// <summary>
+    /// Pack the given images into as few atlas pages as possible. Each source image
+    /// file is loaded once. Regions that share a page are drawn in a single batch.
+    /// </summary>
+    /// <param name="sprites">Regions to pack; region IDs are their indices in this array</param>
+    /// <param name="count">Number of elements in sprites</param>
+    /// <param name="pageSize">Page width/height in pixels, or &lt;= 0 for the default (2048).
+    /// Clamped to the renderer's maximum texture size.</param>
+    /// <returns>Atlas ID (&gt; 0) or -1 on failure</returns>
+    ENGINE_API int Renderer_LoadAtlas(const AtlasSpriteSource* sprites, int count, int pageSize);
+    
+    /// <summary>
+    /// Release an atlas and its page textures
+    /// </summary>
+    ENGINE_API void Renderer_UnloadAtlas(int atlasId);
+    
+    /// <summary>
+    /// Draw one region of an atlas with the specified transform
+    /// </summary>
+    ENGINE_API void Renderer_DrawSpriteRegion(int atlasId, int regionId, float x, float y,
+                                             float width, float height, float rotation);
+    
+    // ===== Render Command Stream =====
+    // A command stream is a RenderCommandHeader followed by commandCount packed
+    // commands. Every command starts with a uint32 RenderCommandType tag and all
+    // fields are 4-byte little-endian values, so the stream can be built in a
+    // pinned managed byte buffer without padding.
+    
+    /// <summary>
+    /// Current command stream format version
+    /// </summary>
+    enum { RENDER_COMMAND_STREAM_VERSION = 1 };
+    
+    /// <summary>
+    /// Render command tags
+    /// </summary>
+    enum RenderCommandType : uint32_t {
+        RenderCommand_Clear = 1,
+        RenderCommand_Rect = 2,
+        RenderCommand_Sprite = 3,
+        RenderCommand_OutlineRect = 4,
+        RenderCommand_SpriteRegion = 5
+    };
+    
+    struct RenderCommandHeader {
+        uint32_t version;
+        uint32_t commandCount;
+    };
+    
+    struct RenderCommandClear {
+        uint32_t type;
+        float r, g, b, a;
+    };
+    
+    struct RenderCommandRect {
+        uint32_t type;
+        float x, y, width, height;
+        float r, g, b, a;
+    };
+    
+    struct RenderCommandSprite {
+        uint32_t type;
+        int32_t textureId;
+        float x, y, width, height;
+        float rotation;
+    };
+    
+    /// <summary>
+    /// Rectangle border drawn outside the given bounds with the given thickness
+    /// </summary>
+    struct RenderCommandOutlineRect {
+        uint32_t type;
+        float x, y, width, height;
+        float thickness;
+        float r, g, b, a;
+    };
+    
+    /// <summary>
+    /// Region of a texture atlas (see Renderer_DrawSpriteRegion)
+    /// </summary>
+    struct RenderCommandSpriteRegion {
+        uint32_t type;
+        int32_t atlasId;
+        int32_t regionId;
+        float x, y, width, height;
+        float rotation;
+    };
+    
+    /// <summary>
+    /// Execute a packed render command stream in one call
+    /// </summary>
+    /// <param name="buffer">Command stream starting with a RenderCommandHeader</param>
+    /// <param name="byteLength">Size of the stream in bytes</param>
+    /// <returns>Number of commands executed, or -1 if the stream is malformed
+    /// (commands before the malformed one are still executed)</returns>
+    ENGINE_API int Renderer_SubmitCommands(const void* buffer, int byteLength);
+    
     /// <summary>
     /// Present the rendered frame to the screen
     /// </summary>
     ENGINE_API void Renderer_Present();
     
+    /// <summary>
+    /// Work counters reported by Renderer_GetStats.
+    /// Per-frame fields describe the last presented frame.
+    /// Layout must match the managed RendererStats struct.
+    /// </summary>
+    struct RendererStats {
+        uint64_t framesPresented;
+        uint32_t drawCalls;        // Batches submitted (one per run of quads sharing a texture)
+        uint32_t quads;
+        uint32_t vertices;
+        uint32_t stateChanges;     // Texture switches between batches
+        uint32_t clears;
+        uint32_t textureUploads;
+        uint64_t totalDrawCalls;   // Totals since initialization
+        uint64_t totalQuads;
+        uint64_t totalVertices;
+        uint64_t totalStateChanges;
+    };
+    
+    /// <summary>
+    /// Get renderer work counters (supported by the null backend, CHRONICLES_RENDERER=null)
+    /// </summary>
+    /// <returns>false if the active backend does not collect statistics</returns>
+    ENGINE_API bool Renderer_GetStats(RendererStats* outStats);
+    
+    /// <summary>
+    /// Copy the CPU framebuffer, as of the last Renderer_Present, as RGBA8 rows
+    /// (width * height * 4 bytes). Only available on the software backend
+    /// (CHRONICLES_RENDERER=software) or the null backend with CHRONICLES_NULL_FRAMEBUFFER=1.
+    /// </summary>
+    /// <returns>false if there is no framebuffer or the buffer is too small</returns>
+    ENGINE_API bool Renderer_ReadPixels(uint8_t* outRgba, int bufferSize);
+    
+    /// <summary>
+    /// Write the CPU framebuffer (see Renderer_ReadPixels) to a PNG file
+    /// </summary>
+    /// <returns>true on success; on failure see Engine_GetErrorMessage</returns>
+    ENGINE_API bool Renderer_SaveFramebuffer(const char* filePath);
+    
     // ===== Input =====
     
+    // Keys are tracked in fixed bitsets indexed by key slot:
+    //   keyCode in [0, 512)                     -> slot keyCode (ASCII/SDL keycodes, Windows VK codes)
+    //   SDL scancode keycode (1 << 30 | sc < 512) -> slot 512 + sc (arrows, F-keys, ...)
+    // Other key codes are ignored. Bit for slot s: words[s >> 5] & (1u << (s & 31)).
+    
+    enum { INPUT_KEY_SLOTS = 1024, INPUT_KEY_WORDS = INPUT_KEY_SLOTS / 32 };
+    
+    /// <summary>
+    /// Whole-frame input state copied out by Input_GetSnapshot.
+    /// Layout must match the managed InputSnapshot struct.
+    /// </summary>
+    struct InputSnapshot {
+        uint32_t keysDown[INPUT_KEY_WORDS];
+        uint32_t keysPressed[INPUT_KEY_WORDS];   // Went down this frame
+        uint32_t keysReleased[INPUT_KEY_WORDS];  // Went up this frame
+        float mouseX;
+        float mouseY;
+        uint32_t mouseButtonsDown;               // Bit n = button n (0 = left, 1 = right, 2 = middle)
+        uint32_t mouseButtonsPressed;
+        uint32_t mouseButtonsReleased;
+        uint32_t frameIndex;                     // Incremented by every Engine_BeginFrame
+    };
+    
+    /// <summary>
+    /// Copy the current frame's complete input state in one call
+    /// </summary>
+    ENGINE_API void Input_GetSnapshot(InputSnapshot* outSnapshot);
+    
     /// <summary>
     /// Check if a key was pressed this frame
     /// </summary>
@@ -121,6 +354,61 @@ extern "C" {
     /// </summary>
     ENGINE_API bool Input_IsMouseButtonPressed(int button);
     
+    // ===== Input Events =====
+    
+    // Every key, mouse button, motion and wheel event seen by the event pump is also
+    // appended to a lock-free single-producer/single-consumer ring with a microsecond
+    // timestamp, so presses shorter than a frame are not lost and game logic may drain
+    // them from a different thread than the one calling Engine_BeginFrame.
+    // Nothing is recorded until a reader turns it on with Input_SetEventRecording.
+    
+    enum InputEventType {
+        INPUT_EVENT_KEY_DOWN = 1,           // code = key code
+        INPUT_EVENT_KEY_UP = 2,             // code = key code
+        INPUT_EVENT_MOUSE_BUTTON_DOWN = 3,  // code = button (0 = left, 1 = right, 2 = middle), x/y = position
+        INPUT_EVENT_MOUSE_BUTTON_UP = 4,    // code = button, x/y = position
+        INPUT_EVENT_MOUSE_MOTION = 5,       // x/y = new position
+        INPUT_EVENT_MOUSE_WHEEL = 6         // x/y = scroll amount in notches (positive = right/away from user)
+    };
+    
+    enum { INPUT_EVENT_CAPACITY = 1024 };
+    
+    /// <summary>
+    /// A single timestamped input event.
+    /// Layout must match the managed InputEvent struct.
+    /// </summary>
+    struct InputEvent {
+        uint32_t type;          // InputEventType
+        int32_t code;
+        float x;
+        float y;
+        uint64_t timestampUs;   // Same clock as Input_GetTimestampUs
+    };
+    
+    /// <summary>
+    /// Start or stop appending events to the ring. Off by default; a reader turns it on
+    /// before it starts draining and off when it stops. Events already queued stay
+    /// readable after recording stops.
+    /// </summary>
+    ENGINE_API void Input_SetEventRecording(bool enabled);
+    
+    /// <summary>
+    /// Remove up to maxEvents queued events, oldest first.
+    /// Must only be called from one thread at a time (the single consumer).
+    /// </summary>
+    /// <returns>Number of events written to outEvents</returns>
+    ENGINE_API int Input_ReadEvents(InputEvent* outEvents, int maxEvents);
+    
+    /// <summary>
+    /// Current time in microseconds on the clock used for event timestamps
+    /// </summary>
+    ENGINE_API uint64_t Input_GetTimestampUs();
+    
+    /// <summary>
+    /// Number of events discarded because the ring was full (nobody drained it in time)
+    /// </summary>
+    ENGINE_API uint32_t Input_GetDroppedEventCount();
+    
     // ===== Audio =====
     
     /// <summary>
@@ -146,10 +434,64 @@ extern "C" {
     // ===== Physics =====
     
     /// <summary>
-    /// Set global gravity vector
+    /// Body flags for Physics_CreateBody
+    /// </summary>
+    enum PhysicsBodyFlags {
+        PHYSICS_BODY_STATIC = 1,        // Never moves
+        PHYSICS_BODY_SENSOR = 2,        // Reports contacts but never blocks or is blocked
+        PHYSICS_BODY_NO_GRAVITY = 4,
+        PHYSICS_BODY_NO_SLIDE = 8       // When blocked, stays where it was instead of sliding
+    };
+    
+    /// <summary>
+    /// Set global gravity vector (applied by Physics_Step; default 0, 0)
     /// </summary>
     ENGINE_API void Physics_SetGravity(float x, float y);
     
+    /// <summary>
+    /// Add an axis-aligned box body for an entity, or reshape and move the one it has
+    /// (keeping its velocity). x, y is the center of the box. A moving body is blocked
+    /// by bodies on any of the collidesWith layers.
+    /// </summary>
+    /// <returns>False for a negative width or height</returns>
+    ENGINE_API bool Physics_CreateBody(int entityId, float x, float y, float width, float height,
+                                       int flags, int layer, int collidesWith);
+    
+    ENGINE_API void Physics_DestroyBody(int entityId);
+    
+    /// <summary>
+    /// Remove every body (e.g. when a scene is unloaded)
+    /// </summary>
+    ENGINE_API void Physics_ClearBodies();
+    
+    ENGINE_API int Physics_GetBodyCount();
+    
+    /// <summary>
+    /// Set a body's center and velocity; ignored if the entity has no body
+    /// </summary>
+    ENGINE_API void Physics_SetBodyState(int entityId, float x, float y, float vx, float vy);
+    
+    /// <summary>
+    /// Read a body's center and velocity
+    /// </summary>
+    /// <returns>False if the entity has no body</returns>
+    ENGINE_API bool Physics_GetBodyState(int entityId, float* x, float* y, float* vx, float* vy);
+    
+    /// <summary>
+    /// Broadphase grid cell size in world units (default 64); about the size of a
+    /// typical body works best
+    /// </summary>
+    ENGINE_API void Physics_SetCellSize(float cellSize);
+    
+    /// <summary>
+    /// Advance every body by deltaTime: apply gravity and velocity, then keep moving
+    /// bodies out of what blocks them (sliding along one axis when the other is free,
+    /// unless PHYSICS_BODY_NO_SLIDE).
+    /// Calls the collision callback once per pair of bodies that touched, smaller entity
+    /// id first. The callback may add, remove or clear bodies, but must not call Physics_Step.
+    /// </summary>
+    ENGINE_API void Physics_Step(float deltaTime);
+    
     /// <summary>
     /// Check collision between two axis-aligned bounding boxes
     /// </summary>
@@ -195,6 +537,11 @@ extern "C" {
     /// </summary>
     ENGINE_API void Engine_SetMouseButtonState(int button, bool isDown);
     
+    /// <summary>
+    /// Internal: Report mouse wheel movement in notches (called by renderer backends)
+    /// </summary>
+    ENGINE_API void Engine_SetMouseWheel(float deltaX, float deltaY);
+    
     // ===== Error Handling =====
     
     /// <summary>
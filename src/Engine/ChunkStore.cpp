@@ -0,0 +1,147 @@
+#include "ChunkStore.h"
+#include <cstring>
+#include <cstdio>
+
+using namespace Chronicles::World;
+
+// ===== ChunkStore Implementation =====
+
+bool ChunkStore::Initialize(int capacity) {
+    if (capacity <= 0) {
+        return false;
+    }
+    
+    // Resident chunks are owned by whoever allocated them and may hold pointers into the
+    // arrays, so only the owner (through Shutdown) can take the store back
+    for (uint8_t occupied : m_occupied) {
+        if (occupied) {
+            printf("[ChunkStore] ERROR: Already in use; release its chunks and shut it down first\n");
+            return false;
+        }
+    }
+    
+    // Round up to a power of two so the slot is a mask of chunk X
+    int slots = 1;
+    while (slots < capacity) {
+        slots <<= 1;
+    }
+    
+    m_capacity = slots;
+    m_tiles.assign(static_cast<size_t>(slots) * ChunkTileCount, 0);
+    m_vegetation.assign(static_cast<size_t>(slots) * ChunkWidth, 0);
+    m_chunkX.assign(slots, 0);
+    m_occupied.assign(slots, 0);
+    
+    printf("[ChunkStore] Initialized with %d slots\n", slots);
+    return true;
+}
+
+bool ChunkStore::Shutdown() {
+    for (uint8_t occupied : m_occupied) {
+        if (occupied) {
+            printf("[ChunkStore] ERROR: Cannot shut down while chunks are resident; release them first\n");
+            return false;
+        }
+    }
+    
+    m_capacity = 0;
+    m_tiles.clear();
+    m_tiles.shrink_to_fit();
+    m_vegetation.clear();
+    m_vegetation.shrink_to_fit();
+    m_chunkX.clear();
+    m_occupied.clear();
+    return true;
+}
+
+uint8_t* ChunkStore::AllocateChunk(int32_t chunkX) {
+    if (m_capacity == 0) return nullptr;
+    
+    int slot = SlotFor(chunkX);
+    if (m_occupied[slot]) {
+        return nullptr;
+    }
+    
+    m_occupied[slot] = 1;
+    m_chunkX[slot] = chunkX;
+    
+    uint8_t* tiles = &m_tiles[static_cast<size_t>(slot) * ChunkTileCount];
+    std::memset(tiles, 0, ChunkTileCount);
+    std::memset(&m_vegetation[static_cast<size_t>(slot) * ChunkWidth], 0, ChunkWidth);
+    return tiles;
+}
+
+void ChunkStore::ReleaseChunk(int32_t chunkX) {
+    int slot = FindSlot(chunkX);
+    if (slot >= 0) {
+        m_occupied[slot] = 0;
+    }
+}
+
+bool ChunkStore::IsResident(int32_t chunkX) const {
+    return FindSlot(chunkX) >= 0;
+}
+
+uint8_t* ChunkStore::GetTiles(int32_t chunkX) {
+    int slot = FindSlot(chunkX);
+    return slot >= 0 ? &m_tiles[static_cast<size_t>(slot) * ChunkTileCount] : nullptr;
+}
+
+uint8_t* ChunkStore::GetVegetation(int32_t chunkX) {
+    int slot = FindSlot(chunkX);
+    return slot >= 0 ? &m_vegetation[static_cast<size_t>(slot) * ChunkWidth] : nullptr;
+}
+
+uint8_t ChunkStore::GetTile(int32_t worldX, int32_t worldY) const {
+    if (worldY < 0 || worldY >= ChunkHeight) return 0;
+    
+    int slot = FindSlot(WorldToChunkCoord(worldX));
+    if (slot < 0) return 0;
+    
+    return m_tiles[static_cast<size_t>(slot) * ChunkTileCount + worldY * ChunkWidth + WorldToLocalCoord(worldX)];
+}
+
+bool ChunkStore::SetTile(int32_t worldX, int32_t worldY, uint8_t tile) {
+    if (worldY < 0 || worldY >= ChunkHeight) return false;
+    
+    int slot = FindSlot(WorldToChunkCoord(worldX));
+    if (slot < 0) return false;
+    
+    m_tiles[static_cast<size_t>(slot) * ChunkTileCount + worldY * ChunkWidth + WorldToLocalCoord(worldX)] = tile;
+    return true;
+}
+
+// ===== C API Implementation =====
+
+extern "C" ENGINE_API bool World_InitChunkStore(int capacity) {
+    return ChunkStore::Instance().Initialize(capacity);
+}
+
+extern "C" ENGINE_API bool World_ShutdownChunkStore() {
+    return ChunkStore::Instance().Shutdown();
+}
+
+extern "C" ENGINE_API uint8_t* World_AllocateChunk(int chunkX) {
+    return ChunkStore::Instance().AllocateChunk(chunkX);
+}
+
+extern "C" ENGINE_API void World_ReleaseChunk(int chunkX) {
+    ChunkStore::Instance().ReleaseChunk(chunkX);
+}
+
+extern "C" ENGINE_API uint8_t* World_GetChunkTiles(int chunkX) {
+    return ChunkStore::Instance().GetTiles(chunkX);
+}
+
+extern "C" ENGINE_API uint8_t* World_GetChunkVegetation(int chunkX) {
+    return ChunkStore::Instance().GetVegetation(chunkX);
+}
+
+extern "C" ENGINE_API int World_GetTile(int worldX, int worldY) {
+    return ChunkStore::Instance().GetTile(worldX, worldY);
+}
+
+extern "C" ENGINE_API bool World_SetTile(int worldX, int worldY, int tile) {
+    if (tile < 0 || tile > 255) return false;
+    return ChunkStore::Instance().SetTile(worldX, worldY, static_cast<uint8_t>(tile));
+}
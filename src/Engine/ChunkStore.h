@@ -0,0 +1,176 @@
+#pragma once
+
+#include "EngineExport.h"
+#include <cstdint>
+#include <vector>
+
+// Chronicles of a Drifter - Native Chunk Tile Store
+// Holds loaded chunks in contiguous arrays so tiles can be read without lookups
+
+namespace Chronicles {
+namespace World {
+
+constexpr int ChunkWidth = 32;
+constexpr int ChunkHeight = 30;
+constexpr int ChunkTileCount = ChunkWidth * ChunkHeight;
+
+/// <summary>
+/// Tile type IDs; values must match the managed TileType enum
+/// </summary>
+enum class TileType : uint8_t {
+    Air = 0,
+    Grass,
+    Dirt,
+    Stone,
+    DeepStone,
+    Bedrock,
+    Sand,
+    Water,
+    Snow,
+    IronOre,
+    CopperOre,
+    GoldOre,
+    SilverOre,
+    CoalOre,
+    DiamondOre,
+    DeepWater,
+    Sandstone,
+    Limestone,
+    Iron,
+    Gold,
+    Coal,
+    Wood,
+    WoodPlank,
+    Cobblestone,
+    Brick,
+    TreeOak,
+    TreePine,
+    TreePalm,
+    TallGrass,
+    Bush,
+    Cactus,
+    Flower,
+    Torch
+};
+
+/// <summary>
+/// Fixed-capacity ring of chunk slots indexed by chunk X.
+/// Data is stored structure-of-arrays: one contiguous tile array and one
+/// vegetation array for all slots. Tiles are row-major (index = y * ChunkWidth + x).
+/// Slot memory never moves, so pointers stay valid until the chunk is released.
+/// Not thread-safe; intended for use from the main thread.
+/// </summary>
+class ChunkStore {
+public:
+    static ChunkStore& Instance() {
+        static ChunkStore instance;
+        return instance;
+    }
+    
+    /// <summary>
+    /// Allocate storage for the given number of slots (rounded up to a power of two).
+    /// Fails while any chunk is still resident, since another owner may be using it.
+    /// </summary>
+    bool Initialize(int capacity);
+    
+    /// <summary>
+    /// Free all slots. Fails while any chunk is still resident, for the same reason.
+    /// </summary>
+    bool Shutdown();
+    bool IsInitialized() const { return m_capacity > 0; }
+    int GetCapacity() const { return m_capacity; }
+    
+    /// <summary>
+    /// Claim the slot for a chunk and clear it to air.
+    /// Returns nullptr if the slot is held by any resident chunk, including this one:
+    /// its owner reaches it through GetTiles, and a second claim would wipe it.
+    /// </summary>
+    uint8_t* AllocateChunk(int32_t chunkX);
+    void ReleaseChunk(int32_t chunkX);
+    bool IsResident(int32_t chunkX) const;
+    
+    uint8_t* GetTiles(int32_t chunkX);
+    uint8_t* GetVegetation(int32_t chunkX);
+    
+    // World-coordinate accessors; non-resident chunks read as air
+    uint8_t GetTile(int32_t worldX, int32_t worldY) const;
+    bool SetTile(int32_t worldX, int32_t worldY, uint8_t tile);
+    
+    static int32_t WorldToChunkCoord(int32_t worldX) {
+        return worldX >= 0 ? worldX / ChunkWidth : (worldX - ChunkWidth + 1) / ChunkWidth;
+    }
+    
+    static int32_t WorldToLocalCoord(int32_t worldX) {
+        int32_t local = worldX % ChunkWidth;
+        return local >= 0 ? local : local + ChunkWidth;
+    }
+
+private:
+    ChunkStore() = default;
+    
+    int SlotFor(int32_t chunkX) const {
+        return static_cast<int>(static_cast<uint32_t>(chunkX) & static_cast<uint32_t>(m_capacity - 1));
+    }
+    
+    int FindSlot(int32_t chunkX) const {
+        if (m_capacity == 0) return -1;
+        int slot = SlotFor(chunkX);
+        return (m_occupied[slot] && m_chunkX[slot] == chunkX) ? slot : -1;
+    }
+    
+    int m_capacity = 0;
+    std::vector<uint8_t> m_tiles;        // capacity * ChunkTileCount
+    std::vector<uint8_t> m_vegetation;   // capacity * ChunkWidth (0 = none)
+    std::vector<int32_t> m_chunkX;       // resident chunk X per slot
+    std::vector<uint8_t> m_occupied;     // slot in use
+};
+
+} // namespace World
+} // namespace Chronicles
+
+// C API for cross-language access
+extern "C" {
+    /// <summary>
+    /// Initialize the chunk store with room for at least capacity chunks; fails while
+    /// chunks allocated under an earlier initialization are still resident
+    /// </summary>
+    ENGINE_API bool World_InitChunkStore(int capacity);
+    
+    /// <summary>
+    /// Release all chunk storage; fails while any chunk is still resident
+    /// </summary>
+    ENGINE_API bool World_ShutdownChunkStore();
+    
+    /// <summary>
+    /// Claim storage for a chunk; returns its tile array (ChunkWidth * ChunkHeight bytes,
+    /// row-major) or null if the ring slot is taken, even by this chunk (use
+    /// World_GetChunkTiles to reach a resident chunk)
+    /// </summary>
+    ENGINE_API uint8_t* World_AllocateChunk(int chunkX);
+    
+    /// <summary>
+    /// Release a chunk's storage; pointers previously returned for it become invalid
+    /// </summary>
+    ENGINE_API void World_ReleaseChunk(int chunkX);
+    
+    /// <summary>
+    /// Get a stable pointer to a resident chunk's tiles, or null if not resident
+    /// </summary>
+    ENGINE_API uint8_t* World_GetChunkTiles(int chunkX);
+    
+    /// <summary>
+    /// Get a stable pointer to a resident chunk's surface vegetation (ChunkWidth bytes, 0 = none)
+    /// </summary>
+    ENGINE_API uint8_t* World_GetChunkVegetation(int chunkX);
+    
+    /// <summary>
+    /// Get the tile at a world coordinate (0 / air if the chunk is not resident)
+    /// </summary>
+    ENGINE_API int World_GetTile(int worldX, int worldY);
+    
+    /// <summary>
+    /// Set the tile at a world coordinate
+    /// </summary>
+    /// <returns>false if the chunk is not resident or the coordinate is out of range</returns>
+    ENGINE_API bool World_SetTile(int worldX, int worldY, int tile);
+}
@@ -1128,6 +1128,16 @@ LRESULT CALLBACK D3D11Renderer::WindowProc(HWND hwnd, UINT message, WPARAM wPara
             // Middle mouse button (button 2)
             Engine_SetMouseButtonState(2, false);
             return 0;
+            
+        case WM_MOUSEWHEEL:
+            // Vertical wheel, in notches (WHEEL_DELTA units)
+            Engine_SetMouseWheel(0.0f, static_cast<float>(GET_WHEEL_DELTA_WPARAM(wParam)) / WHEEL_DELTA);
+            return 0;
+            
+        case WM_MOUSEHWHEEL:
+            // Horizontal wheel, in notches
+            Engine_SetMouseWheel(static_cast<float>(GET_WHEEL_DELTA_WPARAM(wParam)) / WHEEL_DELTA, 0.0f);
+            return 0;
     }
     
     return DefWindowProc(hwnd, message, wParam, lParam);
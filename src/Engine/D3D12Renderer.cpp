@@ -752,6 +752,16 @@ LRESULT CALLBACK D3D12Renderer::WindowProc(HWND hwnd, UINT message, WPARAM wPara
             // Middle mouse button (button 2)
             Engine_SetMouseButtonState(2, false);
             break;
+            
+        case WM_MOUSEWHEEL:
+            // Vertical wheel, in notches (WHEEL_DELTA units)
+            Engine_SetMouseWheel(0.0f, static_cast<float>(GET_WHEEL_DELTA_WPARAM(wParam)) / WHEEL_DELTA);
+            break;
+            
+        case WM_MOUSEHWHEEL:
+            // Horizontal wheel, in notches
+            Engine_SetMouseWheel(static_cast<float>(GET_WHEEL_DELTA_WPARAM(wParam)) / WHEEL_DELTA, 0.0f);
+            break;
         
         default:
             return DefWindowProc(hwnd, message, wParam, lParam);
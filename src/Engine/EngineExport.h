@@ -0,0 +1,14 @@
+#pragma once
+
+// Chronicles of a Drifter - Export Macro
+// ENGINE_API marks the C API exported from the engine library
+
+#ifdef _WIN32
+    #ifdef ENGINE_EXPORTS
+        #define ENGINE_API __declspec(dllexport)
+    #else
+        #define ENGINE_API __declspec(dllimport)
+    #endif
+#else
+    #define ENGINE_API
+#endif
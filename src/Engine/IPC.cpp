@@ -1,17 +1,797 @@
 #include "IPC.h"
 #include "Reflection.h"
+#include "SceneDelta.h"
 #include "Serialization.h"
+#include "SharedMemoryRing.h"
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+#ifdef __linux__
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#define CHRONICLES_IPC_SOCKETS
+#endif
 
 using namespace Chronicles::IPC;
 using namespace Chronicles::Reflection;
 using namespace Chronicles::Serialization;
+using Chronicles::SharedMemoryRing;
+
+// ===== Framing =====
+
+#ifdef CHRONICLES_IPC_SOCKETS
+namespace {
+    constexpr size_t FrameHeaderSize = 12;
+    constexpr uint32_t MaxPayloadSize = 64u * 1024 * 1024;
+    constexpr size_t MaxPendingOutput = 256u * 1024 * 1024;  // Drop clients that stop reading
+    constexpr uint32_t MinSharedRingBytes = 64u * 1024;
+    constexpr uint32_t MaxSharedRingBytes = 256u * 1024 * 1024;
+    constexpr int SharedChannelFdCount = 3;  // memfd, server wakeup, client wakeup
+    
+    void PutU32(uint8_t* out, uint32_t value) {
+        out[0] = static_cast<uint8_t>(value);
+        out[1] = static_cast<uint8_t>(value >> 8);
+        out[2] = static_cast<uint8_t>(value >> 16);
+        out[3] = static_cast<uint8_t>(value >> 24);
+    }
+    
+    uint32_t GetU32(const uint8_t* in) {
+        return static_cast<uint32_t>(in[0]) | (static_cast<uint32_t>(in[1]) << 8) |
+               (static_cast<uint32_t>(in[2]) << 16) | (static_cast<uint32_t>(in[3]) << 24);
+    }
+    
+    void AppendFrame(std::vector<uint8_t>& out, MessageType type, int requestId, const std::string& payload) {
+        const size_t start = out.size();
+        out.resize(start + FrameHeaderSize + payload.size());
+        uint8_t* header = out.data() + start;
+        const uint32_t typeBits = static_cast<uint32_t>(type) & 0xFFFFu;
+        PutU32(header, static_cast<uint32_t>(payload.size()));
+        PutU32(header + 4, static_cast<uint32_t>(requestId));
+        PutU32(header + 8, typeBits);
+        if (!payload.empty()) {
+            std::memcpy(header + FrameHeaderSize, payload.data(), payload.size());
+        }
+    }
+    
+    enum class FrameStatus { Complete, Partial, Invalid };
+    
+    /// <summary>
+    /// Parse the frame at data[offset]; on Complete, offset moves past it
+    /// </summary>
+    FrameStatus ParseFrame(const std::vector<uint8_t>& data, size_t& offset, Message& out) {
+        const size_t available = data.size() - offset;
+        if (available < FrameHeaderSize) {
+            return FrameStatus::Partial;
+        }
+        const uint8_t* header = data.data() + offset;
+        const uint32_t payloadSize = GetU32(header);
+        if (payloadSize > MaxPayloadSize) {
+            return FrameStatus::Invalid;
+        }
+        if (available < FrameHeaderSize + payloadSize) {
+            return FrameStatus::Partial;
+        }
+        out.requestId = static_cast<int>(GetU32(header + 4));
+        out.type = static_cast<MessageType>(GetU32(header + 8) & 0xFFFFu);
+        out.payload.assign(reinterpret_cast<const char*>(header + FrameHeaderSize), payloadSize);
+        offset += FrameHeaderSize + payloadSize;
+        return FrameStatus::Complete;
+    }
+    
+    /// <summary>
+    /// Drop the consumed prefix of a receive buffer
+    /// </summary>
+    void Consume(std::vector<uint8_t>& data, size_t& offset) {
+        if (offset == data.size()) {
+            data.clear();
+        } else if (offset > 0) {
+            data.erase(data.begin(), data.begin() + static_cast<std::ptrdiff_t>(offset));
+        }
+        offset = 0;
+    }
+    
+    bool BuildSocketAddress(const std::string& pipeName, sockaddr_un& address) {
+        std::string path;
+        if (!pipeName.empty() && pipeName[0] == '/') {
+            path = pipeName;
+        } else {
+            const char* runtimeDir = std::getenv("XDG_RUNTIME_DIR");
+            path = std::string(runtimeDir && *runtimeDir ? runtimeDir : "/tmp") + "/" + pipeName + ".sock";
+        }
+        
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path)) {
+            printf("[IPC] ERROR: Socket path too long: %s\n", path.c_str());
+            return false;
+        }
+        std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+        return true;
+    }
+    
+    /// <summary>
+    /// Remove a socket file left by an engine that crashed, so bind can reuse the path.
+    /// Returns false, leaving the file alone, if a server still answers on it.
+    /// </summary>
+    bool RemoveStaleSocket(const sockaddr_un& address) {
+        int probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (probe < 0) {
+            return true;  // bind reports the real problem
+        }
+        
+        bool inUse = connect(probe, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+        int error = errno;
+        close(probe);
+        if (inUse) {
+            printf("[IPC] ERROR: Another server is already listening on %s\n", address.sun_path);
+            return false;
+        }
+        if (error == ECONNREFUSED) {
+            unlink(address.sun_path);
+        }
+        return true;
+    }
+    
+    /// <summary>
+    /// Read everything currently available on a non-blocking socket.
+    /// Returns false once the peer has closed or the socket failed.
+    /// </summary>
+    bool ReceiveAvailable(int fd, std::vector<uint8_t>& input) {
+        for (;;) {
+            const size_t start = input.size();
+            input.resize(start + 64 * 1024);
+            const ssize_t received = recv(fd, input.data() + start, 64 * 1024, MSG_DONTWAIT);
+            input.resize(start + (received > 0 ? static_cast<size_t>(received) : 0));
+            if (received > 0) {
+                continue;
+            }
+            if (received == 0) {
+                return false;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+    }
+    
+    /// <summary>
+    /// Block until all of data has been written
+    /// </summary>
+    bool SendAll(int fd, const uint8_t* data, size_t size) {
+        while (size > 0) {
+            const ssize_t sent = send(fd, data, size, MSG_NOSIGNAL);
+            if (sent < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            data += sent;
+            size -= static_cast<size_t>(sent);
+        }
+        return true;
+    }
+    
+    /// <summary>
+    /// Wake a peer sleeping on an eventfd
+    /// </summary>
+    void Signal(int eventFd) {
+        const uint64_t one = 1;
+        ssize_t written;
+        do {
+            written = write(eventFd, &one, sizeof(one));
+        } while (written < 0 && errno == EINTR);
+    }
+    
+    /// <summary>
+    /// Reset an eventfd after waking on it
+    /// </summary>
+    void DrainSignal(int eventFd) {
+        uint64_t count;
+        ssize_t received;
+        do {
+            received = read(eventFd, &count, sizeof(count));
+        } while (received < 0 && errno == EINTR);
+    }
+    
+    /// <summary>
+    /// Shared-memory region mapped by both ends: two SharedMemoryRings of equal capacity,
+    /// client-to-server first. Frames whose payload is too large for a ring use the socket.
+    /// </summary>
+    struct SharedChannel {
+        void* memory = nullptr;
+        size_t size = 0;
+        int wakeServerFd = -1;   // Signalled when the client writes to a server asleep in Update
+        int wakeClientFd = -1;   // Signalled when the server writes to a client asleep in WaitResponse
+        SharedMemoryRing toServer;
+        SharedMemoryRing toClient;
+        
+        ~SharedChannel() {
+            if (memory) munmap(memory, size);
+            if (wakeServerFd >= 0) close(wakeServerFd);
+            if (wakeClientFd >= 0) close(wakeClientFd);
+        }
+        
+        bool Map(int memoryFd, size_t mapSize) {
+            void* view = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, memoryFd, 0);
+            if (view == MAP_FAILED) {
+                return false;
+            }
+            memory = view;
+            size = mapSize;
+            return true;
+        }
+        
+        bool Attach() {
+            const size_t half = size / 2;
+            return toServer.Attach(memory, half) &&
+                   toClient.Attach(static_cast<uint8_t*>(memory) + half, half);
+        }
+    };
+    
+    struct Connection {
+        int fd = -1;
+        std::vector<uint8_t> input;
+        std::vector<uint8_t> output;
+        size_t outputOffset = 0;   // Bytes of output already sent
+        bool waitingWritable = false;
+        bool closed = false;
+        std::unique_ptr<SharedChannel> shared;
+        std::vector<uint8_t> sharedBacklog;  // Frames waiting for space in shared->toClient
+        int passFd = -1;           // Shared memory descriptor to send along with output[passOffset]
+        size_t passOffset = 0;
+        std::unique_ptr<SceneSnapshot> scene;  // What this client was last sent, once subscribed
+    };
+    
+    struct ServerState {
+        int listenFd = -1;
+        int epollFd = -1;
+        std::string socketPath;
+        std::unordered_map<int, Connection> clients;
+        std::unordered_map<int, int> wakeFds;  // Server wakeup eventfd -> client socket
+    };
+    
+    /// <summary>
+    /// Send the start of the shared channel's response frame with the channel's descriptors
+    /// </summary>
+    ssize_t SendWithDescriptors(Connection& connection, const uint8_t* data, size_t length) {
+        const int fds[SharedChannelFdCount] = {
+            connection.passFd, connection.shared->wakeServerFd, connection.shared->wakeClientFd
+        };
+        alignas(cmsghdr) char control[CMSG_SPACE(sizeof(fds))] = {};
+        iovec chunk = { const_cast<uint8_t*>(data), length };
+        msghdr message = {};
+        message.msg_iov = &chunk;
+        message.msg_iovlen = 1;
+        message.msg_control = control;
+        message.msg_controllen = sizeof(control);
+        cmsghdr* rights = CMSG_FIRSTHDR(&message);
+        rights->cmsg_level = SOL_SOCKET;
+        rights->cmsg_type = SCM_RIGHTS;
+        rights->cmsg_len = CMSG_LEN(sizeof(fds));
+        std::memcpy(CMSG_DATA(rights), fds, sizeof(fds));
+        return sendmsg(connection.fd, &message, MSG_NOSIGNAL | MSG_DONTWAIT);
+    }
+    
+    /// <summary>
+    /// Send as much queued output as the socket takes, watching for writability while any
+    /// remains. Marks the connection closed on failure.
+    /// </summary>
+    void Flush(ServerState& state, Connection& connection) {
+        while (connection.outputOffset < connection.output.size()) {
+            // Descriptors travel with one byte, so sends stop short of it and then carry it
+            const uint8_t* data = connection.output.data() + connection.outputOffset;
+            const bool passing = connection.passFd >= 0 && connection.outputOffset == connection.passOffset;
+            const size_t end = connection.passFd >= 0 && !passing ? connection.passOffset : connection.output.size();
+            const ssize_t sent = passing
+                ? SendWithDescriptors(connection, data, end - connection.outputOffset)
+                : send(connection.fd, data, end - connection.outputOffset, MSG_NOSIGNAL | MSG_DONTWAIT);
+            if (sent > 0) {
+                connection.outputOffset += static_cast<size_t>(sent);
+                if (passing) {
+                    close(connection.passFd);
+                    connection.passFd = -1;
+                }
+            } else if (sent < 0 && errno == EINTR) {
+                continue;
+            } else if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                break;
+            } else {
+                connection.closed = true;
+                return;
+            }
+        }
+        if (connection.passFd >= 0) {
+            connection.passOffset -= connection.outputOffset;
+        }
+        Consume(connection.output, connection.outputOffset);
+        
+        const bool wantWritable = !connection.output.empty();
+        if (wantWritable != connection.waitingWritable) {
+            epoll_event event = {};
+            event.events = EPOLLIN | EPOLLRDHUP | (wantWritable ? EPOLLOUT : 0u);
+            event.data.fd = connection.fd;
+            epoll_ctl(state.epollFd, EPOLL_CTL_MOD, connection.fd, &event);
+            connection.waitingWritable = wantWritable;
+        }
+        if (connection.output.size() > MaxPendingOutput) {
+            printf("[IPC] ERROR: Client %d is not reading; disconnecting\n", connection.fd);
+            connection.closed = true;
+        }
+    }
+    
+    /// <summary>
+    /// Send a frame through the shared ring or the socket without reordering it against
+    /// earlier frames. The client reads its socket before its ring, so a frame may use the
+    /// ring only once socket output has drained, and may use the socket only once the
+    /// client has emptied the ring. Returns false if it must wait (in sharedBacklog).
+    /// </summary>
+    bool TrySendOrdered(Connection& connection, MessageType type, int requestId, const char* payload, size_t size) {
+        SharedMemoryRing& ring = connection.shared->toClient;
+        if (!connection.output.empty() || (size > ring.MaxPayload() && ring.IsEmpty())) {
+            AppendFrame(connection.output, type, requestId, std::string(payload, size));
+            return true;
+        }
+        return size <= ring.MaxPayload() &&
+               ring.TryWrite(static_cast<uint16_t>(type), static_cast<uint32_t>(requestId), payload, size);
+    }
+    
+    /// <summary>
+    /// Send backlogged frames as the ring drains, in order
+    /// </summary>
+    void FlushSharedBacklog(Connection& connection) {
+        size_t offset = 0;
+        Message frame;
+        size_t next = 0;
+        while (ParseFrame(connection.sharedBacklog, next, frame) == FrameStatus::Complete &&
+               TrySendOrdered(connection, frame.type, frame.requestId, frame.payload.data(), frame.payload.size())) {
+            offset = next;
+        }
+        Consume(connection.sharedBacklog, offset);
+    }
+    
+    /// <summary>
+    /// Queue a frame for a client: through its shared ring when it has one and the payload
+    /// fits, otherwise on the socket (sent by the next Flush). Either way frames reach the
+    /// client in the order they were queued.
+    /// </summary>
+    void QueueFrame(Connection& connection, MessageType type, int requestId, const std::string& payload) {
+        if (!connection.shared) {
+            AppendFrame(connection.output, type, requestId, payload);
+            return;
+        }
+        if (!connection.sharedBacklog.empty() ||
+            !TrySendOrdered(connection, type, requestId, payload.data(), payload.size())) {
+            AppendFrame(connection.sharedBacklog, type, requestId, payload);
+            if (connection.sharedBacklog.size() > MaxPendingOutput) {
+                printf("[IPC] ERROR: Client %d is not reading its shared ring; disconnecting\n", connection.fd);
+                connection.closed = true;
+            }
+        }
+    }
+    
+    /// <summary>
+    /// Wake the client if it went to sleep waiting for frames already written to its ring
+    /// </summary>
+    void NotifyClient(Connection& connection) {
+        if (connection.shared && connection.shared->toClient.ShouldWake()) {
+            Signal(connection.shared->wakeClientFd);
+        }
+    }
+    
+    /// <summary>
+    /// Subscribe a client to scene deltas. Its next delta is a full resync unless the
+    /// sequence it reports is exactly the one it was last sent.
+    /// </summary>
+    std::string SubscribeScene(Connection& connection, const std::string& payload) {
+        const unsigned long lastSequence = std::strtoul(payload.c_str(), nullptr, 10);
+        if (!connection.scene) {
+            connection.scene = std::make_unique<SceneSnapshot>();
+        } else if (lastSequence == 0 || lastSequence != connection.scene->GetSequence()) {
+            connection.scene->RequestFullSync();
+        }
+        return "{\"success\":true}";
+    }
+    
+    /// <summary>
+    /// Create a shared channel for a client and queue the response frame behind earlier
+    /// output; Flush sends the channel's descriptors along with it
+    /// </summary>
+    bool OpenSharedChannel(ServerState& state, Connection& connection, int requestId, const std::string& payload) {
+        if (connection.shared) {
+            return false;
+        }
+        
+        // Ring capacity from the payload, rounded up to a power of two
+        const unsigned long requested = std::strtoul(payload.c_str(), nullptr, 10);
+        uint32_t capacity = MinSharedRingBytes;
+        while (capacity < requested && capacity < MaxSharedRingBytes) {
+            capacity <<= 1;
+        }
+        const size_t half = SharedMemoryRing::RegionSize(capacity);
+        
+        auto shared = std::make_unique<SharedChannel>();
+        const int memoryFd = memfd_create("chronicles-ipc", MFD_CLOEXEC);
+        shared->wakeServerFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        shared->wakeClientFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (memoryFd < 0 || shared->wakeServerFd < 0 || shared->wakeClientFd < 0 ||
+            ftruncate(memoryFd, static_cast<off_t>(half * 2)) != 0 || !shared->Map(memoryFd, half * 2)) {
+            printf("[IPC] ERROR: Cannot create shared channel: %s\n", std::strerror(errno));
+            if (memoryFd >= 0) close(memoryFd);
+            return false;
+        }
+        SharedMemoryRing::Initialize(shared->memory, capacity);
+        SharedMemoryRing::Initialize(static_cast<uint8_t*>(shared->memory) + half, capacity);
+        shared->Attach();
+        
+        connection.passFd = memoryFd;
+        connection.passOffset = connection.output.size();
+        AppendFrame(connection.output, MessageType::Response, requestId, std::to_string(capacity));
+        
+        epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.fd = shared->wakeServerFd;
+        epoll_ctl(state.epollFd, EPOLL_CTL_ADD, shared->wakeServerFd, &event);
+        state.wakeFds[shared->wakeServerFd] = connection.fd;
+        connection.shared = std::move(shared);
+        Flush(state, connection);
+        return true;
+    }
+    
+    void CloseConnection(ServerState& state, Connection& connection) {
+        if (connection.passFd >= 0) {
+            close(connection.passFd);
+        }
+        if (connection.shared) {
+            epoll_ctl(state.epollFd, EPOLL_CTL_DEL, connection.shared->wakeServerFd, nullptr);
+            state.wakeFds.erase(connection.shared->wakeServerFd);
+        }
+        epoll_ctl(state.epollFd, EPOLL_CTL_DEL, connection.fd, nullptr);
+        close(connection.fd);
+    }
+    
+    void AcceptClients(ServerState& state) {
+        for (;;) {
+            const int fd = accept4(state.listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return;
+            }
+            epoll_event event = {};
+            event.events = EPOLLIN | EPOLLRDHUP;
+            event.data.fd = fd;
+            if (epoll_ctl(state.epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+                close(fd);
+                continue;
+            }
+            state.clients[fd].fd = fd;
+        }
+    }
+    
+    const char* const ConnectionLost = "{\"error\":\"Connection lost\"}";
+    
+    struct ClientState {
+        int fd = -1;
+        std::vector<uint8_t> input;      // Owned by the reader thread in async mode
+        size_t inputOffset = 0;
+        std::unique_ptr<SharedChannel> shared;
+        std::vector<int> receivedFds;  // Descriptors passed by the server, not yet claimed
+        
+        // Guards responses, events and pending, which the reader thread fills in async mode
+        std::mutex mutex;
+        std::unordered_map<int, std::string> responses;  // Arrived but not yet waited for
+        std::vector<Message> events;
+        std::unordered_map<int, std::promise<std::string>> pending;  // Async requests in flight
+        std::unordered_map<int, std::future<std::string>> waiting;   // Futures for WaitResponse
+        std::unordered_set<int> syncRequests;  // Sent before async mode, not yet waited for
+        
+        // Async mode: after the first async request a reader thread owns every read, and
+        // writers (any thread) take writeMutex
+        std::mutex writeMutex;
+        std::thread reader;
+        bool async = false;
+        std::atomic<bool> lost{false};
+        
+        ~ClientState() {
+            for (int receivedFd : receivedFds) {
+                close(receivedFd);
+            }
+        }
+    };
+    
+    bool IsResponse(MessageType type, uint32_t requestId) {
+        return requestId != 0 && (type == MessageType::Response || type == MessageType::Error);
+    }
+    
+    /// <summary>
+    /// Complete the request's future, or park the response for WaitResponse
+    /// </summary>
+    void DeliverResponse(ClientState& state, int requestId, std::string&& payload) {
+        std::promise<std::string> promise;
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            auto it = state.pending.find(requestId);
+            if (it == state.pending.end()) {
+                state.responses[requestId] = std::move(payload);
+                return;
+            }
+            promise = std::move(it->second);
+            state.pending.erase(it);
+        }
+        promise.set_value(std::move(payload));
+    }
+    
+    void QueueEvent(ClientState& state, Message&& event) {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.events.push_back(std::move(event));
+    }
+    
+    /// <summary>
+    /// Sort the complete frames in a client's input into responses and events
+    /// </summary>
+    bool DispatchFrames(ClientState& state) {
+        Message message;
+        FrameStatus status;
+        while ((status = ParseFrame(state.input, state.inputOffset, message)) == FrameStatus::Complete) {
+            if (IsResponse(message.type, static_cast<uint32_t>(message.requestId))) {
+                DeliverResponse(state, message.requestId, std::move(message.payload));
+            } else {
+                QueueEvent(state, std::move(message));
+            }
+        }
+        Consume(state.input, state.inputOffset);
+        return status != FrameStatus::Invalid;
+    }
+    
+    /// <summary>
+    /// Read from the client socket, keeping any descriptors the server passed along.
+    /// Blocking reads return after the first chunk; otherwise reads until drained.
+    /// Returns false once the server has closed or the socket failed.
+    /// </summary>
+    bool ReceiveClient(ClientState& state, bool block) {
+        for (;;) {
+            const size_t start = state.input.size();
+            state.input.resize(start + 64 * 1024);
+            iovec data = { state.input.data() + start, 64 * 1024 };
+            alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * SharedChannelFdCount)];
+            msghdr message = {};
+            message.msg_iov = &data;
+            message.msg_iovlen = 1;
+            message.msg_control = control;
+            message.msg_controllen = sizeof(control);
+            
+            const ssize_t received = recvmsg(state.fd, &message, (block ? 0 : MSG_DONTWAIT) | MSG_CMSG_CLOEXEC);
+            state.input.resize(start + (received > 0 ? static_cast<size_t>(received) : 0));
+            if (received > 0) {
+                for (cmsghdr* item = CMSG_FIRSTHDR(&message); item; item = CMSG_NXTHDR(&message, item)) {
+                    if (item->cmsg_level == SOL_SOCKET && item->cmsg_type == SCM_RIGHTS) {
+                        const size_t count = (item->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+                        for (size_t i = 0; i < count; i++) {
+                            int receivedFd;
+                            std::memcpy(&receivedFd, CMSG_DATA(item) + i * sizeof(int), sizeof(int));
+                            state.receivedFds.push_back(receivedFd);
+                        }
+                    }
+                }
+                if (block) {
+                    return true;
+                }
+                continue;
+            }
+            if (received == 0) {
+                return false;
+            }
+            if (errno == EINTR) {
+                continue;
+            }
+            return !block && (errno == EAGAIN || errno == EWOULDBLOCK);
+        }
+    }
+    
+    /// <summary>
+    /// Take everything the server has written to the shared ring: responses are parked,
+    /// events are handed to onEvent in place or, without one, copied to the event queue.
+    /// Returns false if the ring holds a malformed frame.
+    /// </summary>
+    template<typename EventVisitor>
+    bool ReadSharedRing(ClientState& state, EventVisitor&& onEvent, size_t& outEvents) {
+        if (!state.shared) {
+            return true;
+        }
+        const bool valid = state.shared->toClient.Read([&](uint16_t type, uint32_t requestId, const char* payload, size_t size) {
+            const MessageType messageType = static_cast<MessageType>(type);
+            if (IsResponse(messageType, requestId)) {
+                DeliverResponse(state, static_cast<int>(requestId), std::string(payload, size));
+            } else {
+                onEvent(messageType, payload, size);
+                outEvents++;
+            }
+        });
+        if (!valid) {
+            printf("[IPC] ERROR: Malformed frame in shared ring from server\n");
+        }
+        return valid;
+    }
+    
+    bool ReadSharedRing(ClientState& state) {
+        size_t events = 0;
+        return ReadSharedRing(state, [&](MessageType type, const char* payload, size_t size) {
+            Message event;
+            event.type = type;
+            event.requestId = 0;
+            event.payload.assign(payload, size);
+            QueueEvent(state, std::move(event));
+        }, events);
+    }
+    
+    /// <summary>
+    /// Write requests: through the shared ring when open and the payload fits, the rest
+    /// concatenated into a single socket write. Holds writeMutex in async mode.
+    /// </summary>
+    bool WriteRequests(ClientState& state, const Message* requests, const int* requestIds, size_t count) {
+        std::vector<uint8_t> socketFrames;
+        SharedChannel* shared = state.shared.get();
+        for (size_t i = 0; i < count; i++) {
+            const Message& request = requests[i];
+            if (!shared || request.payload.size() > shared->toServer.MaxPayload()) {
+                AppendFrame(socketFrames, request.type, requestIds[i], request.payload);
+                continue;
+            }
+            while (!shared->toServer.TryWrite(static_cast<uint16_t>(request.type),
+                                              static_cast<uint32_t>(requestIds[i]),
+                                              request.payload.data(), request.payload.size())) {
+                // Ring full: make sure the server is awake, and notice if it went away
+                if (shared->toServer.ShouldWake()) {
+                    Signal(shared->wakeServerFd);
+                }
+                if (state.async ? state.lost.load() : (!ReceiveClient(state, false) || !DispatchFrames(state))) {
+                    return false;
+                }
+                std::this_thread::yield();
+            }
+        }
+        if (shared && shared->toServer.ShouldWake()) {
+            Signal(shared->wakeServerFd);
+        }
+        return socketFrames.empty() || SendAll(state.fd, socketFrames.data(), socketFrames.size());
+    }
+    
+    /// <summary>
+    /// Fail every request still waiting for a response
+    /// </summary>
+    void FailPending(ClientState& state) {
+        std::unordered_map<int, std::promise<std::string>> pending;
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            pending.swap(state.pending);
+        }
+        for (auto& [requestId, promise] : pending) {
+            promise.set_value(ConnectionLost);
+        }
+    }
+    
+    /// <summary>
+    /// Async mode reader: completes futures as responses arrive, in whatever order, and
+    /// queues events until the connection drops (Disconnect shuts the socket down)
+    /// </summary>
+    void ReaderLoop(ClientState* state) {
+        SharedChannel* shared = state->shared.get();
+        for (;;) {
+            if (!ReadSharedRing(*state)) {
+                break;
+            }
+            
+            pollfd waits[2] = { { state->fd, POLLIN, 0 }, { shared ? shared->wakeClientFd : -1, POLLIN, 0 } };
+            if (shared && !shared->toClient.BeginWait()) {
+                continue;
+            }
+            const int ready = poll(waits, 2, -1);
+            if (shared) {
+                shared->toClient.EndWait();
+            }
+            if (ready < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+            if (waits[1].revents) {
+                DrainSignal(shared->wakeClientFd);
+            }
+            if (waits[0].revents && (!ReceiveClient(*state, false) || !DispatchFrames(*state))) {
+                break;
+            }
+        }
+        state->lost = true;
+        FailPending(*state);
+    }
+    
+    int NextRequestId(int& nextRequestId) {
+        // 0 is reserved for events
+        const int requestId = nextRequestId;
+        nextRequestId = nextRequestId == 0x7FFFFFFF ? 1 : nextRequestId + 1;
+        return requestId;
+    }
+    
+    void StartReader(ClientState& state) {
+        if (state.async) {
+            return;
+        }
+        // Frames already read by synchronous calls are dispatched before the thread takes over
+        DispatchFrames(state);
+        {
+            // Requests sent synchronously and still unanswered get a future, like async ones,
+            // so WaitResponse can block on them once the reader owns the socket
+            std::lock_guard<std::mutex> lock(state.mutex);
+            for (int requestId : state.syncRequests) {
+                if (state.responses.count(requestId) == 0) {
+                    state.waiting[requestId] = state.pending[requestId].get_future();
+                }
+            }
+            state.syncRequests.clear();
+        }
+        state.async = true;
+        state.reader = std::thread(ReaderLoop, &state);
+    }
+    
+    /// <summary>
+    /// Register a promise per command, then write them all at once
+    /// </summary>
+    std::vector<std::future<std::string>> SendAsync(ClientState& state, int& nextRequestId,
+                                                    const Message* commands, size_t count,
+                                                    std::vector<int>& outRequestIds) {
+        std::lock_guard<std::mutex> writeLock(state.writeMutex);
+        StartReader(state);
+        
+        std::vector<std::future<std::string>> futures;
+        futures.reserve(count);
+        outRequestIds.resize(count);
+        {
+            // Registered before writing, since the reader may see a response before we return
+            std::lock_guard<std::mutex> lock(state.mutex);
+            for (size_t i = 0; i < count; i++) {
+                outRequestIds[i] = NextRequestId(nextRequestId);
+                futures.push_back(state.pending[outRequestIds[i]].get_future());
+            }
+        }
+        
+        if (state.lost || !WriteRequests(state, commands, outRequestIds.data(), count)) {
+            // Wakes the reader, which fails everything still pending
+            state.lost = true;
+            shutdown(state.fd, SHUT_RDWR);
+        }
+        if (state.lost) {
+            // The reader may already have exited before these were registered
+            FailPending(state);
+        }
+        return futures;
+    }
+}
+#endif
 
 // ===== IPCServer Implementation =====
 
 IPCServer::IPCServer() 
-    : m_running(false), m_platformData(nullptr) {
+    : m_running(false), m_scene(std::make_unique<SceneRegistry>()), m_platformData(nullptr) {
     InitializeDefaultHandlers();
 }
 
@@ -23,29 +803,187 @@ bool IPCServer::Start(const std::string& pipeName) {
     if (m_running) return true;
     
     m_pipeName = pipeName;
+
+#ifdef CHRONICLES_IPC_SOCKETS
+    sockaddr_un address;
+    if (!BuildSocketAddress(pipeName, address)) {
+        return false;
+    }
     
-    // Note: Platform-specific implementation would go here
-    // For Windows: Create named pipe with CreateNamedPipe
-    // For Unix: Create Unix domain socket
-    // For now, this is a stub
+    if (!RemoveStaleSocket(address)) {
+        return false;
+    }
+    
+    auto* state = new ServerState();
+    state->socketPath = address.sun_path;
+    state->listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    state->epollFd = epoll_create1(EPOLL_CLOEXEC);
+    
+    epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = state->listenFd;
+    bool bound = state->listenFd >= 0 &&
+                 bind(state->listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    if (!bound || state->epollFd < 0 ||
+        listen(state->listenFd, SOMAXCONN) != 0 ||
+        epoll_ctl(state->epollFd, EPOLL_CTL_ADD, state->listenFd, &event) != 0) {
+        printf("[IPC] ERROR: Cannot listen on %s: %s\n", state->socketPath.c_str(), std::strerror(errno));
+        if (state->listenFd >= 0) close(state->listenFd);
+        if (state->epollFd >= 0) close(state->epollFd);
+        // Only remove the file if this server created it
+        if (bound) unlink(state->socketPath.c_str());
+        delete state;
+        return false;
+    }
     
-    m_running = false; // Set to true when actually implemented
+    m_platformData = state;
+    m_running = true;
+    printf("[IPC] Listening on %s\n", state->socketPath.c_str());
+#else
+    // Named pipe transport for Windows is not implemented yet
+    printf("[IPC] ERROR: IPC transport is not available on this platform\n");
+#endif
     return m_running;
 }
 
 void IPCServer::Stop() {
     if (!m_running) return;
     
-    // Close platform-specific handles
+#ifdef CHRONICLES_IPC_SOCKETS
+    auto* state = static_cast<ServerState*>(m_platformData);
+    for (auto& [fd, connection] : state->clients) {
+        CloseConnection(*state, connection);
+    }
+    close(state->listenFd);
+    close(state->epollFd);
+    unlink(state->socketPath.c_str());
+    delete state;
+#endif
+    m_platformData = nullptr;
     m_running = false;
 }
 
-void IPCServer::Update() {
+void IPCServer::Update(int timeoutMs) {
     if (!m_running) return;
+
+#ifdef CHRONICLES_IPC_SOCKETS
+    auto* state = static_cast<ServerState*>(m_platformData);
+    
+    // Clients only signal a server that announced it is going to sleep, so a server
+    // polled every frame reads its shared rings without any system calls
+    bool sharedPending = false;
+    if (timeoutMs != 0) {
+        for (auto& [fd, connection] : state->clients) {
+            if (connection.shared && !connection.shared->toServer.BeginWait()) {
+                sharedPending = true;
+            }
+        }
+    }
+    
+    epoll_event events[64];
+    const int count = epoll_wait(state->epollFd, events, 64, sharedPending ? 0 : timeoutMs);
+    for (int i = 0; i < count; i++) {
+        const int fd = events[i].data.fd;
+        if (fd == state->listenFd) {
+            AcceptClients(*state);
+            continue;
+        }
+        auto wake = state->wakeFds.find(fd);
+        if (wake != state->wakeFds.end()) {
+            DrainSignal(fd);
+            continue;
+        }
+        
+        auto it = state->clients.find(fd);
+        if (it == state->clients.end()) {
+            continue;
+        }
+        Connection& connection = it->second;
+        
+        if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+            // Read first so requests sent just before a hang-up still get processed
+            const bool open = ReceiveAvailable(fd, connection.input);
+            
+            // Answer every complete request, then send all responses in one write
+            size_t offset = 0;
+            Message request;
+            FrameStatus status;
+            while ((status = ParseFrame(connection.input, offset, request)) == FrameStatus::Complete) {
+                if (request.type == MessageType::OpenSharedChannel) {
+                    if (!OpenSharedChannel(*state, connection, request.requestId, request.payload) && !connection.closed) {
+                        AppendFrame(connection.output, MessageType::Error, request.requestId,
+                                    "{\"error\":\"Shared channel unavailable\"}");
+                    }
+                    continue;
+                }
+                if (request.type == MessageType::SubscribeScene) {
+                    QueueFrame(connection, MessageType::Response, request.requestId,
+                               SubscribeScene(connection, request.payload));
+                    continue;
+                }
+                Message reply = HandleMessage(request);
+                QueueFrame(connection, reply.type, request.requestId, reply.payload);
+            }
+            Consume(connection.input, offset);
+            
+            if (status == FrameStatus::Invalid) {
+                printf("[IPC] ERROR: Malformed frame from client %d; disconnecting\n", fd);
+                connection.closed = true;
+            } else if (!open) {
+                connection.closed = true;
+            }
+        }
+    }
+    
+    Message request;
+    for (auto& [fd, connection] : state->clients) {
+        if (connection.shared) {
+            connection.shared->toServer.EndWait();
+            FlushSharedBacklog(connection);
+            const bool valid = connection.shared->toServer.Read([&](uint16_t type, uint32_t requestId, const char* payload, size_t size) {
+                request.type = static_cast<MessageType>(type);
+                request.requestId = static_cast<int>(requestId);
+                request.payload.assign(payload, size);
+                if (request.type == MessageType::SubscribeScene) {
+                    QueueFrame(connection, MessageType::Response, request.requestId,
+                               SubscribeScene(connection, request.payload));
+                    return;
+                }
+                Message reply = HandleMessage(request);
+                QueueFrame(connection, reply.type, request.requestId, reply.payload);
+            });
+            if (!valid) {
+                printf("[IPC] ERROR: Malformed frame in shared ring from client %d; disconnecting\n", fd);
+                connection.closed = true;
+            }
+            NotifyClient(connection);
+        }
+        if (!connection.closed && !connection.output.empty()) {
+            Flush(*state, connection);
+        }
+    }
     
-    // Poll for incoming messages
-    // Process each message with registered handlers
-    // Send responses
+    // Handlers and SendEvent may have failed writes to any client, not just this one
+    for (auto it = state->clients.begin(); it != state->clients.end();) {
+        if (it->second.closed) {
+            CloseConnection(*state, it->second);
+            it = state->clients.erase(it);
+        } else {
+            ++it;
+        }
+    }
+#else
+    (void)timeoutMs;
+#endif
+}
+
+size_t IPCServer::GetClientCount() const {
+#ifdef CHRONICLES_IPC_SOCKETS
+    if (m_running) {
+        return static_cast<const ServerState*>(m_platformData)->clients.size();
+    }
+#endif
+    return 0;
 }
 
 void IPCServer::RegisterHandler(MessageType type, MessageHandler handler) {
@@ -55,8 +993,56 @@ void IPCServer::RegisterHandler(MessageType type, MessageHandler handler) {
 void IPCServer::SendEvent(MessageType type, const std::string& payload) {
     if (!m_running) return;
     
-    // Send event to all connected clients
-    // Platform-specific implementation
+#ifdef CHRONICLES_IPC_SOCKETS
+    auto* state = static_cast<ServerState*>(m_platformData);
+    for (auto& [fd, connection] : state->clients) {
+        if (connection.closed) {
+            continue;
+        }
+        QueueFrame(connection, type, 0, payload);
+        NotifyClient(connection);
+        if (!connection.output.empty()) {
+            Flush(*state, connection);
+        }
+    }
+#else
+    (void)type; (void)payload;
+#endif
+}
+
+bool IPCServer::TrackObject(uint32_t objectId, const std::string& typeName, const void* instance) {
+    if (!m_scene->Track(objectId, typeName.c_str(), instance)) {
+        printf("[IPC] ERROR: Cannot track object %u: type '%s' is not reflected\n", objectId, typeName.c_str());
+        return false;
+    }
+    return true;
+}
+
+void IPCServer::UntrackObject(uint32_t objectId) {
+    m_scene->Untrack(objectId);
+}
+
+void IPCServer::PublishScene() {
+    if (!m_running) return;
+
+#ifdef CHRONICLES_IPC_SOCKETS
+    auto* state = static_cast<ServerState*>(m_platformData);
+    std::string payload;
+    for (auto& [fd, connection] : state->clients) {
+        if (connection.closed || !connection.scene) {
+            continue;
+        }
+        payload.clear();
+        if (!connection.scene->EncodeDelta(*m_scene, payload)) {
+            continue;
+        }
+        QueueFrame(connection, MessageType::SceneDelta, 0, payload);
+        NotifyClient(connection);
+        if (!connection.output.empty()) {
+            Flush(*state, connection);
+        }
+    }
+#endif
 }
 
 void IPCServer::InitializeDefaultHandlers() {
@@ -114,13 +1100,20 @@ void IPCServer::InitializeDefaultHandlers() {
     });
 }
 
-std::string IPCServer::HandleMessage(const Message& msg) {
+Message IPCServer::HandleMessage(const Message& msg) {
+    Message reply;
+    reply.requestId = msg.requestId;
+    
     auto it = m_handlers.find(msg.type);
     if (it == m_handlers.end()) {
-        return "{\"error\":\"Unknown message type\"}";
+        reply.type = MessageType::Error;
+        reply.payload = "{\"error\":\"Unknown message type\"}";
+        return reply;
     }
     
-    return it->second(msg.payload);
+    reply.type = MessageType::Response;
+    reply.payload = it->second(msg.payload);
+    return reply;
 }
 
 // ===== IPCClient Implementation =====
@@ -137,19 +1130,45 @@ bool IPCClient::Connect(const std::string& pipeName) {
     if (m_connected) return true;
     
     m_pipeName = pipeName;
+
+#ifdef CHRONICLES_IPC_SOCKETS
+    sockaddr_un address;
+    if (!BuildSocketAddress(pipeName, address)) {
+        return false;
+    }
     
-    // Platform-specific implementation
-    // For Windows: Connect to named pipe with CreateFile
-    // For Unix: Connect to Unix domain socket
+    // Blocking socket: SendCommand waits on it; PollEvents reads with MSG_DONTWAIT
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return false;
+    }
+    if (connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        close(fd);
+        return false;
+    }
     
-    m_connected = false; // Set to true when actually implemented
+    auto* state = new ClientState();
+    state->fd = fd;
+    m_platformData = state;
+    m_connected = true;
+#endif
     return m_connected;
 }
 
 void IPCClient::Disconnect() {
     if (!m_connected) return;
     
-    // Close platform-specific handles
+#ifdef CHRONICLES_IPC_SOCKETS
+    auto* state = static_cast<ClientState*>(m_platformData);
+    if (state->async) {
+        // Wakes the reader thread, which fails any requests still in flight
+        shutdown(state->fd, SHUT_RDWR);
+        state->reader.join();
+    }
+    close(state->fd);
+    delete state;
+#endif
+    m_platformData = nullptr;
     m_connected = false;
 }
 
@@ -158,27 +1177,263 @@ std::string IPCClient::SendCommand(MessageType type, const std::string& payload)
         return "{\"error\":\"Not connected\"}";
     }
     
-    // Create message with unique request ID
-    Message msg;
-    msg.type = type;
-    msg.payload = payload;
-    msg.requestId = m_nextRequestId++;
+    const int requestId = SendRequest(type, payload);
+    if (requestId == 0) {
+        return "{\"error\":\"Connection lost\"}";
+    }
+    return WaitResponse(requestId);
+}
+
+int IPCClient::SendRequest(MessageType type, const std::string& payload) {
+    if (!m_connected) {
+        return 0;
+    }
+
+#ifdef CHRONICLES_IPC_SOCKETS
+    auto* state = static_cast<ClientState*>(m_platformData);
+    Message request;
+    request.type = type;
+    request.payload = payload;
     
-    // Send message and wait for response
-    // Platform-specific implementation
+    if (state->async) {
+        std::vector<int> requestIds;
+        auto futures = SendAsync(*state, m_nextRequestId, &request, 1, requestIds);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->waiting[requestIds[0]] = std::move(futures[0]);
+        return requestIds[0];
+    }
     
+    const int requestId = NextRequestId(m_nextRequestId);
+    if (!WriteRequests(*state, &request, &requestId, 1)) {
+        Disconnect();
+        return 0;
+    }
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->syncRequests.insert(requestId);
+    return requestId;
+#else
+    (void)type; (void)payload;
+    return 0;
+#endif
+}
+
+std::string IPCClient::WaitResponse(int requestId) {
+    if (!m_connected) {
+        return "{\"error\":\"Not connected\"}";
+    }
+
+#ifdef CHRONICLES_IPC_SOCKETS
+    auto* state = static_cast<ClientState*>(m_platformData);
+    for (;;) {
+        if (!state->async && !ReadSharedRing(*state)) {
+            Disconnect();
+            return ConnectionLost;
+        }
+        std::future<std::string> future;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            auto it = state->responses.find(requestId);
+            if (it != state->responses.end()) {
+                std::string response = std::move(it->second);
+                state->responses.erase(it);
+                state->syncRequests.erase(requestId);
+                return response;
+            }
+            auto waiting = state->waiting.find(requestId);
+            if (waiting != state->waiting.end()) {
+                future = std::move(waiting->second);
+                state->waiting.erase(waiting);
+            } else if (state->async) {
+                return "{\"error\":\"Unknown request\"}";
+            }
+        }
+        if (future.valid()) {
+            return future.get();
+        }
+        
+        bool open = true;
+        SharedChannel* shared = state->shared.get();
+        if (!shared) {
+            // Block for the next chunk of data
+            open = ReceiveClient(*state, true);
+        } else if (shared->toClient.BeginWait()) {
+            // The response may come through the ring or, if large, the socket
+            pollfd waits[2] = { { state->fd, POLLIN, 0 }, { shared->wakeClientFd, POLLIN, 0 } };
+            const int ready = poll(waits, 2, -1);
+            shared->toClient.EndWait();
+            if (ready > 0 && waits[1].revents) {
+                DrainSignal(shared->wakeClientFd);
+            }
+            if (ready > 0 && waits[0].revents) {
+                open = ReceiveClient(*state, false);
+            }
+        }
+        if (!open || !DispatchFrames(*state)) {
+            Disconnect();
+            return ConnectionLost;
+        }
+    }
+#else
+    (void)requestId;
     return "{\"error\":\"Not implemented\"}";
+#endif
+}
+
+std::future<std::string> IPCClient::SendCommandAsync(MessageType type, const std::string& payload) {
+    Message command;
+    command.type = type;
+    command.payload = payload;
+    command.requestId = 0;
+    return std::move(SendBatchAsync({ command })[0]);
+}
+
+std::vector<std::future<std::string>> IPCClient::SendBatchAsync(const std::vector<Message>& commands) {
+#ifdef CHRONICLES_IPC_SOCKETS
+    if (m_connected) {
+        std::vector<int> requestIds;
+        return SendAsync(*static_cast<ClientState*>(m_platformData), m_nextRequestId,
+                         commands.data(), commands.size(), requestIds);
+    }
+#endif
+
+    // Not connected: every future is already complete with an error
+    std::vector<std::future<std::string>> futures;
+    for (size_t i = 0; i < commands.size(); i++) {
+        std::promise<std::string> promise;
+        promise.set_value("{\"error\":\"Not connected\"}");
+        futures.push_back(promise.get_future());
+    }
+    return futures;
 }
 
 std::vector<Message> IPCClient::PollEvents() {
     std::vector<Message> events;
     
     if (!m_connected) return events;
+
+#ifdef CHRONICLES_IPC_SOCKETS
+    auto* state = static_cast<ClientState*>(m_platformData);
+    bool open = true;
+    bool valid = true;
+    if (state->async) {
+        open = !state->lost;
+    } else {
+        open = ReceiveClient(*state, false);
+        valid = DispatchFrames(*state);
+        valid = ReadSharedRing(*state) && valid;
+    }
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        events.swap(state->events);
+    }
+    if (!open || !valid) {
+        Disconnect();
+    }
+#endif
+
+    return events;
+}
+
+bool IPCClient::OpenSharedChannel(size_t ringBytes) {
+    if (!m_connected) {
+        return false;
+    }
+
+#ifdef CHRONICLES_IPC_SOCKETS
+    auto* state = static_cast<ClientState*>(m_platformData);
+    if (state->shared) {
+        return true;
+    }
+    if (state->async) {
+        // The reader thread's poll set is fixed when it starts
+        printf("[IPC] ERROR: OpenSharedChannel must be called before SendCommandAsync\n");
+        return false;
+    }
     
-    // Poll for events from server
-    // Platform-specific implementation
+    const int requestId = SendRequest(MessageType::OpenSharedChannel, std::to_string(ringBytes));
+    if (requestId == 0) {
+        return false;
+    }
+    WaitResponse(requestId);
+    if (!m_connected || state->receivedFds.size() < SharedChannelFdCount) {
+        return false;
+    }
+    // Descriptors arrive in the order the server sent them: memfd, server wakeup, client wakeup
+    const int memoryFd = state->receivedFds[0];
+    auto shared = std::make_unique<SharedChannel>();
+    shared->wakeServerFd = state->receivedFds[1];
+    shared->wakeClientFd = state->receivedFds[2];
+    state->receivedFds.erase(state->receivedFds.begin(), state->receivedFds.begin() + SharedChannelFdCount);
     
-    return events;
+    struct stat info;
+    const bool mapped = fstat(memoryFd, &info) == 0 &&
+                        shared->Map(memoryFd, static_cast<size_t>(info.st_size)) && shared->Attach();
+    close(memoryFd);
+    if (!mapped) {
+        printf("[IPC] ERROR: Cannot map shared channel from server\n");
+        return false;
+    }
+    state->shared = std::move(shared);
+    return true;
+#else
+    (void)ringBytes;
+    return false;
+#endif
+}
+
+bool IPCClient::SubscribeScene(uint32_t lastSequence) {
+    if (!m_connected) {
+        return false;
+    }
+    const std::string response = SendCommand(MessageType::SubscribeScene, std::to_string(lastSequence));
+    return response.find("\"error\"") == std::string::npos;
+}
+
+bool IPCClient::HasSharedChannel() const {
+#ifdef CHRONICLES_IPC_SOCKETS
+    if (m_connected) {
+        return static_cast<const ClientState*>(m_platformData)->shared != nullptr;
+    }
+#endif
+    return false;
+}
+
+size_t IPCClient::ReadEvents(const EventVisitor& visitor) {
+    if (!m_connected) return 0;
+
+#ifdef CHRONICLES_IPC_SOCKETS
+    auto* state = static_cast<ClientState*>(m_platformData);
+    bool open = true;
+    bool valid = true;
+    std::vector<Message> queued;
+    if (state->async) {
+        open = !state->lost;
+    } else {
+        open = ReceiveClient(*state, false);
+        valid = DispatchFrames(*state);
+    }
+    {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        queued.swap(state->events);
+    }
+    
+    // Socket events were queued first, so deliver them before the ring's
+    size_t delivered = queued.size();
+    for (const Message& event : queued) {
+        visitor(event.type, event.payload.data(), event.payload.size());
+    }
+    if (!state->async && !ReadSharedRing(*state, visitor, delivered)) {
+        valid = false;
+    }
+    
+    if (!open || !valid) {
+        Disconnect();
+    }
+    return delivered;
+#else
+    (void)visitor;
+    return 0;
+#endif
 }
 
 // ===== C API Implementation =====
@@ -214,6 +1469,23 @@ extern "C" ENGINE_API void IPC_ServerSendEvent(void* server, int eventType, cons
     }
 }
 
+extern "C" ENGINE_API bool IPC_ServerTrackObject(void* server, int objectId, const char* typeName, const void* instance) {
+    if (!server || !typeName) return false;
+    return static_cast<IPCServer*>(server)->TrackObject(static_cast<uint32_t>(objectId), typeName, instance);
+}
+
+extern "C" ENGINE_API void IPC_ServerUntrackObject(void* server, int objectId) {
+    if (server) {
+        static_cast<IPCServer*>(server)->UntrackObject(static_cast<uint32_t>(objectId));
+    }
+}
+
+extern "C" ENGINE_API void IPC_ServerPublishScene(void* server) {
+    if (server) {
+        static_cast<IPCServer*>(server)->PublishScene();
+    }
+}
+
 extern "C" ENGINE_API void* IPC_CreateClient() {
     return new IPCClient();
 }
@@ -247,3 +1519,123 @@ extern "C" ENGINE_API bool IPC_ClientSendCommand(void* client, int commandType,
     
     return !result.empty();
 }
+
+extern "C" ENGINE_API int IPC_ClientSendRequest(void* client, int commandType, const char* payload) {
+    if (!client || !payload) {
+        return 0;
+    }
+    return static_cast<IPCClient*>(client)->SendRequest(static_cast<MessageType>(commandType), payload);
+}
+
+extern "C" ENGINE_API bool IPC_ClientWaitResponse(void* client, int requestId, char* response, int responseSize) {
+    if (!client || !response || responseSize <= 0) {
+        return false;
+    }
+    
+    auto result = static_cast<IPCClient*>(client)->WaitResponse(requestId);
+    
+    std::strncpy(response, result.c_str(), responseSize - 1);
+    response[responseSize - 1] = '\0';
+    
+    return !result.empty();
+}
+
+extern "C" ENGINE_API bool IPC_ClientOpenSharedChannel(void* client, int ringBytes) {
+    if (!client || ringBytes <= 0) {
+        return false;
+    }
+    return static_cast<IPCClient*>(client)->OpenSharedChannel(static_cast<size_t>(ringBytes));
+}
+
+extern "C" ENGINE_API int IPC_ClientReadEvents(void* client, IPCEventCallback callback, void* userData) {
+    if (!client || !callback) {
+        return 0;
+    }
+    
+    const size_t count = static_cast<IPCClient*>(client)->ReadEvents(
+        [&](MessageType type, const char* payload, size_t size) {
+            callback(static_cast<int>(type), payload, static_cast<int>(size), userData);
+        });
+    return static_cast<int>(count);
+}
+
+extern "C" ENGINE_API bool IPC_ClientSubscribeScene(void* client, unsigned int lastSequence) {
+    if (!client) return false;
+    return static_cast<IPCClient*>(client)->SubscribeScene(lastSequence);
+}
+
+extern "C" ENGINE_API void* IPC_CreateSceneMirror() {
+    return new SceneMirror();
+}
+
+extern "C" ENGINE_API void IPC_DestroySceneMirror(void* mirror) {
+    delete static_cast<SceneMirror*>(mirror);
+}
+
+extern "C" ENGINE_API int IPC_SceneMirrorApply(void* mirror, const void* payload, int size) {
+    if (!mirror || (!payload && size > 0) || size < 0) {
+        return static_cast<int>(SceneMirror::ApplyResult::Malformed);
+    }
+    return static_cast<int>(static_cast<SceneMirror*>(mirror)->Apply(static_cast<const char*>(payload),
+                                                                     static_cast<size_t>(size)));
+}
+
+extern "C" ENGINE_API unsigned int IPC_SceneMirrorGetSequence(void* mirror) {
+    if (!mirror) return 0;
+    return static_cast<SceneMirror*>(mirror)->GetSequence();
+}
+
+extern "C" ENGINE_API int IPC_SceneMirrorGetObjectCount(void* mirror) {
+    if (!mirror) return 0;
+    return static_cast<int>(static_cast<SceneMirror*>(mirror)->GetObjects().size());
+}
+
+extern "C" ENGINE_API int IPC_SceneMirrorGetField(void* mirror, unsigned int objectId, int fieldIndex,
+                                                  void* buffer, int bufferSize) {
+    if (!mirror || fieldIndex < 0 || bufferSize < 0 || (!buffer && bufferSize > 0)) {
+        return -1;
+    }
+    
+    const SceneMirror::Object* object = static_cast<SceneMirror*>(mirror)->Find(objectId);
+    if (!object || static_cast<size_t>(fieldIndex) >= object->fields.size()) {
+        return -1;
+    }
+    
+    const std::string& value = object->fields[fieldIndex];
+    if (value.size() <= static_cast<size_t>(bufferSize)) {
+        std::memcpy(buffer, value.data(), value.size());
+    }
+    return static_cast<int>(value.size());
+}
+
+extern "C" ENGINE_API int IPC_ClientSendCommandBatch(void* client, int count, const int* commandTypes,
+                                                     const char* const* payloads, char* responses,
+                                                     int responsesSize, int* responseLengths) {
+    auto* ipcClient = static_cast<IPCClient*>(client);
+    if (!ipcClient || !ipcClient->IsConnected() || count < 0 || (count > 0 && (!commandTypes || !payloads))) {
+        return -1;
+    }
+    
+    std::vector<Message> commands(static_cast<size_t>(count));
+    for (int i = 0; i < count; i++) {
+        commands[i].type = static_cast<MessageType>(commandTypes[i]);
+        commands[i].payload = payloads[i] ? payloads[i] : "";
+        commands[i].requestId = 0;
+    }
+    auto futures = ipcClient->SendBatchAsync(commands);
+    
+    int used = 0;
+    for (int i = 0; i < count; i++) {
+        const std::string response = futures[i].get();
+        const int length = static_cast<int>(response.size());
+        const bool fits = responses && length < responsesSize - used;
+        if (fits) {
+            std::memcpy(responses + used, response.c_str(), response.size() + 1);
+            used += length + 1;
+        }
+        if (responseLengths) {
+            responseLengths[i] = fits ? length : -1;
+        }
+    }
+    return count;
+}
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <string>
+#include <cstdint>
 #include <functional>
+#include <future>
 #include <map>
+#include <memory>
 #include <vector>
 
 #ifdef _WIN32
@@ -17,6 +20,24 @@
 
 // Chronicles of a Drifter - IPC System
 // Inter-Process Communication for Editor-Engine communication
+//
+// Transport (Linux): a Unix domain stream socket at $XDG_RUNTIME_DIR/<pipeName>.sock
+// (/tmp when unset), or at pipeName itself if it is an absolute path.
+// Each message is one frame (little-endian):
+//   u32 payload size | u32 requestId | u16 MessageType | u16 reserved | payload bytes
+// Responses echo the request's requestId; events carry requestId 0. Clients may write
+// any number of requests before reading; the server answers them in order.
+//
+// A client can also ask for a shared channel (OpenSharedChannel): the server creates a
+// memfd holding one SharedMemoryRing per direction and passes it, with an eventfd per
+// side for wakeups, over the socket. From then on frames travel through the rings with
+// no system call unless the reader is asleep; payloads too large for a ring still use
+// the socket. The server keeps what it sends in order across the two paths; a client's
+// large requests may be answered out of order with its ring traffic.
+//
+// Scene streaming: the host tracks reflected objects on the server and calls
+// PublishScene each frame. Clients that sent SubscribeScene get a SceneDelta event with
+// only the fields that changed since their last one (format in SceneDelta.h).
 
 namespace Chronicles {
 namespace IPC {
@@ -45,7 +66,14 @@ enum class MessageType {
     // Events
     ObjectSelected,
     ObjectModified,
-    SceneChanged
+    SceneChanged,
+    
+    // Transport control (handled by the transport, not by registered handlers)
+    OpenSharedChannel,
+    
+    // Scene streaming: request (payload = last sequence applied, 0 for none), binary event
+    SubscribeScene,
+    SceneDelta
 };
 
 /// <summary>
@@ -62,6 +90,13 @@ struct Message {
 /// </summary>
 using MessageHandler = std::function<std::string(const std::string& payload)>;
 
+/// <summary>
+/// Event callback for IPCClient::ReadEvents; payload is only valid during the call
+/// </summary>
+using EventVisitor = std::function<void(MessageType type, const char* payload, size_t size)>;
+
+class SceneRegistry;
+
 /// <summary>
 /// IPC server for engine side
 /// Listens for editor commands and sends events
@@ -72,7 +107,8 @@ public:
     ~IPCServer();
     
     /// <summary>
-    /// Start the IPC server
+    /// Start the IPC server. A socket file left by a crashed engine is replaced, but
+    /// Start fails if another server still answers on it.
     /// </summary>
     bool Start(const std::string& pipeName = "ChroniclesEngine");
     
@@ -87,9 +123,15 @@ public:
     bool IsRunning() const { return m_running; }
     
     /// <summary>
-    /// Process incoming messages (call from main loop)
+    /// Accept clients and answer every complete request they have sent (call from main
+    /// loop). Waits up to timeoutMs for activity; 0 returns immediately.
     /// </summary>
-    void Update();
+    void Update(int timeoutMs = 0);
+    
+    /// <summary>
+    /// Number of connected clients
+    /// </summary>
+    size_t GetClientCount() const;
     
     /// <summary>
     /// Register a message handler
@@ -101,16 +143,33 @@ public:
     /// </summary>
     void SendEvent(MessageType type, const std::string& payload);
     
+    /// <summary>
+    /// Stream an object's reflected fields to scene subscribers. instance is read in place
+    /// by every PublishScene, so it must stay valid until UntrackObject. Tracking an id
+    /// again replaces it. Returns false if the type is not reflected.
+    /// </summary>
+    bool TrackObject(uint32_t objectId, const std::string& typeName, const void* instance);
+    
+    void UntrackObject(uint32_t objectId);
+    
+    /// <summary>
+    /// Send each scene subscriber the fields changed since its last delta (call once per
+    /// frame, on the thread that changes the tracked objects). Nothing is sent to a
+    /// subscriber that is up to date.
+    /// </summary>
+    void PublishScene();
+    
 private:
     bool m_running;
     std::string m_pipeName;
     std::map<MessageType, MessageHandler> m_handlers;
+    std::unique_ptr<SceneRegistry> m_scene;
     
     // Platform-specific implementation
     void* m_platformData;
     
     void InitializeDefaultHandlers();
-    std::string HandleMessage(const Message& msg);
+    Message HandleMessage(const Message& msg);
 };
 
 /// <summary>
@@ -142,11 +201,59 @@ public:
     /// </summary>
     std::string SendCommand(MessageType type, const std::string& payload);
     
+    /// <summary>
+    /// Send a command without waiting. Returns its requestId for WaitResponse, or 0 if
+    /// not connected. Sending several before waiting pipelines them.
+    /// </summary>
+    int SendRequest(MessageType type, const std::string& payload);
+    
+    /// <summary>
+    /// Block until the response to a request from SendRequest arrives. Requests sent
+    /// before the first async call can still be waited for afterwards.
+    /// </summary>
+    std::string WaitResponse(int requestId);
+    
+    /// <summary>
+    /// Send a command without blocking; the future completes when its response arrives.
+    /// The first call starts a reader thread that completes futures in any order and
+    /// owns all reads from then on (ReadEvents then hands over copies, not views into the
+    /// shared ring). Safe to call from several threads.
+    /// </summary>
+    std::future<std::string> SendCommandAsync(MessageType type, const std::string& payload);
+    
+    /// <summary>
+    /// Send commands (type and payload of each Message) in a single write, so N requests
+    /// cost one round trip. Futures are in the same order as the commands.
+    /// </summary>
+    std::vector<std::future<std::string>> SendBatchAsync(const std::vector<Message>& commands);
+    
     /// <summary>
     /// Poll for events from engine
     /// </summary>
     std::vector<Message> PollEvents();
     
+    /// <summary>
+    /// Switch to a shared-memory channel with rings of about ringBytes per direction.
+    /// Returns false (staying on the socket) if the server or platform cannot provide one,
+    /// or if asynchronous requests have already been sent.
+    /// </summary>
+    bool OpenSharedChannel(size_t ringBytes = 4 * 1024 * 1024);
+    
+    bool HasSharedChannel() const;
+    
+    /// <summary>
+    /// Hand every pending event to visitor without blocking. Events in the shared ring are
+    /// read in place, without copying. Returns the number of events delivered.
+    /// </summary>
+    size_t ReadEvents(const EventVisitor& visitor);
+    
+    /// <summary>
+    /// Ask for SceneDelta events. lastSequence is the SceneMirror's sequence: the server
+    /// resyncs fully unless it matches what it last sent this client. Call again with the
+    /// mirror's sequence whenever SceneMirror::Apply asks for a resync.
+    /// </summary>
+    bool SubscribeScene(uint32_t lastSequence = 0);
+    
 private:
     bool m_connected;
     std::string m_pipeName;
@@ -169,6 +276,13 @@ extern "C" {
     ENGINE_API void IPC_ServerUpdate(void* server);
     ENGINE_API void IPC_ServerSendEvent(void* server, int eventType, const char* payload);
     
+    /// <summary>
+    /// Scene streaming (see IPCServer::TrackObject); instance must outlive its tracking
+    /// </summary>
+    ENGINE_API bool IPC_ServerTrackObject(void* server, int objectId, const char* typeName, const void* instance);
+    ENGINE_API void IPC_ServerUntrackObject(void* server, int objectId);
+    ENGINE_API void IPC_ServerPublishScene(void* server);
+    
     // Client API
     ENGINE_API void* IPC_CreateClient();
     ENGINE_API void IPC_DestroyClient(void* client);
@@ -176,4 +290,71 @@ extern "C" {
     ENGINE_API void IPC_ClientDisconnect(void* client);
     ENGINE_API bool IPC_ClientSendCommand(void* client, int commandType, 
                                           const char* payload, char* response, int responseSize);
+    
+    /// <summary>
+    /// Send a command without waiting (IPCClient::SendRequest)
+    /// </summary>
+    /// <returns>requestId for IPC_ClientWaitResponse, or 0 if not connected</returns>
+    ENGINE_API int IPC_ClientSendRequest(void* client, int commandType, const char* payload);
+    
+    /// <summary>
+    /// Block until the response to a request from IPC_ClientSendRequest arrives
+    /// </summary>
+    ENGINE_API bool IPC_ClientWaitResponse(void* client, int requestId, char* response, int responseSize);
+    
+    /// <summary>
+    /// Send count commands in one write and wait for all responses. Responses are packed
+    /// null-terminated into responses in order; responseLengths[i] gets each length, or -1
+    /// if it did not fit in responsesSize.
+    /// </summary>
+    /// <returns>Number of responses received, or -1 if not connected</returns>
+    ENGINE_API int IPC_ClientSendCommandBatch(void* client, int count, const int* commandTypes,
+                                              const char* const* payloads, char* responses,
+                                              int responsesSize, int* responseLengths);
+    
+    /// <summary>
+    /// Move the client onto a shared-memory channel (see IPCClient::OpenSharedChannel)
+    /// </summary>
+    ENGINE_API bool IPC_ClientOpenSharedChannel(void* client, int ringBytes);
+    
+    /// <summary>
+    /// Event callback; payload (not null-terminated) is only valid during the call
+    /// </summary>
+    typedef void (*IPCEventCallback)(int eventType, const char* payload, int size, void* userData);
+    
+    /// <summary>
+    /// Deliver all pending events to callback without blocking; returns how many
+    /// </summary>
+    ENGINE_API int IPC_ClientReadEvents(void* client, IPCEventCallback callback, void* userData);
+    
+    /// <summary>
+    /// Subscribe to SceneDelta events (see IPCClient::SubscribeScene)
+    /// </summary>
+    ENGINE_API bool IPC_ClientSubscribeScene(void* client, unsigned int lastSequence);
+    
+    /// <summary>
+    /// Editor-side copy of a streamed scene (SceneMirror in SceneDelta.h)
+    /// </summary>
+    ENGINE_API void* IPC_CreateSceneMirror();
+    ENGINE_API void IPC_DestroySceneMirror(void* mirror);
+    
+    /// <summary>
+    /// Apply a SceneDelta event payload
+    /// </summary>
+    /// <returns>SceneMirror::ApplyResult: 0 applied, 1 ignored, 2 needs resync, 3 malformed</returns>
+    ENGINE_API int IPC_SceneMirrorApply(void* mirror, const void* payload, int size);
+    
+    /// <summary>
+    /// Sequence of the last delta applied; pass it to IPC_ClientSubscribeScene to resync
+    /// </summary>
+    ENGINE_API unsigned int IPC_SceneMirrorGetSequence(void* mirror);
+    ENGINE_API int IPC_SceneMirrorGetObjectCount(void* mirror);
+    
+    /// <summary>
+    /// Copy one field of a mirrored object, encoded as in a SceneDelta record. Copies
+    /// nothing if bufferSize is too small.
+    /// </summary>
+    /// <returns>The value's length in bytes, or -1 if the object or field is unknown</returns>
+    ENGINE_API int IPC_SceneMirrorGetField(void* mirror, unsigned int objectId, int fieldIndex,
+                                           void* buffer, int bufferSize);
 }
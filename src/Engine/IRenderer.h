@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ChroniclesEngine.h"  // For RectInstance, AtlasSpriteSource, RendererStats
+#include <cstddef>
 #include <string>
 
 // Abstract renderer interface for backend independence
@@ -11,7 +13,20 @@ enum class RendererBackend {
     SDL2,
     DirectX11,
     DirectX12,
-    Vulkan
+    Vulkan,
+    Null,       // Headless: no window or GPU, counts submitted work (CI benchmarking)
+    Software    // Headless with a CPU rasterizer for pixel output (image-diff tests)
+};
+
+// A single quad for batched submission.
+// textureId <= 0 draws an untextured (solid color) quad.
+// UVs are normalized; rotation is in radians around the quad center.
+struct BatchQuad {
+    int textureId = 0;
+    float x = 0.0f, y = 0.0f, width = 0.0f, height = 0.0f;
+    float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+    float rotation = 0.0f;
+    float r = 1.0f, g = 1.0f, b = 1.0f, a = 1.0f;
 };
 
 class IRenderer {
@@ -34,10 +49,56 @@ public:
     virtual void DrawSprite(int textureId, float x, float y,
                           float width, float height, float rotation) = 0;
     
+    // Batched submission
+    // Quads pushed between BeginBatch and FlushBatch are drawn in submission order.
+    // Backends without native batching fall back to immediate draws.
+    virtual void BeginBatch() {}
+    virtual void PushQuad(const BatchQuad& quad) {
+        if (quad.textureId <= 0) {
+            DrawRect(quad.x, quad.y, quad.width, quad.height, quad.r, quad.g, quad.b, quad.a);
+        } else {
+            DrawSprite(quad.textureId, quad.x, quad.y, quad.width, quad.height, quad.rotation);
+        }
+    }
+    virtual void FlushBatch() {}
+    
+    virtual void DrawRects(const RectInstance* rects, int count) {
+        for (int i = 0; i < count; i++) {
+            const RectInstance& rect = rects[i];
+            DrawRect(rect.x, rect.y, rect.width, rect.height, rect.r, rect.g, rect.b, rect.a);
+        }
+    }
+    
     // Texture operations
     virtual int LoadTexture(const char* filePath) = 0;
     virtual void UnloadTexture(int textureId) = 0;
     
+    // Asynchronous texture support: an ID is reserved up front and the decoded RGBA8
+    // pixels are uploaded later on the render thread. Backends without support return -1/false.
+    virtual int ReserveTextureId() { return -1; }
+    virtual bool UploadTexture(int textureId, const uint8_t* rgbaPixels, int width, int height) {
+        (void)textureId; (void)rgbaPixels; (void)width; (void)height;
+        return false;
+    }
+    
+    // Texture atlases (see Renderer_LoadAtlas); backends without atlas support return -1
+    virtual int LoadAtlas(const AtlasSpriteSource* sprites, int count, int pageSize) {
+        (void)sprites; (void)count; (void)pageSize;
+        return -1;
+    }
+    virtual void UnloadAtlas(int atlasId) { (void)atlasId; }
+    virtual void DrawSpriteRegion(int atlasId, int regionId, float x, float y,
+                                  float width, float height, float rotation) {
+        (void)atlasId; (void)regionId; (void)x; (void)y; (void)width; (void)height; (void)rotation;
+    }
+    
+    // Diagnostics (see Renderer_GetStats/Renderer_ReadPixels); unsupported by default
+    virtual bool GetStats(RendererStats& outStats) const { (void)outStats; return false; }
+    virtual bool ReadPixels(uint8_t* outRgba, size_t bufferSize) const {
+        (void)outRgba; (void)bufferSize;
+        return false;
+    }
+    
     // Getters
     virtual int GetWidth() const = 0;
     virtual int GetHeight() const = 0;
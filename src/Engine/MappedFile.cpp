@@ -0,0 +1,166 @@
+#include "MappedFile.h"
+#include <fstream>
+#include <new>
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CHRONICLES_HAS_MMAP
+#endif
+
+namespace Chronicles {
+
+namespace {
+    const uint8_t EmptyFile[1] = {};
+    
+    bool ReadWholeFile(const char* filePath, std::vector<uint8_t>& outBuffer) {
+        std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            return false;
+        }
+        // A directory opens fine on some platforms but has no size
+        const std::streamoff size = file.tellg();
+        if (size < 0) {
+            return false;
+        }
+        // Callers sit behind the C API, so a size too large to hold must not throw
+        try {
+            outBuffer.resize(static_cast<size_t>(size));
+        } catch (const std::bad_alloc&) {
+            return false;
+        } catch (const std::length_error&) {
+            return false;
+        }
+        file.seekg(0);
+        return outBuffer.empty() ||
+               static_cast<bool>(file.read(reinterpret_cast<char*>(outBuffer.data()), static_cast<std::streamsize>(outBuffer.size())));
+    }
+}
+
+bool MappedFile::Open(const char* filePath) {
+    Close();
+    if (!filePath) {
+        return false;
+    }
+
+#ifdef _WIN32
+    // Share everything so region files can keep being appended to while mapped
+    HANDLE file = CreateFileA(filePath, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    // Only regular files; pipes, consoles and the like cannot be mapped or sized
+    LARGE_INTEGER size;
+    if (GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+    if (size.QuadPart > 0) {
+        // The mapping object keeps the file open; the file handle is not needed after this
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+        if (view) {
+            m_mappingHandle = mapping;
+            m_mapping = view;
+            m_data = static_cast<const uint8_t*>(view);
+            m_size = static_cast<size_t>(size.QuadPart);
+        } else if (mapping) {
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+    if (size.QuadPart == 0) {
+        m_data = EmptyFile;
+        m_open = true;
+        return true;
+    }
+#elif defined(CHRONICLES_HAS_MMAP)
+    const int fd = open(filePath, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        close(fd);
+        return false;
+    }
+    if (info.st_size == 0) {
+        close(fd);
+        m_data = EmptyFile;
+        m_open = true;
+        return true;
+    }
+    // Shared so pages see data appended through other descriptors; the mapping outlives fd
+    void* view = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view != MAP_FAILED) {
+        m_mapping = view;
+        m_data = static_cast<const uint8_t*>(view);
+        m_size = static_cast<size_t>(info.st_size);
+    }
+#endif
+
+    if (!m_mapping) {
+        if (!ReadWholeFile(filePath, m_buffer)) {
+            m_buffer.clear();
+            return false;
+        }
+        m_size = m_buffer.size();
+        m_data = m_buffer.empty() ? EmptyFile : m_buffer.data();
+    }
+    m_open = true;
+    return true;
+}
+
+void MappedFile::Close() {
+    if (m_mapping) {
+#ifdef _WIN32
+        UnmapViewOfFile(m_mapping);
+        CloseHandle(m_mappingHandle);
+        m_mappingHandle = nullptr;
+#elif defined(CHRONICLES_HAS_MMAP)
+        munmap(m_mapping, m_size);
+#endif
+        m_mapping = nullptr;
+    }
+    m_buffer.clear();
+    m_buffer.shrink_to_fit();
+    m_data = nullptr;
+    m_size = 0;
+    m_open = false;
+}
+
+void MappedFile::Prefetch(size_t offset, size_t length) const {
+    if (!m_mapping || offset >= m_size) {
+        return;
+    }
+    if (length > m_size - offset) {
+        length = m_size - offset;
+    }
+
+#ifdef _WIN32
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = const_cast<uint8_t*>(m_data) + offset;
+    range.NumberOfBytes = length;
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#elif defined(CHRONICLES_HAS_MMAP)
+    // madvise wants a page-aligned start
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t alignedOffset = offset & ~(pageSize - 1);
+    madvise(const_cast<uint8_t*>(m_data) + alignedOffset, length + (offset - alignedOffset), MADV_WILLNEED);
+#endif
+}
+
+} // namespace Chronicles
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Chronicles of a Drifter - Memory-Mapped Files
+// Read-only views of whole files for parsers to read in place
+
+namespace Chronicles {
+
+/// <summary>
+/// Read-only view of a file. Uses mmap (POSIX) or a file mapping (Windows), so opening
+/// costs no reads and pages come in lazily as they are first touched; parsers can read
+/// straight from GetData() without copying. Falls back to reading the file into memory
+/// where mapping is unavailable or fails.
+/// The view keeps the size the file had when opened; reopen to see appended data.
+/// </summary>
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+    
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    
+    /// <summary>
+    /// Map a file, closing any file mapped before. Returns false if it cannot be opened.
+    /// </summary>
+    bool Open(const char* filePath);
+    void Close();
+    
+    bool IsOpen() const { return m_open; }
+    bool IsMapped() const { return m_mapping != nullptr; }
+    
+    /// <summary>
+    /// File contents; never null while open, even for an empty file
+    /// </summary>
+    const uint8_t* GetData() const { return m_data; }
+    size_t GetSize() const { return m_size; }
+    
+    /// <summary>
+    /// Hint that a range is about to be read start to finish, so the OS can read ahead
+    /// </summary>
+    void Prefetch(size_t offset, size_t length) const;
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    bool m_open = false;
+    void* m_mapping = nullptr;       // Mapped address, or null when using m_buffer
+#ifdef _WIN32
+    void* m_mappingHandle = nullptr;
+#endif
+    std::vector<uint8_t> m_buffer;   // Fallback copy
+};
+
+} // namespace Chronicles
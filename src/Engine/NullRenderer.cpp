@@ -0,0 +1,369 @@
+#include "NullRenderer.h"
+#include "TextureAtlas.h"
+#include "TextureLoader.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace Chronicles {
+
+namespace {
+    const int DefaultAtlasPageSize = 2048;
+    const int AtlasPadding = 1;  // Same as SDL2Renderer so pages split identically
+}
+
+NullRenderer::NullRenderer(bool rasterize)
+    : m_width(0)
+    , m_height(0)
+    , m_isRunning(false)
+    , m_nextTextureId(1)
+    , m_batchTextureId(0)
+    , m_batchQuads(0)
+    , m_stats{}
+    , m_frameStats{}
+    , m_rasterize(rasterize)
+{
+}
+
+bool NullRenderer::Initialize(int width, int height, const char* title) {
+    printf("[NullRenderer] Initializing headless renderer\n");
+    printf("[NullRenderer] Virtual screen: %dx%d - %s\n", width, height, title ? title : "");
+    
+    if (width <= 0 || height <= 0) {
+        printf("[NullRenderer] ERROR: Invalid screen size\n");
+        return false;
+    }
+    
+    m_width = width;
+    m_height = height;
+    m_stats = {};
+    m_frameStats = {};
+
+#ifdef _WIN32
+    char* framebufferEnvBuf = nullptr;
+    size_t bufSize = 0;
+    _dupenv_s(&framebufferEnvBuf, &bufSize, "CHRONICLES_NULL_FRAMEBUFFER");
+    const char* framebufferEnv = framebufferEnvBuf;
+#else
+    const char* framebufferEnv = std::getenv("CHRONICLES_NULL_FRAMEBUFFER");
+#endif
+    if (m_rasterize || (framebufferEnv && std::string(framebufferEnv) == "1")) {
+        m_rasterizer = std::make_unique<SoftwareRasterizer>(width, height, 0);
+        printf("[NullRenderer] Software rasterizer enabled (%d threads)\n", m_rasterizer->GetThreadCount());
+    }
+#ifdef _WIN32
+    free(framebufferEnvBuf);
+#endif
+
+    m_isRunning = true;
+    return true;
+}
+
+void NullRenderer::Shutdown() {
+    if (!m_isRunning && m_textures.empty()) {
+        return;
+    }
+    
+    printf("[NullRenderer] Shutting down after %llu frames (%llu draw calls, %llu vertices)\n",
+           static_cast<unsigned long long>(m_stats.framesPresented),
+           static_cast<unsigned long long>(m_stats.totalDrawCalls),
+           static_cast<unsigned long long>(m_stats.totalVertices));
+    
+    m_textures.clear();
+    m_atlases.clear();
+    m_rasterizer.reset();
+    m_isRunning = false;
+}
+
+void NullRenderer::BeginFrame() {
+    BeginBatch();
+}
+
+void NullRenderer::EndFrame() {
+    // Frame end is handled by Present()
+}
+
+void NullRenderer::Present() {
+    FlushBatch();
+    if (m_rasterizer) {
+        m_rasterizer->Flush();
+    }
+    
+    m_stats.framesPresented++;
+    m_stats.drawCalls = m_frameStats.drawCalls;
+    m_stats.quads = m_frameStats.quads;
+    m_stats.vertices = m_frameStats.vertices;
+    m_stats.stateChanges = m_frameStats.stateChanges;
+    m_stats.clears = m_frameStats.clears;
+    m_stats.textureUploads = m_frameStats.textureUploads;
+    m_stats.totalDrawCalls += m_frameStats.drawCalls;
+    m_stats.totalQuads += m_frameStats.quads;
+    m_stats.totalVertices += m_frameStats.vertices;
+    m_stats.totalStateChanges += m_frameStats.stateChanges;
+    m_frameStats = {};
+}
+
+void NullRenderer::Clear(float r, float g, float b, float a) {
+    // Like SDL2Renderer, anything still pending would be overwritten by the clear
+    m_batchQuads = 0;
+    m_frameStats.clears++;
+    
+    if (m_rasterizer) {
+        m_rasterizer->Clear(r, g, b, a);
+    }
+}
+
+void NullRenderer::DrawRect(float x, float y, float width, float height,
+                            float r, float g, float b, float a) {
+    BatchQuad quad;
+    quad.x = x;
+    quad.y = y;
+    quad.width = width;
+    quad.height = height;
+    quad.r = r;
+    quad.g = g;
+    quad.b = b;
+    quad.a = a;
+    PushQuad(quad);
+}
+
+void NullRenderer::DrawSprite(int textureId, float x, float y,
+                              float width, float height, float rotation) {
+    BatchQuad quad;
+    quad.textureId = textureId;
+    quad.x = x;
+    quad.y = y;
+    quad.width = width;
+    quad.height = height;
+    quad.rotation = rotation;
+    PushQuad(quad);
+}
+
+int NullRenderer::LoadTexture(const char* filePath) {
+    if (!m_rasterizer) {
+        // Nothing is drawn, so the file is never read
+        int textureId = ReserveTextureId();
+        m_textures[textureId] = true;
+        m_frameStats.textureUploads++;
+        return textureId;
+    }
+    
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels;
+    std::string error;
+    if (!DecodeImageFile(filePath, width, height, pixels, error)) {
+        printf("[NullRenderer] ERROR: Failed to load texture %s: %s\n", filePath ? filePath : "(null)", error.c_str());
+        return -1;
+    }
+    
+    int textureId = ReserveTextureId();
+    UploadTexture(textureId, pixels.data(), width, height);
+    return textureId;
+}
+
+void NullRenderer::UnloadTexture(int textureId) {
+    if (m_textures.erase(textureId) == 0) {
+        return;
+    }
+    if (textureId == m_batchTextureId) {
+        FlushBatch();
+        m_batchTextureId = 0;
+    }
+    if (m_rasterizer) {
+        m_rasterizer->RemoveTexture(textureId);
+    }
+}
+
+bool NullRenderer::UploadTexture(int textureId, const uint8_t* rgbaPixels, int width, int height) {
+    if (!rgbaPixels || width <= 0 || height <= 0 || m_textures.count(textureId) != 0) {
+        return false;
+    }
+    m_textures[textureId] = true;
+    m_frameStats.textureUploads++;
+    if (m_rasterizer) {
+        m_rasterizer->SetTexture(textureId, rgbaPixels, width, height);
+    }
+    return true;
+}
+
+void NullRenderer::BeginBatch() {
+    FlushBatch();
+    m_batchTextureId = 0;
+}
+
+void NullRenderer::SwitchTexture(int textureId) {
+    if (textureId != m_batchTextureId) {
+        FlushBatch();
+        m_batchTextureId = textureId;
+        m_frameStats.stateChanges++;
+    }
+}
+
+void NullRenderer::PushQuad(const BatchQuad& quad) {
+    int textureId = quad.textureId > 0 ? quad.textureId : 0;
+    if (textureId != 0 && m_textures.count(textureId) == 0) {
+        return;
+    }
+    
+    SwitchTexture(textureId);
+    m_batchQuads++;
+    
+    if (m_rasterizer) {
+        m_rasterizer->DrawQuad(quad);
+    }
+}
+
+void NullRenderer::FlushBatch() {
+    if (m_batchQuads == 0) {
+        return;
+    }
+    
+    m_frameStats.drawCalls++;
+    m_frameStats.quads += m_batchQuads;
+    m_frameStats.vertices += m_batchQuads * 4;
+    m_batchQuads = 0;
+}
+
+void NullRenderer::DrawRects(const RectInstance* rects, int count) {
+    if (!rects || count <= 0) {
+        return;
+    }
+    
+    SwitchTexture(0);
+    m_batchQuads += static_cast<uint32_t>(count);
+    
+    if (m_rasterizer) {
+        BatchQuad quad;
+        for (int i = 0; i < count; i++) {
+            const RectInstance& rect = rects[i];
+            quad.x = rect.x;
+            quad.y = rect.y;
+            quad.width = rect.width;
+            quad.height = rect.height;
+            quad.r = rect.r;
+            quad.g = rect.g;
+            quad.b = rect.b;
+            quad.a = rect.a;
+            m_rasterizer->DrawQuad(quad);
+        }
+    }
+}
+
+int NullRenderer::LoadAtlas(const AtlasSpriteSource* sprites, int count, int pageSize) {
+    if (!sprites || count <= 0) {
+        return -1;
+    }
+    if (pageSize <= 0) {
+        pageSize = DefaultAtlasPageSize;
+    }
+    
+    // Pack for real so draws switch pages exactly as they would on a GPU backend;
+    // page pixels are only composed when they will be drawn
+    AtlasLayout layout;
+    std::vector<std::vector<uint8_t>> pages;
+    if (m_rasterizer) {
+        std::string error;
+        if (!ComposeAtlas(sprites, count, pageSize, AtlasPadding, layout, pages, error)) {
+            printf("[NullRenderer] ERROR: %s\n", error.c_str());
+            return -1;
+        }
+    } else {
+        std::vector<int> widths(count);
+        std::vector<int> heights(count);
+        for (int i = 0; i < count; i++) {
+            widths[i] = sprites[i].width;
+            heights[i] = sprites[i].height;
+        }
+        if (!PackAtlas(widths.data(), heights.data(), count, pageSize, AtlasPadding, layout)) {
+            return -1;
+        }
+    }
+    
+    std::vector<int> pageTextureIds;
+    for (size_t page = 0; page < layout.pageHeights.size(); page++) {
+        int textureId = ReserveTextureId();
+        if (m_rasterizer) {
+            UploadTexture(textureId, pages[page].data(), pageSize, layout.pageHeights[page]);
+        } else {
+            m_textures[textureId] = true;
+            m_frameStats.textureUploads++;
+        }
+        pageTextureIds.push_back(textureId);
+    }
+    
+    std::vector<AtlasRegion> regions;
+    regions.reserve(count);
+    for (int i = 0; i < count; i++) {
+        const AtlasPlacement& placement = layout.placements[i];
+        const float pageWidth = static_cast<float>(pageSize);
+        const float pageHeight = static_cast<float>(layout.pageHeights[placement.page]);
+        AtlasRegion region;
+        region.textureId = pageTextureIds[placement.page];
+        region.u0 = placement.x / pageWidth;
+        region.v0 = placement.y / pageHeight;
+        region.u1 = (placement.x + sprites[i].width) / pageWidth;
+        region.v1 = (placement.y + sprites[i].height) / pageHeight;
+        regions.push_back(region);
+    }
+    m_atlases.push_back(std::move(regions));
+    return static_cast<int>(m_atlases.size());
+}
+
+void NullRenderer::UnloadAtlas(int atlasId) {
+    if (atlasId <= 0 || atlasId > static_cast<int>(m_atlases.size())) {
+        return;
+    }
+    
+    // Regions share page textures; unloading a page twice is harmless
+    std::vector<AtlasRegion>& regions = m_atlases[atlasId - 1];
+    for (const AtlasRegion& region : regions) {
+        UnloadTexture(region.textureId);
+    }
+    regions.clear();
+}
+
+void NullRenderer::DrawSpriteRegion(int atlasId, int regionId, float x, float y,
+                                    float width, float height, float rotation) {
+    if (atlasId <= 0 || atlasId > static_cast<int>(m_atlases.size())) {
+        return;
+    }
+    const std::vector<AtlasRegion>& regions = m_atlases[atlasId - 1];
+    if (regionId < 0 || regionId >= static_cast<int>(regions.size())) {
+        return;
+    }
+    
+    const AtlasRegion& region = regions[regionId];
+    BatchQuad quad;
+    quad.textureId = region.textureId;
+    quad.x = x;
+    quad.y = y;
+    quad.width = width;
+    quad.height = height;
+    quad.u0 = region.u0;
+    quad.v0 = region.v0;
+    quad.u1 = region.u1;
+    quad.v1 = region.v1;
+    quad.rotation = rotation;
+    PushQuad(quad);
+}
+
+bool NullRenderer::GetStats(RendererStats& outStats) const {
+    outStats = m_stats;
+    return true;
+}
+
+bool NullRenderer::ReadPixels(uint8_t* outRgba, size_t bufferSize) const {
+    if (!m_rasterizer || !outRgba) {
+        return false;
+    }
+    const std::vector<uint8_t>& pixels = m_rasterizer->GetPixels();
+    if (bufferSize < pixels.size()) {
+        return false;
+    }
+    memcpy(outRgba, pixels.data(), pixels.size());
+    return true;
+}
+
+} // namespace Chronicles
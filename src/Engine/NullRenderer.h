@@ -0,0 +1,84 @@
+#pragma once
+
+#include "IRenderer.h"
+#include "SoftwareRasterizer.h"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Null (headless) Renderer Implementation
+// Accepts every call without a window or GPU and counts the work it would have
+// submitted, so the frame loop can be benchmarked on headless build agents.
+// Batching follows SDL2Renderer: consecutive quads with the same texture form one draw call.
+// Optionally draws everything with a SoftwareRasterizer for pixel output without a GPU.
+
+namespace Chronicles {
+
+class NullRenderer : public IRenderer {
+public:
+    /// <param name="rasterize">Draw into a CPU framebuffer (also enabled by CHRONICLES_NULL_FRAMEBUFFER=1)</param>
+    explicit NullRenderer(bool rasterize = false);
+    ~NullRenderer() override = default;
+    
+    // IRenderer implementation
+    bool Initialize(int width, int height, const char* title) override;
+    void Shutdown() override;
+    void BeginFrame() override;
+    void EndFrame() override;
+    void Present() override;
+    void Clear(float r, float g, float b, float a) override;
+    void DrawRect(float x, float y, float width, float height,
+                 float r, float g, float b, float a) override;
+    void DrawSprite(int textureId, float x, float y,
+                   float width, float height, float rotation) override;
+    int LoadTexture(const char* filePath) override;
+    void UnloadTexture(int textureId) override;
+    int ReserveTextureId() override { return m_nextTextureId++; }
+    bool UploadTexture(int textureId, const uint8_t* rgbaPixels, int width, int height) override;
+    
+    void BeginBatch() override;
+    void PushQuad(const BatchQuad& quad) override;
+    void FlushBatch() override;
+    void DrawRects(const RectInstance* rects, int count) override;
+    
+    int LoadAtlas(const AtlasSpriteSource* sprites, int count, int pageSize) override;
+    void UnloadAtlas(int atlasId) override;
+    void DrawSpriteRegion(int atlasId, int regionId, float x, float y,
+                          float width, float height, float rotation) override;
+    
+    bool GetStats(RendererStats& outStats) const override;
+    bool ReadPixels(uint8_t* outRgba, size_t bufferSize) const override;
+    
+    int GetWidth() const override { return m_width; }
+    int GetHeight() const override { return m_height; }
+    bool IsRunning() const override { return m_isRunning; }
+    void SetRunning(bool running) override { m_isRunning = running; }
+
+private:
+    void SwitchTexture(int textureId);
+    
+    struct AtlasRegion {
+        int textureId;
+        float u0, v0, u1, v1;
+    };
+    
+    int m_width;
+    int m_height;
+    bool m_isRunning;
+    
+    // Texture IDs; pixel data is only kept (by the rasterizer) when rasterizing
+    std::unordered_map<int, bool> m_textures;
+    int m_nextTextureId;
+    std::vector<std::vector<AtlasRegion>> m_atlases;  // Index = atlasId - 1; unloaded atlases are left empty
+    
+    int m_batchTextureId;
+    uint32_t m_batchQuads;
+    
+    RendererStats m_stats;       // Totals plus the last presented frame
+    RendererStats m_frameStats;  // Frame in progress
+    
+    bool m_rasterize;
+    std::unique_ptr<SoftwareRasterizer> m_rasterizer;  // Null unless rasterizing
+};
+
+} // namespace Chronicles
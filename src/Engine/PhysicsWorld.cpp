@@ -0,0 +1,338 @@
+#include "PhysicsWorld.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Chronicles {
+
+namespace {
+    // Bodies covering more cells than this are tested against everything instead
+    constexpr int64_t MaxCellsPerBody = 64;
+    
+    // Each pass lets blocked bodies fall back one stage; three stages per body at most,
+    // so this is only reached by very long chains of bodies blocking each other
+    constexpr int MaxResolvePasses = 16;
+    
+    constexpr int64_t MaxCellCoordinate = INT32_MAX;
+    
+    uint64_t CellKey(int64_t cellX, int64_t cellY) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY);
+    }
+    
+    uint32_t CellHash(uint64_t cell, uint32_t bits) {
+        return static_cast<uint32_t>((cell * 0x9E3779B97F4A7C15ull) >> (64 - bits));
+    }
+    
+    uint64_t PairKey(uint32_t a, uint32_t b) {
+        return a < b ? (static_cast<uint64_t>(a) << 32) | b : (static_cast<uint64_t>(b) << 32) | a;
+    }
+}
+
+bool PhysicsWorld::CreateBody(int entityId, float x, float y, float width, float height,
+                              uint32_t flags, uint32_t layer, uint32_t collidesWith) {
+    if (!(width >= 0.0f) || !(height >= 0.0f)) {
+        return false;
+    }
+    
+    auto it = m_indices.find(entityId);
+    if (it == m_indices.end()) {
+        it = m_indices.emplace(entityId, static_cast<uint32_t>(m_bodies.size())).first;
+        m_bodies.push_back(Body{ entityId, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0, 0, 0 });
+    }
+    Body& body = m_bodies[it->second];
+    body.x = x;
+    body.y = y;
+    body.halfWidth = width * 0.5f;
+    body.halfHeight = height * 0.5f;
+    body.flags = flags;
+    body.layer = layer;
+    body.collidesWith = collidesWith;
+    if (flags & Static) {
+        body.vx = 0.0f;
+        body.vy = 0.0f;
+    }
+    return true;
+}
+
+bool PhysicsWorld::DestroyBody(int entityId) {
+    auto it = m_indices.find(entityId);
+    if (it == m_indices.end()) {
+        return false;
+    }
+    const uint32_t index = it->second;
+    m_indices.erase(it);
+    
+    // Swap-remove keeps the array dense for the broadphase
+    if (index + 1 != m_bodies.size()) {
+        m_bodies[index] = m_bodies.back();
+        m_indices[m_bodies[index].entityId] = index;
+    }
+    m_bodies.pop_back();
+    return true;
+}
+
+void PhysicsWorld::Clear() {
+    m_bodies.clear();
+    m_indices.clear();
+    m_contacts.clear();
+}
+
+PhysicsWorld::Body* PhysicsWorld::FindBody(int entityId) {
+    auto it = m_indices.find(entityId);
+    return it != m_indices.end() ? &m_bodies[it->second] : nullptr;
+}
+
+void PhysicsWorld::SetCellSize(float size) {
+    if (size > 0.0f && std::isfinite(size)) {
+        m_cellSize = size;
+    }
+}
+
+int64_t PhysicsWorld::CellCoordinate(float value) const {
+    const double cell = std::floor(static_cast<double>(value) / m_cellSize);
+    // Also catches NaN, which compares false
+    if (!(cell > -static_cast<double>(MaxCellCoordinate))) return -MaxCellCoordinate;
+    if (cell > static_cast<double>(MaxCellCoordinate)) return MaxCellCoordinate;
+    return static_cast<int64_t>(cell);
+}
+
+bool PhysicsWorld::Overlaps(uint32_t a, uint32_t b) const {
+    const Body& first = m_bodies[a];
+    const Body& second = m_bodies[b];
+    return std::fabs(first.x - second.x) < first.halfWidth + second.halfWidth &&
+           std::fabs(first.y - second.y) < first.halfHeight + second.halfHeight;
+}
+
+bool PhysicsWorld::Blocks(uint32_t mover, uint32_t other) const {
+    return m_motion[mover].stage < 3 &&
+           ((m_bodies[mover].flags | m_bodies[other].flags) & Sensor) == 0;
+}
+
+void PhysicsWorld::HandlePair(uint32_t a, uint32_t b) {
+    const Body& first = m_bodies[a];
+    const Body& second = m_bodies[b];
+    if (first.flags & second.flags & Static) {
+        return;
+    }
+    const bool firstHits = (first.collidesWith & second.layer) != 0;
+    const bool secondHits = (second.collidesWith & first.layer) != 0;
+    if (!firstHits && !secondHits) {
+        return;
+    }
+    
+    m_pairs.push_back(PairKey(a, b));
+    if (firstHits && Blocks(a, b)) {
+        m_motion[a].blocked = true;
+    }
+    if (secondHits && Blocks(b, a)) {
+        m_motion[b].blocked = true;
+    }
+}
+
+bool PhysicsWorld::IsCornerCell(uint32_t a, uint32_t b, uint64_t cell) const {
+    // Bodies sharing several cells meet in each; only the cell holding the corner of
+    // their overlap reports them
+    const Body& first = m_bodies[a];
+    const Body& second = m_bodies[b];
+    const float overlapX = std::max(first.x - first.halfWidth, second.x - second.halfWidth);
+    const float overlapY = std::max(first.y - first.halfHeight, second.y - second.halfHeight);
+    return CellKey(CellCoordinate(overlapX), CellCoordinate(overlapY)) == cell;
+}
+
+void PhysicsWorld::BuildGrid() {
+    const uint32_t count = static_cast<uint32_t>(m_bodies.size());
+    m_cells.clear();
+    m_large.clear();
+    
+    // Bodies are binned by the box swept from their old to their new position, which
+    // holds every position they can fall back to, so one grid serves all passes
+    for (uint32_t i = 0; i < count; i++) {
+        const Body& body = m_bodies[i];
+        Motion& motion = m_motion[i];
+        const int64_t minX = CellCoordinate(std::min(motion.fromX, motion.toX) - body.halfWidth);
+        const int64_t maxX = CellCoordinate(std::max(motion.fromX, motion.toX) + body.halfWidth);
+        const int64_t minY = CellCoordinate(std::min(motion.fromY, motion.toY) - body.halfHeight);
+        const int64_t maxY = CellCoordinate(std::max(motion.fromY, motion.toY) + body.halfHeight);
+        motion.large = (maxX - minX + 1) * (maxY - minY + 1) > MaxCellsPerBody;
+        if (motion.large) {
+            m_large.push_back(i);
+            continue;
+        }
+        for (int64_t cellY = minY; cellY <= maxY; cellY++) {
+            for (int64_t cellX = minX; cellX <= maxX; cellX++) {
+                m_cells.push_back({ CellKey(cellX, cellY), i, 0 });
+            }
+        }
+    }
+    
+    // Counting sort into hash buckets: linear time, and a cell's bodies end up adjacent
+    // (sharing the bucket only with the rare cell whose hash collides)
+    m_bucketBits = 4;
+    while ((size_t(1) << m_bucketBits) < m_cells.size() * 2) {
+        m_bucketBits++;
+    }
+    const size_t bucketCount = size_t(1) << m_bucketBits;
+    m_bucketStart.assign(bucketCount + 1, 0);
+    for (CellEntry& entry : m_cells) {
+        entry.bucket = CellHash(entry.cell, m_bucketBits);
+        m_bucketStart[entry.bucket + 1]++;
+    }
+    for (size_t bucket = 0; bucket < bucketCount; bucket++) {
+        m_bucketStart[bucket + 1] += m_bucketStart[bucket];
+    }
+    m_bucketed.resize(m_cells.size());
+    m_bucketFill.assign(m_bucketStart.begin(), m_bucketStart.end() - 1);
+    for (const CellEntry& entry : m_cells) {
+        m_bucketed[m_bucketFill[entry.bucket]++] = entry;
+    }
+}
+
+void PhysicsWorld::FindAllPairs() {
+    const size_t bucketCount = m_bucketStart.size() - 1;
+    for (size_t bucket = 0; bucket < bucketCount; bucket++) {
+        const uint32_t end = m_bucketStart[bucket + 1];
+        for (uint32_t i = m_bucketStart[bucket]; i < end; i++) {
+            const CellEntry& first = m_bucketed[i];
+            for (uint32_t j = i + 1; j < end; j++) {
+                const CellEntry& second = m_bucketed[j];
+                if (first.cell == second.cell && Overlaps(first.body, second.body) &&
+                    IsCornerCell(first.body, second.body, first.cell)) {
+                    HandlePair(first.body, second.body);
+                }
+            }
+        }
+    }
+    
+    // Oversized bodies (walls, floors) are few; test them against everything
+    const uint32_t count = static_cast<uint32_t>(m_bodies.size());
+    for (uint32_t a : m_large) {
+        for (uint32_t b = 0; b < count; b++) {
+            // Two large bodies meet twice in this loop; keep one
+            if (b != a && !(m_motion[b].large && b < a) && Overlaps(a, b)) {
+                HandlePair(a, b);
+            }
+        }
+    }
+}
+
+void PhysicsWorld::FindPairsOf(uint32_t a) {
+    // A pair of two bodies that both moved back is found by the lower index
+    const auto seenFromOther = [this, a](uint32_t b) {
+        return m_motion[b].dirty && b < a;
+    };
+    
+    if (m_motion[a].large) {
+        const uint32_t count = static_cast<uint32_t>(m_bodies.size());
+        for (uint32_t b = 0; b < count; b++) {
+            if (b != a && !(m_motion[b].large && seenFromOther(b)) && Overlaps(a, b)) {
+                HandlePair(a, b);
+            }
+        }
+        return;
+    }
+    
+    const Body& body = m_bodies[a];
+    const int64_t minX = CellCoordinate(body.x - body.halfWidth);
+    const int64_t maxX = CellCoordinate(body.x + body.halfWidth);
+    const int64_t minY = CellCoordinate(body.y - body.halfHeight);
+    const int64_t maxY = CellCoordinate(body.y + body.halfHeight);
+    for (int64_t cellY = minY; cellY <= maxY; cellY++) {
+        for (int64_t cellX = minX; cellX <= maxX; cellX++) {
+            const uint64_t cell = CellKey(cellX, cellY);
+            const uint32_t bucket = CellHash(cell, m_bucketBits);
+            for (uint32_t i = m_bucketStart[bucket]; i < m_bucketStart[bucket + 1]; i++) {
+                const CellEntry& entry = m_bucketed[i];
+                const uint32_t b = entry.body;
+                if (entry.cell == cell && b != a && !seenFromOther(b) && Overlaps(a, b) && IsCornerCell(a, b, cell)) {
+                    HandlePair(a, b);
+                }
+            }
+        }
+    }
+    // Large bodies that moved back test themselves against everything
+    for (uint32_t b : m_large) {
+        if (!m_motion[b].dirty && Overlaps(a, b)) {
+            HandlePair(a, b);
+        }
+    }
+}
+
+void PhysicsWorld::Step(float deltaTime) {
+    m_pairs.clear();
+    m_contacts.clear();
+    const size_t count = m_bodies.size();
+    m_motion.resize(count);
+    
+    // Integrate; bodies that do not move have nothing to fall back to
+    for (size_t i = 0; i < count; i++) {
+        Body& body = m_bodies[i];
+        Motion& motion = m_motion[i];
+        motion.fromX = body.x;
+        motion.fromY = body.y;
+        if (!(body.flags & Static)) {
+            if (!(body.flags & NoGravity)) {
+                body.vx += m_gravityX * deltaTime;
+                body.vy += m_gravityY * deltaTime;
+            }
+            body.x += body.vx * deltaTime;
+            body.y += body.vy * deltaTime;
+        }
+        motion.toX = body.x;
+        motion.toY = body.y;
+        motion.stage = (motion.toX != motion.fromX || motion.toY != motion.fromY) ? 0 : 3;
+        motion.blocked = false;
+        motion.dirty = false;
+    }
+    
+    BuildGrid();
+    FindAllPairs();
+    
+    // Blocked bodies fall back a stage, then only pairs involving them are retested
+    for (int pass = 0; pass <= MaxResolvePasses; pass++) {
+        for (uint32_t i : m_fallen) {
+            m_motion[i].dirty = false;
+        }
+        m_fallen.clear();
+        for (uint32_t i = 0; i < static_cast<uint32_t>(count); i++) {
+            Motion& motion = m_motion[i];
+            if (!motion.blocked) {
+                continue;
+            }
+            motion.blocked = false;
+            motion.dirty = true;
+            Body& body = m_bodies[i];
+            motion.stage = pass == MaxResolvePasses || (body.flags & NoSlide) ? 3 : motion.stage + 1;
+            body.x = motion.stage == 1 ? motion.toX : motion.fromX;
+            body.y = motion.stage == 2 ? motion.toY : motion.fromY;
+            m_fallen.push_back(i);
+        }
+        if (m_fallen.empty() || pass == MaxResolvePasses) {
+            break;
+        }
+        for (uint32_t i : m_fallen) {
+            FindPairsOf(i);
+        }
+    }
+    
+    // Blocked axes lose their velocity, so gravity does not build up against the floor
+    for (size_t i = 0; i < count; i++) {
+        const Motion& motion = m_motion[i];
+        if (motion.stage == 0 || (motion.toX == motion.fromX && motion.toY == motion.fromY)) {
+            continue;
+        }
+        Body& body = m_bodies[i];
+        if (motion.stage != 1) body.vx = 0.0f;
+        if (motion.stage != 2) body.vy = 0.0f;
+    }
+    
+    std::sort(m_pairs.begin(), m_pairs.end());
+    m_pairs.erase(std::unique(m_pairs.begin(), m_pairs.end()), m_pairs.end());
+    m_contacts.reserve(m_pairs.size());
+    for (uint64_t pair : m_pairs) {
+        const int first = m_bodies[static_cast<uint32_t>(pair >> 32)].entityId;
+        const int second = m_bodies[static_cast<uint32_t>(pair)].entityId;
+        m_contacts.emplace_back(std::min(first, second), std::max(first, second));
+    }
+    std::sort(m_contacts.begin(), m_contacts.end());
+}
+
+} // namespace Chronicles
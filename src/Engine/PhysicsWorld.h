@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Chronicles of a Drifter - Physics World
+// Axis-aligned box bodies with a uniform-grid broadphase, so a step costs O(n log n)
+// rather than testing every pair
+
+namespace Chronicles {
+
+/// <summary>
+/// Bodies keyed by entity id. Step() integrates gravity and velocity, then resolves
+/// blocked movement the way CollisionSystem resolves terrain: a body that would overlap
+/// something it collides with keeps only its X move, else only its Y move, else stays
+/// where it was, and loses its velocity along the blocked axes. NoSlide bodies stay where
+/// they were as soon as they are blocked, as CollisionSystem does for entities.
+/// Every overlapping pair found along the way is reported once in GetContacts().
+/// </summary>
+class PhysicsWorld {
+public:
+    // Body flags; same values as PHYSICS_BODY_* in ChroniclesEngine.h
+    static constexpr uint32_t Static = 1;      // Never moves
+    static constexpr uint32_t Sensor = 2;      // Reports contacts; never blocks or is blocked
+    static constexpr uint32_t NoGravity = 4;
+    static constexpr uint32_t NoSlide = 8;     // When blocked, skips straight to staying put
+    
+    struct Body {
+        int entityId;
+        float x, y;                    // Center
+        float halfWidth, halfHeight;
+        float vx, vy;
+        uint32_t flags;
+        uint32_t layer;                // Layers this body is on
+        uint32_t collidesWith;         // Layers that block it
+    };
+    
+    /// <summary>
+    /// Add a body, or reshape and move an existing one (keeping its velocity).
+    /// Returns false for a negative size.
+    /// </summary>
+    bool CreateBody(int entityId, float x, float y, float width, float height,
+                    uint32_t flags, uint32_t layer, uint32_t collidesWith);
+    bool DestroyBody(int entityId);
+    void Clear();
+    
+    /// <summary>
+    /// Pointer is valid until the next CreateBody/DestroyBody/Clear
+    /// </summary>
+    Body* FindBody(int entityId);
+    size_t GetBodyCount() const { return m_bodies.size(); }
+    
+    void SetGravity(float x, float y) { m_gravityX = x; m_gravityY = y; }
+    
+    /// <summary>
+    /// Broadphase cell edge in world units; about the size of a typical body works best
+    /// </summary>
+    void SetCellSize(float size);
+    
+    void Step(float deltaTime);
+    
+    /// <summary>
+    /// Pairs (smaller entity id first) that touched during the last Step, in order
+    /// </summary>
+    const std::vector<std::pair<int, int>>& GetContacts() const { return m_contacts; }
+
+private:
+    struct CellEntry {
+        uint64_t cell;
+        uint32_t body;
+        uint32_t bucket;
+    };
+    
+    void BuildGrid();
+    void FindAllPairs();
+    void FindPairsOf(uint32_t body);
+    void HandlePair(uint32_t a, uint32_t b);
+    bool IsCornerCell(uint32_t a, uint32_t b, uint64_t cell) const;
+    bool Blocks(uint32_t mover, uint32_t other) const;
+    bool Overlaps(uint32_t a, uint32_t b) const;
+    int64_t CellCoordinate(float value) const;
+    
+    std::vector<Body> m_bodies;
+    std::unordered_map<int, uint32_t> m_indices;   // Entity id -> index in m_bodies
+    float m_gravityX = 0.0f;
+    float m_gravityY = 0.0f;
+    float m_cellSize = 64.0f;
+    
+    // Per-step scratch, kept to avoid reallocating every frame
+    struct Motion {
+        float fromX, fromY;            // Position before the step
+        float toX, toY;                // Integrated position
+        uint8_t stage;                 // 0 full move, 1 X only, 2 Y only, 3 none
+        bool blocked;                  // Must fall back a stage after this pass
+        bool dirty;                    // Fell back in the last pass
+        bool large;                    // In m_large rather than the grid
+    };
+    std::vector<Motion> m_motion;
+    std::vector<CellEntry> m_cells;                // One per cell a body's swept box covers
+    std::vector<CellEntry> m_bucketed;             // m_cells grouped by cell hash
+    std::vector<uint32_t> m_bucketStart;           // Bucket -> first index in m_bucketed
+    std::vector<uint32_t> m_bucketFill;
+    uint32_t m_bucketBits = 4;
+    std::vector<uint32_t> m_large;                 // Bodies spanning too many cells to grid
+    std::vector<uint32_t> m_fallen;                // Bodies that fell back in the last pass
+    std::vector<uint64_t> m_pairs;                 // Touching index pairs, low index first
+    std::vector<std::pair<int, int>> m_contacts;
+};
+
+} // namespace Chronicles
@@ -0,0 +1,272 @@
+#include "Profiler.h"
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Chronicles {
+namespace Profiler {
+
+std::atomic<bool> g_enabled{ false };
+
+namespace {
+    const uint32_t ChunkScopes = 4096;
+    const uint32_t MaxChunksPerThread = 64;  // 256K scopes per thread per capture
+    const int MaxDepth = 64;
+    const int MaxScopeNames = 4096;
+    
+    struct ScopeRecord {
+        const char* name;
+        uint64_t startNs;
+        uint64_t endNs;
+    };
+    
+    struct Chunk {
+        ScopeRecord records[ChunkScopes];
+    };
+    
+    // Written only by its owning thread. Records below `published` are immutable, so the
+    // dumper can read them while the owner keeps appending; `mutex` is only taken for the
+    // rare structural changes (new chunk, new capture) and by the dumper.
+    struct ThreadBuffer {
+        uint32_t threadId = 0;
+        std::mutex mutex;
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        std::atomic<uint64_t> published{ 0 };
+        std::atomic<uint64_t> dropped{ 0 };
+        uint64_t epoch = 0;  // Capture the contents belong to (guarded by mutex)
+        
+        // Open scopes (owner only)
+        const char* openNames[MaxDepth];
+        uint64_t openStarts[MaxDepth];
+        int depth = 0;
+    };
+    
+    std::atomic<uint64_t> g_epoch{ 0 };
+    
+    // Buffers outlive their threads so a dump still sees work from finished threads
+    std::mutex g_registryMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> g_threads;
+    thread_local ThreadBuffer* t_buffer = nullptr;
+    
+    std::mutex g_nameMutex;
+    std::deque<std::string> g_nameStorage;  // Stable addresses
+    std::unordered_map<std::string, int> g_nameIds;
+    std::atomic<const char*> g_names[MaxScopeNames];
+    
+    const std::chrono::steady_clock::time_point g_origin = std::chrono::steady_clock::now();
+    
+    uint64_t NowNs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - g_origin).count());
+    }
+    
+    ThreadBuffer& GetThreadBuffer() {
+        if (!t_buffer) {
+            std::lock_guard<std::mutex> lock(g_registryMutex);
+            g_threads.push_back(std::make_unique<ThreadBuffer>());
+            t_buffer = g_threads.back().get();
+            t_buffer->threadId = static_cast<uint32_t>(g_threads.size());
+        }
+        
+        // First scope since a new capture started: drop the old contents, keep the chunks
+        ThreadBuffer& buffer = *t_buffer;
+        const uint64_t epoch = g_epoch.load(std::memory_order_acquire);
+        if (buffer.epoch != epoch) {
+            std::lock_guard<std::mutex> lock(buffer.mutex);
+            buffer.epoch = epoch;
+            buffer.published.store(0, std::memory_order_relaxed);
+            buffer.dropped.store(0, std::memory_order_relaxed);
+            buffer.depth = 0;
+        }
+        return buffer;
+    }
+    
+    void AppendJsonString(std::string& out, const char* text) {
+        out += '"';
+        for (const char* c = text; *c; c++) {
+            switch (*c) {
+                case '"': out += "\\\""; break;
+                case '\\': out += "\\\\"; break;
+                case '\n': out += "\\n"; break;
+                case '\t': out += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(*c) < 0x20) {
+                        char escaped[8];
+                        snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(*c));
+                        out += escaped;
+                    } else {
+                        out += *c;
+                    }
+                    break;
+            }
+        }
+        out += '"';
+    }
+}
+
+void BeginScope(const char* name) {
+    ThreadBuffer& buffer = GetThreadBuffer();
+    if (buffer.depth < MaxDepth) {
+        buffer.openNames[buffer.depth] = name;
+        buffer.openStarts[buffer.depth] = NowNs();
+    }
+    buffer.depth++;
+}
+
+void EndScope() {
+    const uint64_t endNs = NowNs();
+    ThreadBuffer& buffer = GetThreadBuffer();
+    if (buffer.depth == 0) {
+        return;  // Opened before the current capture started
+    }
+    buffer.depth--;
+    if (buffer.depth >= MaxDepth) {
+        buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    
+    const uint64_t index = buffer.published.load(std::memory_order_relaxed);
+    const size_t chunk = static_cast<size_t>(index / ChunkScopes);
+    if (chunk >= buffer.chunks.size()) {
+        if (chunk >= MaxChunksPerThread) {
+            buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        buffer.chunks.push_back(std::make_unique<Chunk>());
+    }
+    
+    ScopeRecord& record = buffer.chunks[chunk]->records[index % ChunkScopes];
+    record.name = buffer.openNames[buffer.depth];
+    record.startNs = buffer.openStarts[buffer.depth];
+    record.endNs = endNs;
+    buffer.published.store(index + 1, std::memory_order_release);
+}
+
+} // namespace Profiler
+} // namespace Chronicles
+
+// ===== C API Implementation =====
+
+using namespace Chronicles::Profiler;
+
+extern "C" ENGINE_API void Profiler_SetEnabled(bool enabled) {
+    if (enabled) {
+        // Threads discard their previous capture lazily, on their next scope
+        g_epoch.fetch_add(1, std::memory_order_release);
+    }
+    g_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+extern "C" ENGINE_API bool Profiler_IsEnabled() {
+    return IsEnabled();
+}
+
+extern "C" ENGINE_API int Profiler_RegisterScope(const char* name) {
+    if (!name) {
+        return -1;
+    }
+    
+    std::lock_guard<std::mutex> lock(g_nameMutex);
+    auto it = g_nameIds.find(name);
+    if (it != g_nameIds.end()) {
+        return it->second;
+    }
+    
+    const int id = static_cast<int>(g_nameStorage.size());
+    if (id >= MaxScopeNames) {
+        return -1;
+    }
+    g_nameStorage.emplace_back(name);
+    g_nameIds.emplace(name, id);
+    g_names[id].store(g_nameStorage.back().c_str(), std::memory_order_release);
+    return id;
+}
+
+extern "C" ENGINE_API void Profiler_BeginScope(int scopeId) {
+    if (!IsEnabled()) return;
+    
+    if (scopeId < 0 || scopeId >= MaxScopeNames) {
+        return;
+    }
+    const char* name = g_names[scopeId].load(std::memory_order_acquire);
+    BeginScope(name ? name : "(unregistered)");
+}
+
+extern "C" ENGINE_API void Profiler_EndScope() {
+    if (!IsEnabled()) return;
+    
+    EndScope();
+}
+
+extern "C" ENGINE_API int Profiler_DumpChromeTrace(const char* filePath) {
+    if (!filePath) {
+        return -1;
+    }
+    
+    const uint64_t epoch = g_epoch.load(std::memory_order_acquire);
+    std::string json = "{\"traceEvents\":[\n";
+    int written = 0;
+    char numbers[128];
+    
+    {
+        std::lock_guard<std::mutex> registryLock(g_registryMutex);
+        for (const auto& buffer : g_threads) {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            if (buffer->epoch != epoch) {
+                continue;
+            }
+            
+            const uint64_t count = buffer->published.load(std::memory_order_acquire);
+            for (uint64_t i = 0; i < count; i++) {
+                const ScopeRecord& record = buffer->chunks[i / ChunkScopes]->records[i % ChunkScopes];
+                if (written > 0) {
+                    json += ",\n";
+                }
+                json += "{\"name\":";
+                AppendJsonString(json, record.name);
+                // Complete ("X") events; timestamps are microseconds
+                snprintf(numbers, sizeof(numbers), ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                         record.startNs / 1000.0, (record.endNs - record.startNs) / 1000.0, buffer->threadId);
+                json += numbers;
+                written++;
+            }
+        }
+    }
+    
+    json += "\n],\"displayTimeUnit\":\"ms\"}\n";
+    
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        printf("[Profiler] ERROR: Cannot open %s for writing\n", filePath);
+        return -1;
+    }
+    file.write(json.data(), static_cast<std::streamsize>(json.size()));
+    if (!file) {
+        printf("[Profiler] ERROR: Failed to write %s\n", filePath);
+        return -1;
+    }
+    
+    printf("[Profiler] Wrote %d scopes to %s\n", written, filePath);
+    return written;
+}
+
+extern "C" ENGINE_API uint64_t Profiler_GetDroppedScopeCount() {
+    const uint64_t epoch = g_epoch.load(std::memory_order_acquire);
+    uint64_t dropped = 0;
+    
+    std::lock_guard<std::mutex> registryLock(g_registryMutex);
+    for (const auto& buffer : g_threads) {
+        std::lock_guard<std::mutex> lock(buffer->mutex);
+        if (buffer->epoch == epoch) {
+            dropped += buffer->dropped.load(std::memory_order_relaxed);
+        }
+    }
+    return dropped;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "EngineExport.h"
+#include <atomic>
+#include <cstdint>
+
+// Chronicles of a Drifter - Frame Profiler
+// Hierarchical CPU scope timers recorded into per-thread buffers and exported as
+// chrome://tracing JSON. While capture is off, a scope costs one relaxed load and branch.
+
+namespace Chronicles {
+namespace Profiler {
+
+extern std::atomic<bool> g_enabled;
+
+inline bool IsEnabled() {
+    return g_enabled.load(std::memory_order_relaxed);
+}
+
+/// <summary>
+/// Open a scope on the calling thread. name must outlive the capture
+/// (string literals, or names from RegisterScopeName).
+/// </summary>
+void BeginScope(const char* name);
+
+/// <summary>
+/// Close the innermost open scope on the calling thread and record it
+/// </summary>
+void EndScope();
+
+/// <summary>
+/// RAII scope marker; use through CHRONICLES_PROFILE_SCOPE
+/// </summary>
+class ScopeTimer {
+public:
+    explicit ScopeTimer(const char* name)
+        : m_active(IsEnabled())
+    {
+        if (m_active) BeginScope(name);
+    }
+    ~ScopeTimer() {
+        if (m_active) EndScope();
+    }
+    
+    ScopeTimer(const ScopeTimer&) = delete;
+    ScopeTimer& operator=(const ScopeTimer&) = delete;
+
+private:
+    bool m_active;
+};
+
+} // namespace Profiler
+} // namespace Chronicles
+
+#define CHRONICLES_PROFILE_CONCAT_INNER(a, b) a##b
+#define CHRONICLES_PROFILE_CONCAT(a, b) CHRONICLES_PROFILE_CONCAT_INNER(a, b)
+
+// Time the rest of the enclosing block under a string-literal name
+#define CHRONICLES_PROFILE_SCOPE(name) \
+    ::Chronicles::Profiler::ScopeTimer CHRONICLES_PROFILE_CONCAT(profileScope_, __LINE__)(name)
+
+// C API for cross-language access
+extern "C" {
+    /// <summary>
+    /// Start or stop capturing. Starting discards everything captured before.
+    /// </summary>
+    ENGINE_API void Profiler_SetEnabled(bool enabled);
+    
+    /// <summary>
+    /// Check whether a capture is running
+    /// </summary>
+    ENGINE_API bool Profiler_IsEnabled();
+    
+    /// <summary>
+    /// Intern a scope name for Profiler_BeginScope. Registering the same name again
+    /// returns the same ID.
+    /// </summary>
+    /// <returns>Scope ID (&gt;= 0), or -1 if the name table is full</returns>
+    ENGINE_API int Profiler_RegisterScope(const char* name);
+    
+    /// <summary>
+    /// Open a scope on the calling thread (no-op while capture is off)
+    /// </summary>
+    ENGINE_API void Profiler_BeginScope(int scopeId);
+    
+    /// <summary>
+    /// Close the innermost scope opened on the calling thread
+    /// </summary>
+    ENGINE_API void Profiler_EndScope();
+    
+    /// <summary>
+    /// Write the current capture as chrome://tracing (Trace Event Format) JSON.
+    /// Safe to call while other threads are still recording.
+    /// </summary>
+    /// <returns>Number of scopes written, or -1 if the file could not be written</returns>
+    ENGINE_API int Profiler_DumpChromeTrace(const char* filePath);
+    
+    /// <summary>
+    /// Scopes discarded because a thread's buffer was full during the current capture
+    /// </summary>
+    ENGINE_API uint64_t Profiler_GetDroppedScopeCount();
+}
@@ -2,10 +2,21 @@
 
 #include <string>
 #include <vector>
-#include <map>
 #include <memory>
 #include <functional>
 #include <any>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
 
 // Chronicles of a Drifter - Reflection System
 // Provides runtime type information for editor integration
@@ -31,15 +42,111 @@ enum class PropertyType {
     Custom
 };
 
+/// <summary>
+/// Size in bytes of a field of the given type, or 0 for String and Custom
+/// (whose layout is not fixed). Vector2/Vector3 are 2/3 floats; Color is 4 floats (RGBA).
+/// </summary>
+constexpr size_t GetPropertySize(PropertyType type) {
+    switch (type) {
+        case PropertyType::Bool: return sizeof(bool);
+        case PropertyType::Int: return sizeof(int);
+        case PropertyType::Float: return sizeof(float);
+        case PropertyType::Double: return sizeof(double);
+        case PropertyType::Vector2: return 2 * sizeof(float);
+        case PropertyType::Vector3: return 3 * sizeof(float);
+        case PropertyType::Color: return 4 * sizeof(float);
+        default: return 0;
+    }
+}
+
+// ===== Name IDs =====
+// Type and field names are interned as 32-bit FNV-1a hashes; lookups probe by ID and
+// only compare the string once to rule out a collision.
+using NameId = uint32_t;
+
+constexpr NameId HashName(const char* name) {
+    NameId hash = 2166136261u;
+    for (; *name; name++) {
+        hash ^= static_cast<uint8_t>(*name);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+inline NameId HashName(const std::string& name) {
+    return HashName(name.c_str());
+}
+
+struct NameSlot {
+    NameId id = 0;
+    int index = -1;  // -1 = empty
+};
+
+// Linear probe in a power-of-two slot array; -1 if the ID is absent
+constexpr int FindNameSlot(const NameSlot* slots, size_t slotCount, NameId id) {
+    if (slotCount == 0) return -1;
+    const size_t mask = slotCount - 1;
+    for (size_t i = id & mask; ; i = (i + 1) & mask) {
+        if (slots[i].index < 0) return -1;
+        if (slots[i].id == id) return slots[i].index;
+    }
+}
+
+// Open-addressing (linear probing) map from NameId to an index. IDs are unique;
+// registration rejects names whose hash is already taken.
+class NameTable {
+public:
+    int Find(NameId id) const {
+        return FindNameSlot(m_slots.data(), m_slots.size(), id);
+    }
+    
+    void Insert(NameId id, int index) {
+        // Keep the load factor at or below 1/2 so probe runs stay short
+        if ((m_count + 1) * 2 > m_slots.size()) {
+            Grow();
+        }
+        Place(id, index);
+        m_count++;
+    }
+    
+    const NameSlot* GetSlots() const { return m_slots.data(); }
+    size_t GetSlotCount() const { return m_slots.size(); }
+
+private:
+    void Place(NameId id, int index) {
+        const size_t mask = m_slots.size() - 1;
+        size_t i = id & mask;
+        while (m_slots[i].index >= 0) {
+            i = (i + 1) & mask;
+        }
+        m_slots[i].id = id;
+        m_slots[i].index = index;
+    }
+    
+    void Grow() {
+        std::vector<NameSlot> old = std::move(m_slots);
+        m_slots.assign(old.empty() ? 16 : old.size() * 2, NameSlot{});
+        for (const NameSlot& slot : old) {
+            if (slot.index >= 0) Place(slot.id, slot.index);
+        }
+    }
+    
+    std::vector<NameSlot> m_slots;
+    size_t m_count = 0;
+};
+
 // ===== Field Info =====
+// Literal type so compile-time descriptors (below) can build arrays of these in static storage
 class FieldInfo {
 public:
-    FieldInfo(const std::string& name, PropertyType type, size_t offset)
-        : m_name(name), m_type(type), m_offset(offset) {}
+    constexpr FieldInfo(const char* name, PropertyType type, size_t offset, size_t size)
+        : m_name(name), m_id(HashName(name)), m_type(type), m_offset(offset), m_size(size) {}
     
-    const std::string& GetName() const { return m_name; }
-    PropertyType GetType() const { return m_type; }
-    size_t GetOffset() const { return m_offset; }
+    constexpr const char* GetName() const { return m_name; }
+    constexpr NameId GetId() const { return m_id; }
+    constexpr PropertyType GetType() const { return m_type; }
+    constexpr size_t GetOffset() const { return m_offset; }
+    constexpr size_t GetSize() const { return m_size; }
     
     // Generic getter/setter using void* to instance
     template<typename T>
@@ -53,39 +160,109 @@ public:
     }
     
 private:
-    std::string m_name;
+    const char* m_name;  // Static storage, or owned by the TypeInfo
+    NameId m_id;
     PropertyType m_type;
     size_t m_offset;
+    size_t m_size;
 };
 
 // ===== Type Info =====
+// Either views field and lookup tables in static storage (compile-time descriptors,
+// no allocation) or owns them (types built at runtime through AddField).
 class TypeInfo {
 public:
     TypeInfo(const std::string& name, size_t size)
-        : m_name(name), m_size(size) {}
+        : m_storage(std::make_unique<Storage>())
+    {
+        m_storage->name = name;
+        m_name = m_storage->name.c_str();
+        m_id = HashName(m_name);
+        m_size = size;
+    }
+    
+    constexpr TypeInfo(const char* name, size_t size, const FieldInfo* fields, size_t fieldCount,
+                       const NameSlot* slots, size_t slotCount)
+        : m_name(name), m_id(HashName(name)), m_size(size)
+        , m_fields(fields), m_fieldCount(fieldCount), m_slots(slots), m_slotCount(slotCount) {}
     
-    const std::string& GetName() const { return m_name; }
+    const char* GetName() const { return m_name; }
+    NameId GetId() const { return m_id; }
     size_t GetSize() const { return m_size; }
     
-    void AddField(const std::string& name, PropertyType type, size_t offset) {
-        m_fields.emplace_back(name, type, offset);
+    bool AddField(const std::string& name, PropertyType type, size_t offset) {
+        return AddField(name, type, offset, GetPropertySize(type));
     }
     
-    const std::vector<FieldInfo>& GetFields() const { return m_fields; }
-    
-    const FieldInfo* GetField(const std::string& name) const {
-        for (const auto& field : m_fields) {
-            if (field.GetName() == name) {
-                return &field;
-            }
+    bool AddField(const std::string& name, PropertyType type, size_t offset, size_t size) {
+        if (!m_storage) {
+            printf("[Reflection] ERROR: %s is a compile-time type and cannot gain fields\n", m_name);
+            return false;
         }
-        return nullptr;
+        
+        const NameId id = HashName(name);
+        const FieldInfo* existing = GetFieldById(id);
+        if (existing) {
+            // Same name twice, or two names with the same hash
+            printf("[Reflection] ERROR: Field %s.%s clashes with %s.%s, ignoring it\n",
+                   m_name, name.c_str(), m_name, existing->GetName());
+            return false;
+        }
+        
+        m_storage->fieldNames.push_back(name);  // Deque: earlier names never move
+        m_storage->fieldTable.Insert(id, static_cast<int>(m_storage->fields.size()));
+        m_storage->fields.emplace_back(m_storage->fieldNames.back().c_str(), type, offset, size);
+        
+        m_fields = m_storage->fields.data();
+        m_fieldCount = m_storage->fields.size();
+        m_slots = m_storage->fieldTable.GetSlots();
+        m_slotCount = m_storage->fieldTable.GetSlotCount();
+        return true;
+    }
+    
+    std::span<const FieldInfo> GetFields() const { return { m_fields, m_fieldCount }; }
+    
+    const FieldInfo* GetFieldById(NameId id) const {
+        const int index = FindNameSlot(m_slots, m_slotCount, id);
+        return index >= 0 ? &m_fields[index] : nullptr;
+    }
+    
+    const FieldInfo* GetField(const char* name) const {
+        const FieldInfo* field = GetFieldById(HashName(name));
+        return field && std::strcmp(field->GetName(), name) == 0 ? field : nullptr;
     }
     
+    const FieldInfo* GetField(const std::string& name) const {
+        return GetField(name.c_str());
+    }
+
 private:
-    std::string m_name;
-    size_t m_size;
-    std::vector<FieldInfo> m_fields;
+    struct Storage {
+        std::string name;
+        std::deque<std::string> fieldNames;
+        std::vector<FieldInfo> fields;
+        NameTable fieldTable;
+    };
+    
+    const char* m_name = nullptr;
+    NameId m_id = 0;
+    size_t m_size = 0;
+    const FieldInfo* m_fields = nullptr;
+    size_t m_fieldCount = 0;
+    const NameSlot* m_slots = nullptr;
+    size_t m_slotCount = 0;
+    std::unique_ptr<Storage> m_storage;  // Null for compile-time types
+};
+
+// ===== Field Handle =====
+// A resolved (type, field) pair. The offset and type are copied in so accessing a
+// field through a handle needs no name lookup at all.
+struct FieldHandle {
+    int typeIndex;
+    NameId fieldId;
+    size_t offset;
+    PropertyType type;
+    bool valid;  // False once a re-registered type dropped the field
 };
 
 // ===== Reflection Registry =====
@@ -97,25 +274,133 @@ public:
     }
     
     void RegisterType(const std::string& name, std::unique_ptr<TypeInfo> typeInfo) {
-        m_types[name] = std::move(typeInfo);
+        if (!typeInfo || name != typeInfo->GetName()) {
+            printf("[Reflection] ERROR: Type %s registered under a different name\n", name.c_str());
+            return;
+        }
+        // Replaced types stay alive so pointers handed out earlier remain valid
+        m_ownedTypes.push_back(std::move(typeInfo));
+        RegisterStaticType(*m_ownedTypes.back());
+    }
+    
+    /// <summary>
+    /// Register a type whose TypeInfo lives in static storage (see REFLECT_STATIC_TYPE)
+    /// </summary>
+    void RegisterStaticType(const TypeInfo& typeInfo) {
+        const char* name = typeInfo.GetName();
+        const int existing = m_typeTable.Find(typeInfo.GetId());
+        if (existing >= 0) {
+            if (std::strcmp(m_types[existing]->GetName(), name) != 0) {
+                printf("[Reflection] ERROR: Type %s clashes with %s, ignoring it\n",
+                       name, m_types[existing]->GetName());
+                return;
+            }
+            // Registering a name again replaces the earlier type
+            m_types[existing] = &typeInfo;
+            RefreshHandles(existing);
+            return;
+        }
+        
+        const int index = static_cast<int>(m_types.size());
+        m_typeTable.Insert(typeInfo.GetId(), index);
+        m_types.push_back(&typeInfo);
+        
+        // Type indices in the C API are in name order
+        auto position = std::lower_bound(m_sortedTypes.begin(), m_sortedTypes.end(), name,
+            [this](int typeIndex, const char* key) { return std::strcmp(m_types[typeIndex]->GetName(), key) < 0; });
+        m_sortedTypes.insert(position, index);
+    }
+    
+    const TypeInfo* GetTypeById(NameId id) const {
+        const int index = m_typeTable.Find(id);
+        return index >= 0 ? m_types[index] : nullptr;
+    }
+    
+    const TypeInfo* GetType(const char* name) const {
+        const TypeInfo* typeInfo = GetTypeById(HashName(name));
+        return typeInfo && std::strcmp(typeInfo->GetName(), name) == 0 ? typeInfo : nullptr;
     }
     
     const TypeInfo* GetType(const std::string& name) const {
-        auto it = m_types.find(name);
-        return it != m_types.end() ? it->second.get() : nullptr;
+        return GetType(name.c_str());
+    }
+    
+    int GetTypeCount() const { return static_cast<int>(m_types.size()); }
+    
+    /// <summary>
+    /// Type by position in name order (0 to GetTypeCount() - 1)
+    /// </summary>
+    const TypeInfo* GetTypeByIndex(int index) const {
+        if (index < 0 || index >= static_cast<int>(m_sortedTypes.size())) return nullptr;
+        return m_types[m_sortedTypes[index]];
     }
     
     std::vector<std::string> GetAllTypeNames() const {
         std::vector<std::string> names;
-        for (const auto& pair : m_types) {
-            names.push_back(pair.first);
+        names.reserve(m_sortedTypes.size());
+        for (int index : m_sortedTypes) {
+            names.push_back(m_types[index]->GetName());
         }
         return names;
     }
     
+    /// <summary>
+    /// Resolve a field once so later accesses can skip name lookups.
+    /// Resolving the same field again returns the same handle.
+    /// </summary>
+    /// <returns>Handle (&gt;= 0), or -1 if the type or field is unknown</returns>
+    int ResolveField(const char* typeName, const char* fieldName) {
+        const TypeInfo* typeInfo = GetType(typeName);
+        const FieldInfo* field = typeInfo ? typeInfo->GetField(fieldName) : nullptr;
+        if (!field) return -1;
+        
+        const uint64_t key = (static_cast<uint64_t>(typeInfo->GetId()) << 32) | field->GetId();
+        auto it = m_handleIds.find(key);
+        if (it != m_handleIds.end()) {
+            return it->second;
+        }
+        
+        FieldHandle handle;
+        handle.typeIndex = m_typeTable.Find(typeInfo->GetId());
+        handle.fieldId = field->GetId();
+        handle.offset = field->GetOffset();
+        handle.type = field->GetType();
+        handle.valid = true;
+        
+        const int id = static_cast<int>(m_handles.size());
+        m_handles.push_back(handle);
+        m_handleIds.emplace(key, id);
+        return id;
+    }
+    
+    const FieldHandle* GetHandle(int handle) const {
+        if (handle < 0 || handle >= static_cast<int>(m_handles.size())) return nullptr;
+        const FieldHandle& entry = m_handles[handle];
+        return entry.valid ? &entry : nullptr;
+    }
+
 private:
     ReflectionRegistry() = default;
-    std::map<std::string, std::unique_ptr<TypeInfo>> m_types;
+    
+    void RefreshHandles(int typeIndex) {
+        const TypeInfo& typeInfo = *m_types[typeIndex];
+        for (FieldHandle& handle : m_handles) {
+            if (handle.typeIndex != typeIndex) continue;
+            const FieldInfo* field = typeInfo.GetFieldById(handle.fieldId);
+            handle.valid = field != nullptr;
+            if (field) {
+                handle.offset = field->GetOffset();
+                handle.type = field->GetType();
+            }
+        }
+    }
+    
+    std::vector<const TypeInfo*> m_types;            // Registration order
+    std::vector<std::unique_ptr<TypeInfo>> m_ownedTypes;  // Types built at runtime
+    std::vector<int> m_sortedTypes;                  // Indices into m_types, by name
+    NameTable m_typeTable;
+    std::vector<FieldHandle> m_handles;
+    std::unordered_map<uint64_t, int> m_handleIds;   // (type ID, field ID) -> handle
 };
 
 // ===== Registration Helper =====
@@ -137,7 +422,7 @@ public:
     template<typename FieldType>
     TypeRegistrar& Field(const std::string& name, FieldType T::*field, PropertyType type) {
         size_t offset = reinterpret_cast<size_t>(&(static_cast<T*>(nullptr)->*field));
-        m_typeInfo->AddField(name, type, offset);
+        m_typeInfo->AddField(name, type, offset, sizeof(FieldType));
         return *this;
     }
     
@@ -159,5 +444,154 @@ private:
 #define REFLECT_FIELD(TypeName, FieldName, FieldType) \
     .Field(#FieldName, &TypeName::FieldName, Chronicles::Reflection::PropertyType::FieldType)
 
+// ===== Compile-Time Descriptors =====
+// Types described with REFLECT_STATIC_TYPE get their field table, lookup table and TypeInfo
+// built by the compiler into static storage: nothing is allocated and nothing depends on
+// static-init order (registration only inserts a pointer). C++ callers can also skip the
+// registry entirely and use Get<"field">(instance) / Visit(instance, visitor), which
+// resolve fields at compile time.
+
+template<typename T>
+struct TypeTag {};
+
+template<typename FieldT, PropertyType Type>
+constexpr bool IsCompatibleField() {
+    if constexpr (Type == PropertyType::Bool) return std::is_same_v<FieldT, bool>;
+    else if constexpr (Type == PropertyType::Int) return std::is_same_v<FieldT, int>;
+    else if constexpr (Type == PropertyType::Float) return std::is_same_v<FieldT, float>;
+    else if constexpr (Type == PropertyType::Double) return std::is_same_v<FieldT, double>;
+    else if constexpr (Type == PropertyType::String) return std::is_same_v<FieldT, std::string>;
+    else if constexpr (Type == PropertyType::Custom) return true;
+    else return std::is_trivially_copyable_v<FieldT> && sizeof(FieldT) == GetPropertySize(Type);
+}
+
+/// <summary>
+/// One field of a compile-time descriptor; keeps the member pointer so typed access
+/// needs no offset arithmetic
+/// </summary>
+template<typename T, typename FieldT, PropertyType Type>
+struct FieldDescriptor {
+    static_assert(IsCompatibleField<FieldT, Type>(), "C++ field type does not match its PropertyType");
+    
+    using ValueType = FieldT;
+    static constexpr PropertyType type = Type;
+    
+    const char* name;
+    FieldT T::*member;
+    size_t offset;
+    
+    constexpr FieldInfo ToFieldInfo() const { return FieldInfo(name, Type, offset, sizeof(FieldT)); }
+};
+
+template<typename T, typename... Fields>
+struct TypeDescriptor {
+    const char* name;
+    std::tuple<Fields...> fields;
+};
+
+template<typename T, typename... Fields>
+constexpr TypeDescriptor<T, Fields...> MakeTypeDescriptor(const char* name, Fields... fields) {
+    return { name, std::tuple<Fields...>(fields...) };
+}
+
+// Descriptor tables for T, in static storage. ChroniclesDescribe is found by
+// argument-dependent lookup, so REFLECT_STATIC_TYPE must sit in T's namespace.
+template<typename T>
+struct StaticTypeInfo {
+    static constexpr auto descriptor = ChroniclesDescribe(TypeTag<T>{});
+    static constexpr size_t fieldCount = std::tuple_size_v<decltype(descriptor.fields)>;
+    
+    static constexpr std::array<FieldInfo, fieldCount> fields = std::apply(
+        [](const auto&... field) { return std::array<FieldInfo, fieldCount>{ field.ToFieldInfo()... }; },
+        descriptor.fields);
+    
+    // Power of two with at least half the slots empty, like NameTable
+    static constexpr size_t slotCount = [] {
+        size_t count = 1;
+        while (count < fieldCount * 2) count *= 2;
+        return count;
+    }();
+    
+    static constexpr std::array<NameSlot, slotCount> slots = [] {
+        std::array<NameSlot, slotCount> table{};
+        for (size_t field = 0; field < fieldCount; field++) {
+            size_t i = fields[field].GetId() & (slotCount - 1);
+            while (table[i].index >= 0) {
+                // Two fields with the same ID cannot be looked up; make the build fail
+                if (table[i].id == fields[field].GetId()) throw "duplicate reflected field name";
+                i = (i + 1) & (slotCount - 1);
+            }
+            table[i].id = fields[field].GetId();
+            table[i].index = static_cast<int>(field);
+        }
+        return table;
+    }();
+    
+    static constinit inline const TypeInfo typeInfo{
+        descriptor.name, sizeof(T), fields.data(), fieldCount, slots.data(), slotCount };
+    
+    static bool Register() {
+        ReflectionRegistry::Instance().RegisterStaticType(typeInfo);
+        return true;
+    }
+};
+
+// Index of the named field in T's descriptor, or the field count if there is none
+template<typename T>
+constexpr size_t FindStaticField(std::string_view name) {
+    for (size_t i = 0; i < StaticTypeInfo<T>::fieldCount; i++) {
+        if (name == StaticTypeInfo<T>::fields[i].GetName()) return i;
+    }
+    return StaticTypeInfo<T>::fieldCount;
+}
+
+// String literal usable as a template argument: Get<"x">(transform)
+template<size_t N>
+struct FieldName {
+    char value[N];
+    constexpr FieldName(const char (&text)[N]) {
+        for (size_t i = 0; i < N; i++) value[i] = text[i];
+    }
+};
+
+/// <summary>
+/// Typed reference to a field, resolved at compile time
+/// </summary>
+template<FieldName Name, typename T>
+constexpr auto& Get(T& instance) {
+    using Type = std::remove_const_t<T>;
+    constexpr size_t index = FindStaticField<Type>(Name.value);
+    static_assert(index < StaticTypeInfo<Type>::fieldCount, "no reflected field with this name");
+    return instance.*(std::get<index>(StaticTypeInfo<Type>::descriptor.fields).member);
+}
+
+/// <summary>
+/// Call visitor(field, value) for every reflected field, in declaration order.
+/// field is the FieldDescriptor (name, type, offset); value is a typed reference.
+/// </summary>
+template<typename T, typename Visitor>
+constexpr void Visit(T& instance, Visitor&& visitor) {
+    std::apply([&](const auto&... field) { (visitor(field, instance.*(field.member)), ...); },
+               StaticTypeInfo<std::remove_const_t<T>>::descriptor.fields);
+}
+
+// Describe a type at compile time and register it. Use at namespace scope, in the
+// namespace that declares the type:
+//   REFLECT_STATIC_TYPE(Transform,
+//       REFLECT_STATIC_FIELD(x, Float),
+//       REFLECT_STATIC_FIELD(y, Float))
+#define REFLECT_STATIC_TYPE(TypeName, ...) \
+    constexpr auto ChroniclesDescribe(::Chronicles::Reflection::TypeTag<TypeName>) { \
+        using ReflectedType = TypeName; \
+        return ::Chronicles::Reflection::MakeTypeDescriptor<TypeName>(#TypeName, __VA_ARGS__); \
+    } \
+    [[maybe_unused]] inline const bool s_##TypeName##_staticRegistered = \
+        ::Chronicles::Reflection::StaticTypeInfo<TypeName>::Register()
+
+#define REFLECT_STATIC_FIELD(FieldName, FieldType) \
+    ::Chronicles::Reflection::FieldDescriptor<ReflectedType, decltype(ReflectedType::FieldName), \
+        ::Chronicles::Reflection::PropertyType::FieldType>{ \
+        #FieldName, &ReflectedType::FieldName, offsetof(ReflectedType, FieldName) }
+
 } // namespace Reflection
 } // namespace Chronicles
@@ -4,18 +4,95 @@
 
 using namespace Chronicles::Reflection;
 
+namespace {
+    // Field of the given type, or null if the type or field is unknown or the type differs
+    const FieldInfo* FindField(const char* typeName, const char* fieldName, PropertyType type) {
+        auto typeInfo = ReflectionRegistry::Instance().GetType(typeName);
+        if (!typeInfo) return nullptr;
+        
+        auto field = typeInfo->GetField(fieldName);
+        return field && field->GetType() == type ? field : nullptr;
+    }
+    
+    // Field address for a handle, or null if the handle is stale or of another type
+    template<typename T>
+    T* HandleTarget(int handle, void* instance, PropertyType type) {
+        const FieldHandle* entry = ReflectionRegistry::Instance().GetHandle(handle);
+        if (!entry || entry->type != type || !instance) return nullptr;
+        return reinterpret_cast<T*>(static_cast<char*>(instance) + entry->offset);
+    }
+    
+    // Copy N bytes from each strided element; N is a constant so the memcpy
+    // becomes a plain load/store
+    template<size_t N>
+    void CopyStrided(const char* src, size_t srcStride, char* dst, size_t dstStride, int count) {
+        int i = 0;
+        for (; i + 4 <= count; i += 4) {
+            std::memcpy(dst, src, N);
+            std::memcpy(dst + dstStride, src + srcStride, N);
+            std::memcpy(dst + 2 * dstStride, src + 2 * srcStride, N);
+            std::memcpy(dst + 3 * dstStride, src + 3 * srcStride, N);
+            src += 4 * srcStride;
+            dst += 4 * dstStride;
+        }
+        for (; i < count; i++) {
+            std::memcpy(dst, src, N);
+            src += srcStride;
+            dst += dstStride;
+        }
+    }
+    
+    void CopyElements(const char* src, size_t srcStride, char* dst, size_t dstStride,
+                      size_t size, int count) {
+        if (srcStride == size && dstStride == size) {
+            // Both sides packed (e.g. a plain float array): one block copy
+            std::memcpy(dst, src, size * static_cast<size_t>(count));
+            return;
+        }
+        switch (size) {
+            case 1: CopyStrided<1>(src, srcStride, dst, dstStride, count); break;
+            case 4: CopyStrided<4>(src, srcStride, dst, dstStride, count); break;
+            case 8: CopyStrided<8>(src, srcStride, dst, dstStride, count); break;
+            case 12: CopyStrided<12>(src, srcStride, dst, dstStride, count); break;
+            case 16: CopyStrided<16>(src, srcStride, dst, dstStride, count); break;
+        }
+    }
+    
+    // Read one field from `count` instances laid out `stride` bytes apart into a packed array
+    int Gather(int handle, PropertyType type, const void* base, int stride, int count, void* out) {
+        const FieldHandle* entry = ReflectionRegistry::Instance().GetHandle(handle);
+        if (!entry || entry->type != type || !base || !out || stride <= 0 || count < 0) return -1;
+        
+        const size_t size = GetPropertySize(type);
+        CopyElements(static_cast<const char*>(base) + entry->offset, static_cast<size_t>(stride),
+                     static_cast<char*>(out), size, size, count);
+        return count;
+    }
+    
+    // Write a packed array of values into one field of `count` strided instances
+    int Scatter(int handle, PropertyType type, void* base, int stride, int count, const void* values) {
+        const FieldHandle* entry = ReflectionRegistry::Instance().GetHandle(handle);
+        if (!entry || entry->type != type || !base || !values || stride <= 0 || count < 0) return -1;
+        
+        const size_t size = GetPropertySize(type);
+        CopyElements(static_cast<const char*>(values), size,
+                     static_cast<char*>(base) + entry->offset, static_cast<size_t>(stride), size, count);
+        return count;
+    }
+}
+
 // ===== Type Query Functions =====
 
 extern "C" ENGINE_API int Reflection_GetTypeCount() {
-    return static_cast<int>(ReflectionRegistry::Instance().GetAllTypeNames().size());
+    return ReflectionRegistry::Instance().GetTypeCount();
 }
 
 extern "C" ENGINE_API void Reflection_GetTypeName(int index, char* buffer, int bufferSize) {
     if (!buffer || bufferSize <= 0) return;
     
-    auto names = ReflectionRegistry::Instance().GetAllTypeNames();
-    if (index >= 0 && index < static_cast<int>(names.size())) {
-        std::strncpy(buffer, names[index].c_str(), bufferSize - 1);
+    auto typeInfo = ReflectionRegistry::Instance().GetTypeByIndex(index);
+    if (typeInfo) {
+        std::strncpy(buffer, typeInfo->GetName(), bufferSize - 1);
         buffer[bufferSize - 1] = '\0';
     } else {
         buffer[0] = '\0';
@@ -46,7 +123,7 @@ extern "C" ENGINE_API void Reflection_GetFieldName(const char* typeName, int fie
     if (typeInfo) {
         const auto& fields = typeInfo->GetFields();
         if (fieldIndex >= 0 && fieldIndex < static_cast<int>(fields.size())) {
-            std::strncpy(buffer, fields[fieldIndex].GetName().c_str(), bufferSize - 1);
+            std::strncpy(buffer, fields[fieldIndex].GetName(), bufferSize - 1);
             buffer[bufferSize - 1] = '\0';
             return;
         }
@@ -80,90 +157,60 @@ extern "C" ENGINE_API int Reflection_GetFieldOffset(const char* typeName, const
 extern "C" ENGINE_API float Reflection_GetFloatValue(const char* typeName, const char* fieldName, void* instance) {
     if (!typeName || !fieldName || !instance) return 0.0f;
     
-    auto typeInfo = ReflectionRegistry::Instance().GetType(typeName);
-    if (!typeInfo) return 0.0f;
-    
-    auto field = typeInfo->GetField(fieldName);
-    if (!field || field->GetType() != PropertyType::Float) return 0.0f;
-    
-    return field->GetValue<float>(instance);
+    auto field = FindField(typeName, fieldName, PropertyType::Float);
+    return field ? field->GetValue<float>(instance) : 0.0f;
 }
 
 extern "C" ENGINE_API void Reflection_SetFloatValue(const char* typeName, const char* fieldName, 
                                                     void* instance, float value) {
     if (!typeName || !fieldName || !instance) return;
     
-    auto typeInfo = ReflectionRegistry::Instance().GetType(typeName);
-    if (!typeInfo) return;
-    
-    auto field = typeInfo->GetField(fieldName);
-    if (!field || field->GetType() != PropertyType::Float) return;
-    
-    field->SetValue<float>(instance, value);
+    auto field = FindField(typeName, fieldName, PropertyType::Float);
+    if (field) {
+        field->SetValue<float>(instance, value);
+    }
 }
 
 extern "C" ENGINE_API int Reflection_GetIntValue(const char* typeName, const char* fieldName, void* instance) {
     if (!typeName || !fieldName || !instance) return 0;
     
-    auto typeInfo = ReflectionRegistry::Instance().GetType(typeName);
-    if (!typeInfo) return 0;
-    
-    auto field = typeInfo->GetField(fieldName);
-    if (!field || field->GetType() != PropertyType::Int) return 0;
-    
-    return field->GetValue<int>(instance);
+    auto field = FindField(typeName, fieldName, PropertyType::Int);
+    return field ? field->GetValue<int>(instance) : 0;
 }
 
 extern "C" ENGINE_API void Reflection_SetIntValue(const char* typeName, const char* fieldName, 
                                                   void* instance, int value) {
     if (!typeName || !fieldName || !instance) return;
     
-    auto typeInfo = ReflectionRegistry::Instance().GetType(typeName);
-    if (!typeInfo) return;
-    
-    auto field = typeInfo->GetField(fieldName);
-    if (!field || field->GetType() != PropertyType::Int) return;
-    
-    field->SetValue<int>(instance, value);
+    auto field = FindField(typeName, fieldName, PropertyType::Int);
+    if (field) {
+        field->SetValue<int>(instance, value);
+    }
 }
 
 extern "C" ENGINE_API bool Reflection_GetBoolValue(const char* typeName, const char* fieldName, void* instance) {
     if (!typeName || !fieldName || !instance) return false;
     
-    auto typeInfo = ReflectionRegistry::Instance().GetType(typeName);
-    if (!typeInfo) return false;
-    
-    auto field = typeInfo->GetField(fieldName);
-    if (!field || field->GetType() != PropertyType::Bool) return false;
-    
-    return field->GetValue<bool>(instance);
+    auto field = FindField(typeName, fieldName, PropertyType::Bool);
+    return field ? field->GetValue<bool>(instance) : false;
 }
 
 extern "C" ENGINE_API void Reflection_SetBoolValue(const char* typeName, const char* fieldName, 
                                                    void* instance, bool value) {
     if (!typeName || !fieldName || !instance) return;
     
-    auto typeInfo = ReflectionRegistry::Instance().GetType(typeName);
-    if (!typeInfo) return;
-    
-    auto field = typeInfo->GetField(fieldName);
-    if (!field || field->GetType() != PropertyType::Bool) return;
-    
-    field->SetValue<bool>(instance, value);
+    auto field = FindField(typeName, fieldName, PropertyType::Bool);
+    if (field) {
+        field->SetValue<bool>(instance, value);
+    }
 }
 
 extern "C" ENGINE_API void Reflection_GetStringValue(const char* typeName, const char* fieldName, 
                                                      void* instance, char* buffer, int bufferSize) {
     if (!typeName || !fieldName || !instance || !buffer || bufferSize <= 0) return;
     
-    auto typeInfo = ReflectionRegistry::Instance().GetType(typeName);
-    if (!typeInfo) {
-        buffer[0] = '\0';
-        return;
-    }
-    
-    auto field = typeInfo->GetField(fieldName);
-    if (!field || field->GetType() != PropertyType::String) {
+    auto field = FindField(typeName, fieldName, PropertyType::String);
+    if (!field) {
         buffer[0] = '\0';
         return;
     }
@@ -177,11 +224,141 @@ extern "C" ENGINE_API void Reflection_SetStringValue(const char* typeName, const
                                                      void* instance, const char* value) {
     if (!typeName || !fieldName || !instance || !value) return;
     
-    auto typeInfo = ReflectionRegistry::Instance().GetType(typeName);
-    if (!typeInfo) return;
+    auto field = FindField(typeName, fieldName, PropertyType::String);
+    if (field) {
+        field->SetValue<std::string>(instance, std::string(value));
+    }
+}
+
+// ===== Runtime Types =====
+
+extern "C" ENGINE_API bool Reflection_RegisterType(const char* typeName, int size, int fieldCount,
+                                                   const char* const* fieldNames, const int* fieldTypes,
+                                                   const int* fieldOffsets) {
+    if (!typeName || !*typeName || size <= 0 || fieldCount < 0 ||
+        (fieldCount > 0 && (!fieldNames || !fieldTypes || !fieldOffsets))) {
+        printf("[Reflection] ERROR: Invalid arguments registering a type\n");
+        return false;
+    }
     
-    auto field = typeInfo->GetField(fieldName);
-    if (!field || field->GetType() != PropertyType::String) return;
+    auto typeInfo = std::make_unique<TypeInfo>(typeName, static_cast<size_t>(size));
+    for (int i = 0; i < fieldCount; i++) {
+        const auto type = static_cast<PropertyType>(fieldTypes[i]);
+        const size_t fieldSize = fieldTypes[i] >= 0 && fieldTypes[i] <= static_cast<int>(PropertyType::Custom)
+            ? GetPropertySize(type) : 0;
+        if (!fieldNames[i] || fieldSize == 0 || fieldOffsets[i] < 0 ||
+            static_cast<size_t>(fieldOffsets[i]) + fieldSize > static_cast<size_t>(size)) {
+            printf("[Reflection] ERROR: Field %d of %s is not a fixed-size field inside the type\n", i, typeName);
+            return false;
+        }
+        if (!typeInfo->AddField(fieldNames[i], type, static_cast<size_t>(fieldOffsets[i]))) {
+            return false;
+        }
+    }
     
-    field->SetValue<std::string>(instance, std::string(value));
+    // A name whose hash clashes with another type's is rejected by the registry
+    const TypeInfo* registered = typeInfo.get();
+    ReflectionRegistry::Instance().RegisterType(typeName, std::move(typeInfo));
+    return ReflectionRegistry::Instance().GetType(typeName) == registered;
+}
+
+// ===== Field Handles =====
+
+extern "C" ENGINE_API int Reflection_ResolveField(const char* typeName, const char* fieldName) {
+    if (!typeName || !fieldName) return -1;
+    
+    return ReflectionRegistry::Instance().ResolveField(typeName, fieldName);
+}
+
+extern "C" ENGINE_API int Reflection_GetHandleType(int handle) {
+    const FieldHandle* entry = ReflectionRegistry::Instance().GetHandle(handle);
+    return entry ? static_cast<int>(entry->type) : -1;
+}
+
+extern "C" ENGINE_API float Reflection_GetFloatByHandle(int handle, void* instance) {
+    float* target = HandleTarget<float>(handle, instance, PropertyType::Float);
+    return target ? *target : 0.0f;
+}
+
+extern "C" ENGINE_API void Reflection_SetFloatByHandle(int handle, void* instance, float value) {
+    float* target = HandleTarget<float>(handle, instance, PropertyType::Float);
+    if (target) *target = value;
+}
+
+extern "C" ENGINE_API int Reflection_GetIntByHandle(int handle, void* instance) {
+    int* target = HandleTarget<int>(handle, instance, PropertyType::Int);
+    return target ? *target : 0;
+}
+
+extern "C" ENGINE_API void Reflection_SetIntByHandle(int handle, void* instance, int value) {
+    int* target = HandleTarget<int>(handle, instance, PropertyType::Int);
+    if (target) *target = value;
+}
+
+extern "C" ENGINE_API bool Reflection_GetBoolByHandle(int handle, void* instance) {
+    bool* target = HandleTarget<bool>(handle, instance, PropertyType::Bool);
+    return target ? *target : false;
+}
+
+extern "C" ENGINE_API void Reflection_SetBoolByHandle(int handle, void* instance, bool value) {
+    bool* target = HandleTarget<bool>(handle, instance, PropertyType::Bool);
+    if (target) *target = value;
+}
+
+// ===== Batch Access =====
+
+extern "C" ENGINE_API int Reflection_GatherBool(int handle, const void* base, int stride, int count, bool* out) {
+    return Gather(handle, PropertyType::Bool, base, stride, count, out);
+}
+
+extern "C" ENGINE_API int Reflection_ScatterBool(int handle, void* base, int stride, int count, const bool* values) {
+    return Scatter(handle, PropertyType::Bool, base, stride, count, values);
+}
+
+extern "C" ENGINE_API int Reflection_GatherInt(int handle, const void* base, int stride, int count, int* out) {
+    return Gather(handle, PropertyType::Int, base, stride, count, out);
+}
+
+extern "C" ENGINE_API int Reflection_ScatterInt(int handle, void* base, int stride, int count, const int* values) {
+    return Scatter(handle, PropertyType::Int, base, stride, count, values);
+}
+
+extern "C" ENGINE_API int Reflection_GatherFloat(int handle, const void* base, int stride, int count, float* out) {
+    return Gather(handle, PropertyType::Float, base, stride, count, out);
+}
+
+extern "C" ENGINE_API int Reflection_ScatterFloat(int handle, void* base, int stride, int count, const float* values) {
+    return Scatter(handle, PropertyType::Float, base, stride, count, values);
+}
+
+extern "C" ENGINE_API int Reflection_GatherDouble(int handle, const void* base, int stride, int count, double* out) {
+    return Gather(handle, PropertyType::Double, base, stride, count, out);
+}
+
+extern "C" ENGINE_API int Reflection_ScatterDouble(int handle, void* base, int stride, int count, const double* values) {
+    return Scatter(handle, PropertyType::Double, base, stride, count, values);
+}
+
+extern "C" ENGINE_API int Reflection_GatherVector2(int handle, const void* base, int stride, int count, float* out) {
+    return Gather(handle, PropertyType::Vector2, base, stride, count, out);
+}
+
+extern "C" ENGINE_API int Reflection_ScatterVector2(int handle, void* base, int stride, int count, const float* values) {
+    return Scatter(handle, PropertyType::Vector2, base, stride, count, values);
+}
+
+extern "C" ENGINE_API int Reflection_GatherVector3(int handle, const void* base, int stride, int count, float* out) {
+    return Gather(handle, PropertyType::Vector3, base, stride, count, out);
+}
+
+extern "C" ENGINE_API int Reflection_ScatterVector3(int handle, void* base, int stride, int count, const float* values) {
+    return Scatter(handle, PropertyType::Vector3, base, stride, count, values);
+}
+
+extern "C" ENGINE_API int Reflection_GatherColor(int handle, const void* base, int stride, int count, float* out) {
+    return Gather(handle, PropertyType::Color, base, stride, count, out);
+}
+
+extern "C" ENGINE_API int Reflection_ScatterColor(int handle, void* base, int stride, int count, const float* values) {
+    return Scatter(handle, PropertyType::Color, base, stride, count, values);
 }
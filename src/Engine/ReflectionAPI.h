@@ -106,4 +106,140 @@ extern "C" {
     /// </summary>
     ENGINE_API void Reflection_SetStringValue(const char* typeName, const char* fieldName, 
                                               void* instance, const char* value);
+    
+    // ===== Runtime Types =====
+    
+    /// <summary>
+    /// Describe a type laid out by the caller (e.g. a managed struct) so tools and the IPC
+    /// server can see it. Fields are given as parallel arrays of names, PropertyType values
+    /// and byte offsets; only fixed-size types are accepted (not String or Custom).
+    /// Registering a name again replaces the earlier type.
+    /// </summary>
+    /// <returns>true if the type was registered</returns>
+    ENGINE_API bool Reflection_RegisterType(const char* typeName, int size, int fieldCount,
+                                            const char* const* fieldNames, const int* fieldTypes,
+                                            const int* fieldOffsets);
+    
+    // ===== Field Handles =====
+    // Resolve a (type, field) pair once, then access it without any string work.
+    // A handle's number never changes, but registering its type again re-resolves it:
+    // if the new type lacks the field, the handle becomes invalid.
+    
+    /// <summary>
+    /// Resolve a field to a handle. The same field always resolves to the same handle.
+    /// </summary>
+    /// <returns>Handle (&gt;= 0), or -1 if the type or field is unknown</returns>
+    ENGINE_API int Reflection_ResolveField(const char* typeName, const char* fieldName);
+    
+    /// <summary>
+    /// Get the field type behind a handle
+    /// </summary>
+    /// <returns>PropertyType enum value, or -1 for an invalid handle</returns>
+    ENGINE_API int Reflection_GetHandleType(int handle);
+    
+    /// <summary>
+    /// Get float field value from instance (0 if the handle is not a Float field)
+    /// </summary>
+    ENGINE_API float Reflection_GetFloatByHandle(int handle, void* instance);
+    
+    /// <summary>
+    /// Set float field value on instance
+    /// </summary>
+    ENGINE_API void Reflection_SetFloatByHandle(int handle, void* instance, float value);
+    
+    /// <summary>
+    /// Get int field value from instance (0 if the handle is not an Int field)
+    /// </summary>
+    ENGINE_API int Reflection_GetIntByHandle(int handle, void* instance);
+    
+    /// <summary>
+    /// Set int field value on instance
+    /// </summary>
+    ENGINE_API void Reflection_SetIntByHandle(int handle, void* instance, int value);
+    
+    /// <summary>
+    /// Get bool field value from instance (false if the handle is not a Bool field)
+    /// </summary>
+    ENGINE_API bool Reflection_GetBoolByHandle(int handle, void* instance);
+    
+    /// <summary>
+    /// Set bool field value on instance
+    /// </summary>
+    ENGINE_API void Reflection_SetBoolByHandle(int handle, void* instance, bool value);
+    
+    // ===== Batch Access =====
+    // Read or write one field across `count` instances that start at `base` and are
+    // `stride` bytes apart (e.g. an array of components), in a single call.
+    // Values are packed: Vector2/Vector3/Color use 2/3/4 floats per instance.
+    // Each returns count, or -1 if the handle is invalid or not of the function's type.
+    
+    /// <summary>
+    /// Read a bool field from each instance into out
+    /// </summary>
+    ENGINE_API int Reflection_GatherBool(int handle, const void* base, int stride, int count, bool* out);
+    
+    /// <summary>
+    /// Write a bool field on each instance from values
+    /// </summary>
+    ENGINE_API int Reflection_ScatterBool(int handle, void* base, int stride, int count, const bool* values);
+    
+    /// <summary>
+    /// Read a int field from each instance into out
+    /// </summary>
+    ENGINE_API int Reflection_GatherInt(int handle, const void* base, int stride, int count, int* out);
+    
+    /// <summary>
+    /// Write a int field on each instance from values
+    /// </summary>
+    ENGINE_API int Reflection_ScatterInt(int handle, void* base, int stride, int count, const int* values);
+    
+    /// <summary>
+    /// Read a float field from each instance into out
+    /// </summary>
+    ENGINE_API int Reflection_GatherFloat(int handle, const void* base, int stride, int count, float* out);
+    
+    /// <summary>
+    /// Write a float field on each instance from values
+    /// </summary>
+    ENGINE_API int Reflection_ScatterFloat(int handle, void* base, int stride, int count, const float* values);
+    
+    /// <summary>
+    /// Read a double field from each instance into out
+    /// </summary>
+    ENGINE_API int Reflection_GatherDouble(int handle, const void* base, int stride, int count, double* out);
+    
+    /// <summary>
+    /// Write a double field on each instance from values
+    /// </summary>
+    ENGINE_API int Reflection_ScatterDouble(int handle, void* base, int stride, int count, const double* values);
+    
+    /// <summary>
+    /// Read a Vector2 field from each instance into out
+    /// </summary>
+    ENGINE_API int Reflection_GatherVector2(int handle, const void* base, int stride, int count, float* out);
+    
+    /// <summary>
+    /// Write a Vector2 field on each instance from values
+    /// </summary>
+    ENGINE_API int Reflection_ScatterVector2(int handle, void* base, int stride, int count, const float* values);
+    
+    /// <summary>
+    /// Read a Vector3 field from each instance into out
+    /// </summary>
+    ENGINE_API int Reflection_GatherVector3(int handle, const void* base, int stride, int count, float* out);
+    
+    /// <summary>
+    /// Write a Vector3 field on each instance from values
+    /// </summary>
+    ENGINE_API int Reflection_ScatterVector3(int handle, void* base, int stride, int count, const float* values);
+    
+    /// <summary>
+    /// Read a Color field from each instance into out
+    /// </summary>
+    ENGINE_API int Reflection_GatherColor(int handle, const void* base, int stride, int count, float* out);
+    
+    /// <summary>
+    /// Write a Color field on each instance from values
+    /// </summary>
+    ENGINE_API int Reflection_ScatterColor(int handle, void* base, int stride, int count, const float* values);
 }
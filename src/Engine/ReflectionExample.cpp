@@ -19,18 +19,18 @@ struct GameObject {
     Transform transform;
 };
 
-// Register Transform type
-static auto registerTransform = Chronicles::Reflection::TypeRegistrar<Transform>("Transform")
-    REFLECT_FIELD(Transform, x, Float)
-    REFLECT_FIELD(Transform, y, Float)
-    REFLECT_FIELD(Transform, rotation, Float)
-    REFLECT_FIELD(Transform, scale, Float);
+// Register Transform type (descriptor tables are built at compile time)
+REFLECT_STATIC_TYPE(Transform,
+    REFLECT_STATIC_FIELD(x, Float),
+    REFLECT_STATIC_FIELD(y, Float),
+    REFLECT_STATIC_FIELD(rotation, Float),
+    REFLECT_STATIC_FIELD(scale, Float));
 
-// Register GameObject type  
-static auto registerGameObject = Chronicles::Reflection::TypeRegistrar<GameObject>("GameObject")
-    REFLECT_FIELD(GameObject, name, String)
-    REFLECT_FIELD(GameObject, id, Int)
-    REFLECT_FIELD(GameObject, active, Bool);
+// Register GameObject type
+REFLECT_STATIC_TYPE(GameObject,
+    REFLECT_STATIC_FIELD(name, String),
+    REFLECT_STATIC_FIELD(id, Int),
+    REFLECT_STATIC_FIELD(active, Bool));
 
 // Example function to demonstrate reflection usage
 void DemonstrateReflection() {
@@ -89,6 +89,13 @@ void DemonstrateReflection() {
         }
     }
     
+    // Compile-time access: no registry lookup, fields resolved by the compiler
+    Get<"y">(transform) = 50.0f;
+    std::cout << "\nTransform via Visit:" << std::endl;
+    Visit(transform, [](const auto& field, const auto& value) {
+        std::cout << "  - " << field.name << ": " << value << std::endl;
+    });
+    
     std::cout << "\n=== End Demo ===" << std::endl;
 }
 
@@ -0,0 +1,424 @@
+#include "RegionFile.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+using namespace Chronicles::World;
+
+namespace {
+    const uint32_t RegionMagic = 0x47524843;  // "CHRG" read as little-endian
+    const uint32_t RegionVersion = 1;
+    const size_t RegionHeaderSize = 8 + RegionChunks * 8;
+    
+    // Compact once superseded records outweigh live ones and are worth a rewrite
+    const uint64_t CompactMinDeadBytes = 16 * 1024;
+    
+    void PutU32(uint8_t* out, uint32_t value) {
+        out[0] = static_cast<uint8_t>(value);
+        out[1] = static_cast<uint8_t>(value >> 8);
+        out[2] = static_cast<uint8_t>(value >> 16);
+        out[3] = static_cast<uint8_t>(value >> 24);
+    }
+    
+    uint32_t GetU32(const uint8_t* in) {
+        return static_cast<uint32_t>(in[0]) | static_cast<uint32_t>(in[1]) << 8 |
+               static_cast<uint32_t>(in[2]) << 16 | static_cast<uint32_t>(in[3]) << 24;
+    }
+}
+
+// ===== PackBits =====
+
+size_t Chronicles::World::PackBitsEncode(const uint8_t* input, size_t length, std::vector<uint8_t>& output) {
+    const size_t start = output.size();
+    size_t i = 0;
+    while (i < length) {
+        // Runs shorter than three stay literal: encoding them would not save anything and
+        // splitting a literal stretch costs a control byte
+        size_t run = 1;
+        while (i + run < length && run < 128 && input[i + run] == input[i]) {
+            run++;
+        }
+        if (run >= 3) {
+            output.push_back(static_cast<uint8_t>(257 - run));
+            output.push_back(input[i]);
+            i += run;
+            continue;
+        }
+        
+        size_t literals = 1;
+        while (i + literals < length && literals < 128 &&
+               !(i + literals + 2 < length && input[i + literals] == input[i + literals + 1] &&
+                 input[i + literals] == input[i + literals + 2])) {
+            literals++;
+        }
+        output.push_back(static_cast<uint8_t>(literals - 1));
+        output.insert(output.end(), input + i, input + i + literals);
+        i += literals;
+    }
+    return output.size() - start;
+}
+
+bool Chronicles::World::PackBitsDecode(const uint8_t* input, size_t length, uint8_t* output, size_t outputLength) {
+    size_t in = 0;
+    size_t out = 0;
+    while (in < length) {
+        const uint8_t control = input[in++];
+        if (control < 128) {
+            const size_t count = static_cast<size_t>(control) + 1;
+            if (in + count > length || out + count > outputLength) return false;
+            memcpy(output + out, input + in, count);
+            in += count;
+            out += count;
+        } else if (control > 128) {
+            const size_t count = 257 - static_cast<size_t>(control);
+            if (in >= length || out + count > outputLength) return false;
+            memset(output + out, input[in++], count);
+            out += count;
+        } else {
+            return false;
+        }
+    }
+    return out == outputLength;
+}
+
+// ===== RegionStore Implementation =====
+
+bool RegionStore::SetDirectory(const std::string& directory) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        printf("[Region] ERROR: Cannot create %s: %s\n", directory.c_str(), error.message().c_str());
+        return false;
+    }
+    
+    m_regions.clear();
+    m_missingRegions.clear();
+    m_directory = directory;
+    printf("[Region] Region files in %s\n", directory.c_str());
+    return true;
+}
+
+std::string RegionStore::GetRegionPath(int32_t regionX) const {
+    char name[32];
+    snprintf(name, sizeof(name), "r.%d.chr", static_cast<int>(regionX));
+    return (std::filesystem::path(m_directory) / name).string();
+}
+
+RegionStore::Region* RegionStore::OpenRegion(int32_t regionX, bool create) {
+    auto it = m_regions.find(regionX);
+    if (it != m_regions.end()) {
+        it->second->lastUse = ++m_useCounter;
+        return it->second.get();
+    }
+    if (m_directory.empty()) {
+        printf("[Region] ERROR: Region_SetDirectory has not been called\n");
+        return nullptr;
+    }
+    
+    if (!create && m_missingRegions.count(regionX) != 0) {
+        return nullptr;
+    }
+    
+    const std::string path = GetRegionPath(regionX);
+    std::error_code error;
+    const bool exists = std::filesystem::exists(path, error);
+    if (!exists && !create) {
+        m_missingRegions.insert(regionX);
+        return nullptr;
+    }
+    m_missingRegions.erase(regionX);
+    
+    auto region = std::make_unique<Region>();
+    if (!exists) {
+        uint8_t header[RegionHeaderSize] = {};
+        PutU32(header, RegionMagic);
+        PutU32(header + 4, RegionVersion);
+        std::ofstream created(path, std::ios::binary | std::ios::trunc);
+        created.write(reinterpret_cast<const char*>(header), sizeof(header));
+        if (!created) {
+            printf("[Region] ERROR: Cannot create %s\n", path.c_str());
+            return nullptr;
+        }
+    }
+    
+    // Records are read through the mapping; the stream only appends and patches the table
+    region->path = path;
+    region->file.open(path, std::ios::in | std::ios::out | std::ios::binary);
+    if (!region->file.is_open() || !region->view.Open(path.c_str())) {
+        printf("[Region] ERROR: Cannot open %s\n", path.c_str());
+        return nullptr;
+    }
+    const uint8_t* mapped = region->view.GetData();
+    if (region->view.GetSize() < RegionHeaderSize ||
+        GetU32(mapped) != RegionMagic || GetU32(mapped + 4) != RegionVersion) {
+        printf("[Region] ERROR: %s is not a region file\n", path.c_str());
+        return nullptr;
+    }
+    
+    region->fileSize = region->view.GetSize();
+    for (int slot = 0; slot < RegionChunks; slot++) {
+        TableEntry& entry = region->table[slot];
+        entry.offset = GetU32(mapped + 8 + slot * 8);
+        entry.size = GetU32(mapped + 12 + slot * 8);
+        if (entry.offset != 0 && (entry.offset < RegionHeaderSize || entry.offset + static_cast<uint64_t>(entry.size) > region->fileSize)) {
+            printf("[Region] ERROR: %s has a corrupt entry for slot %d, ignoring it\n", path.c_str(), slot);
+            entry = {};
+        }
+        region->liveBytes += entry.size;
+    }
+    
+    // Evict the least recently used file
+    if (m_regions.size() >= MaxOpenRegions) {
+        auto oldest = m_regions.begin();
+        for (auto candidate = m_regions.begin(); candidate != m_regions.end(); ++candidate) {
+            if (candidate->second->lastUse < oldest->second->lastUse) {
+                oldest = candidate;
+            }
+        }
+        m_regions.erase(oldest);
+    }
+    
+    region->lastUse = ++m_useCounter;
+    Region* opened = region.get();
+    m_regions[regionX] = std::move(region);
+    return opened;
+}
+
+const uint8_t* RegionStore::MapRecord(Region& region, const TableEntry& entry) {
+    // Records appended since the file was mapped lie past the view; map it again
+    if (entry.offset + static_cast<uint64_t>(entry.size) > region.view.GetSize()) {
+        if (!region.view.Open(region.path.c_str()) ||
+            entry.offset + static_cast<uint64_t>(entry.size) > region.view.GetSize()) {
+            return nullptr;
+        }
+    }
+    return region.view.GetData() + entry.offset;
+}
+
+bool RegionStore::WriteTableEntry(Region& region, int slot) {
+    uint8_t entry[8];
+    PutU32(entry, region.table[slot].offset);
+    PutU32(entry + 4, region.table[slot].size);
+    region.file.clear();
+    region.file.seekp(static_cast<std::streamoff>(8 + slot * 8));
+    region.file.write(reinterpret_cast<const char*>(entry), sizeof(entry));
+    region.file.flush();
+    return static_cast<bool>(region.file);
+}
+
+bool RegionStore::SaveChunk(int32_t chunkX, const uint8_t* tiles, const uint8_t* vegetation) {
+    if (!tiles) {
+        return false;
+    }
+    
+    uint8_t record[ChunkRecordSize];
+    memcpy(record, tiles, ChunkTileCount);
+    if (vegetation) {
+        memcpy(record + ChunkTileCount, vegetation, ChunkWidth);
+    } else {
+        memset(record + ChunkTileCount, 0, ChunkWidth);
+    }
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    // Fall back to raw bytes for chunks noisy enough that RLE does not pay
+    m_scratch.assign(1, static_cast<uint8_t>(ChunkCodec::PackBits));
+    if (PackBitsEncode(record, sizeof(record), m_scratch) >= sizeof(record)) {
+        m_scratch.assign(1, static_cast<uint8_t>(ChunkCodec::Raw));
+        m_scratch.insert(m_scratch.end(), record, record + sizeof(record));
+    }
+    
+    const int32_t regionX = ChunkToRegionCoord(chunkX);
+    Region* region = OpenRegion(regionX, true);
+    if (!region) {
+        return false;
+    }
+    
+    // Append the record first; the table entry only moves once the data is on disk
+    region->file.clear();
+    region->file.seekp(static_cast<std::streamoff>(region->fileSize));
+    region->file.write(reinterpret_cast<const char*>(m_scratch.data()), static_cast<std::streamsize>(m_scratch.size()));
+    region->file.flush();
+    if (!region->file) {
+        printf("[Region] ERROR: Failed to write chunk %d\n", static_cast<int>(chunkX));
+        m_regions.erase(regionX);
+        return false;
+    }
+    
+    const int slot = ChunkToRegionSlot(chunkX);
+    TableEntry& entry = region->table[slot];
+    region->liveBytes -= entry.size;
+    entry.offset = static_cast<uint32_t>(region->fileSize);
+    entry.size = static_cast<uint32_t>(m_scratch.size());
+    region->liveBytes += entry.size;
+    region->fileSize += m_scratch.size();
+    if (!WriteTableEntry(*region, slot)) {
+        printf("[Region] ERROR: Failed to update the table for chunk %d\n", static_cast<int>(chunkX));
+        m_regions.erase(regionX);
+        return false;
+    }
+    
+    const uint64_t deadBytes = region->fileSize - RegionHeaderSize - region->liveBytes;
+    if (deadBytes > region->liveBytes && deadBytes >= CompactMinDeadBytes) {
+        CompactLocked(regionX);
+    }
+    return true;
+}
+
+int RegionStore::LoadChunk(int32_t chunkX, uint8_t* tiles, uint8_t* vegetation) {
+    if (!tiles) {
+        return -1;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    Region* region = OpenRegion(ChunkToRegionCoord(chunkX), false);
+    if (!region) {
+        return m_directory.empty() ? -1 : 0;
+    }
+    
+    const TableEntry& entry = region->table[ChunkToRegionSlot(chunkX)];
+    if (entry.offset == 0) {
+        return 0;
+    }
+    
+    const uint8_t* stored = MapRecord(*region, entry);
+    if (!stored || entry.size < 1) {
+        printf("[Region] ERROR: Failed to read chunk %d\n", static_cast<int>(chunkX));
+        return -1;
+    }
+    
+    // Decoded straight from the mapped page
+    uint8_t record[ChunkRecordSize];
+    bool decoded = false;
+    switch (static_cast<ChunkCodec>(stored[0])) {
+        case ChunkCodec::Raw:
+            decoded = entry.size == 1 + sizeof(record);
+            if (decoded) {
+                memcpy(record, stored + 1, sizeof(record));
+            }
+            break;
+        case ChunkCodec::PackBits:
+            decoded = PackBitsDecode(stored + 1, entry.size - 1, record, sizeof(record));
+            break;
+    }
+    if (!decoded) {
+        printf("[Region] ERROR: Chunk %d is corrupt\n", static_cast<int>(chunkX));
+        return -1;
+    }
+    
+    memcpy(tiles, record, ChunkTileCount);
+    if (vegetation) {
+        memcpy(vegetation, record + ChunkTileCount, ChunkWidth);
+    }
+    return 1;
+}
+
+bool RegionStore::HasChunk(int32_t chunkX) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    Region* region = OpenRegion(ChunkToRegionCoord(chunkX), false);
+    return region && region->table[ChunkToRegionSlot(chunkX)].offset != 0;
+}
+
+bool RegionStore::Compact(int32_t regionX) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return CompactLocked(regionX);
+}
+
+bool RegionStore::CompactLocked(int32_t regionX) {
+    Region* region = OpenRegion(regionX, false);
+    if (!region) {
+        return false;
+    }
+    
+    // Live records back to back, in slot order, after a fresh table
+    std::vector<uint8_t> contents(RegionHeaderSize);
+    PutU32(contents.data(), RegionMagic);
+    PutU32(contents.data() + 4, RegionVersion);
+    for (int slot = 0; slot < RegionChunks; slot++) {
+        const TableEntry& entry = region->table[slot];
+        if (entry.offset == 0) {
+            continue;
+        }
+        
+        const uint8_t* stored = MapRecord(*region, entry);
+        if (!stored) {
+            printf("[Region] ERROR: Failed to read slot %d while compacting\n", slot);
+            return false;
+        }
+        const size_t position = contents.size();
+        contents.insert(contents.end(), stored, stored + entry.size);
+        PutU32(contents.data() + 8 + slot * 8, static_cast<uint32_t>(position));
+        PutU32(contents.data() + 12 + slot * 8, entry.size);
+    }
+    
+    // Write beside the original and swap, so a crash leaves one complete file
+    const std::string path = GetRegionPath(regionX);
+    const std::string temporaryPath = path + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(contents.data()), static_cast<std::streamsize>(contents.size()));
+        if (!file) {
+            printf("[Region] ERROR: Cannot write %s\n", temporaryPath.c_str());
+            return false;
+        }
+    }
+    
+    m_regions.erase(regionX);
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error) {
+        printf("[Region] ERROR: Cannot replace %s: %s\n", path.c_str(), error.message().c_str());
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+    return true;
+}
+
+void RegionStore::CloseAll() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_regions.clear();
+    m_missingRegions.clear();
+}
+
+// ===== C API Implementation =====
+
+extern "C" ENGINE_API bool Region_SetDirectory(const char* directory) {
+    if (!directory || !*directory) {
+        return false;
+    }
+    return RegionStore::Instance().SetDirectory(directory);
+}
+
+extern "C" ENGINE_API bool Region_SaveChunk(int chunkX, const uint8_t* tiles, const uint8_t* vegetation) {
+    return RegionStore::Instance().SaveChunk(chunkX, tiles, vegetation);
+}
+
+extern "C" ENGINE_API bool Region_SaveResidentChunk(int chunkX) {
+    ChunkStore& store = ChunkStore::Instance();
+    const uint8_t* tiles = store.GetTiles(chunkX);
+    if (!tiles) {
+        return false;
+    }
+    return RegionStore::Instance().SaveChunk(chunkX, tiles, store.GetVegetation(chunkX));
+}
+
+extern "C" ENGINE_API int Region_LoadChunk(int chunkX, uint8_t* tiles, uint8_t* vegetation) {
+    return RegionStore::Instance().LoadChunk(chunkX, tiles, vegetation);
+}
+
+extern "C" ENGINE_API bool Region_HasChunk(int chunkX) {
+    return RegionStore::Instance().HasChunk(chunkX);
+}
+
+extern "C" ENGINE_API bool Region_Compact(int chunkX) {
+    return RegionStore::Instance().Compact(RegionStore::ChunkToRegionCoord(chunkX));
+}
+
+extern "C" ENGINE_API void Region_CloseAll() {
+    RegionStore::Instance().CloseAll();
+}
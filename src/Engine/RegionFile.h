@@ -0,0 +1,172 @@
+#pragma once
+
+#include "EngineExport.h"
+#include "ChunkStore.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Chronicles of a Drifter - Region Files
+// Persists chunks in groups of RegionChunks per file so explored terrain can be paged
+// out and back in instead of regenerated
+//
+// File layout (little-endian):
+//   Header   "CHRG" | u32 version | RegionChunks x { u32 offset, u32 size }  (offset 0 = not stored)
+//   Records  u8 codec | payload, appended at the end of the file
+// A chunk record holds ChunkTileCount tile bytes followed by ChunkWidth vegetation bytes.
+// Saving appends a new record and then repoints the chunk's table entry, so a crash
+// mid-save leaves the previous copy intact. Superseded records are reclaimed by compaction.
+
+namespace Chronicles {
+namespace World {
+
+constexpr int RegionChunks = 32;
+constexpr int ChunkRecordSize = ChunkTileCount + ChunkWidth;
+
+enum class ChunkCodec : uint8_t {
+    Raw = 0,
+    PackBits = 1
+};
+
+/// <summary>
+/// PackBits run-length encoding: a control byte n < 128 is followed by n + 1 literal
+/// bytes, n > 128 by one byte repeated 257 - n times (2..128); 128 is unused. Terrain
+/// rows are mostly long runs of one tile, so chunks shrink several times over; noisy
+/// input grows by at most one byte in 128.
+/// </summary>
+size_t PackBitsEncode(const uint8_t* input, size_t length, std::vector<uint8_t>& output);
+
+/// <summary>
+/// Decode exactly outputLength bytes; false if the input is malformed or the wrong size
+/// </summary>
+bool PackBitsDecode(const uint8_t* input, size_t length, uint8_t* output, size_t outputLength);
+
+/// <summary>
+/// Region files under one directory. Open files stay memory-mapped in a small cache, so
+/// paging a chunk in decodes its record straight from the mapping. Thread-safe.
+/// </summary>
+class RegionStore {
+public:
+    static RegionStore& Instance() {
+        static RegionStore instance;
+        return instance;
+    }
+    
+    /// <summary>
+    /// Set (and create) the directory region files live in; closes files from the previous one
+    /// </summary>
+    bool SetDirectory(const std::string& directory);
+    
+    /// <summary>
+    /// Store a chunk, replacing any earlier copy. vegetation may be null (none).
+    /// </summary>
+    bool SaveChunk(int32_t chunkX, const uint8_t* tiles, const uint8_t* vegetation);
+    
+    /// <summary>
+    /// Read a stored chunk. Returns 1 if loaded, 0 if the chunk was never saved, -1 on error.
+    /// </summary>
+    int LoadChunk(int32_t chunkX, uint8_t* tiles, uint8_t* vegetation);
+    
+    bool HasChunk(int32_t chunkX);
+    
+    /// <summary>
+    /// Rewrite a region file without superseded records
+    /// </summary>
+    bool Compact(int32_t regionX);
+    
+    /// <summary>
+    /// Flush and close all open region files
+    /// </summary>
+    void CloseAll();
+    
+    static int32_t ChunkToRegionCoord(int32_t chunkX) {
+        return chunkX >= 0 ? chunkX / RegionChunks : (chunkX - RegionChunks + 1) / RegionChunks;
+    }
+    
+    static int ChunkToRegionSlot(int32_t chunkX) {
+        int slot = chunkX % RegionChunks;
+        return slot >= 0 ? slot : slot + RegionChunks;
+    }
+
+private:
+    struct TableEntry {
+        uint32_t offset = 0;
+        uint32_t size = 0;
+    };
+    
+    struct Region {
+        std::string path;
+        std::fstream file;    // Appends records and patches the table
+        MappedFile view;      // Reads; remapped when a record lies past its end
+        TableEntry table[RegionChunks];
+        uint64_t fileSize = 0;
+        uint64_t liveBytes = 0;  // Sum of record sizes still referenced by the table
+        uint64_t lastUse = 0;
+    };
+    
+    RegionStore() = default;
+    
+    std::string GetRegionPath(int32_t regionX) const;
+    Region* OpenRegion(int32_t regionX, bool create);
+    const uint8_t* MapRecord(Region& region, const TableEntry& entry);
+    bool WriteTableEntry(Region& region, int slot);
+    bool CompactLocked(int32_t regionX);
+    
+    static const size_t MaxOpenRegions = 8;
+    
+    std::mutex m_mutex;
+    std::string m_directory;
+    std::unordered_map<int32_t, std::unique_ptr<Region>> m_regions;
+    std::unordered_set<int32_t> m_missingRegions;  // Known not to exist; spares a stat per lookup
+    uint64_t m_useCounter = 0;
+    std::vector<uint8_t> m_scratch;  // Encoded record being written
+};
+
+} // namespace World
+} // namespace Chronicles
+
+// C API for cross-language access
+extern "C" {
+    /// <summary>
+    /// Set the directory region files are kept in (created if missing)
+    /// </summary>
+    ENGINE_API bool Region_SetDirectory(const char* directory);
+    
+    /// <summary>
+    /// Persist a chunk: tiles is ChunkWidth * ChunkHeight bytes (row-major), vegetation
+    /// ChunkWidth bytes or null. Only the chunk's own record is written.
+    /// </summary>
+    ENGINE_API bool Region_SaveChunk(int chunkX, const uint8_t* tiles, const uint8_t* vegetation);
+    
+    /// <summary>
+    /// Persist a chunk resident in the native chunk store straight from its slot
+    /// </summary>
+    ENGINE_API bool Region_SaveResidentChunk(int chunkX);
+    
+    /// <summary>
+    /// Load a persisted chunk into the given arrays (vegetation may be null)
+    /// </summary>
+    /// <returns>1 if loaded, 0 if the chunk was never saved, -1 on error</returns>
+    ENGINE_API int Region_LoadChunk(int chunkX, uint8_t* tiles, uint8_t* vegetation);
+    
+    /// <summary>
+    /// Check whether a chunk has been persisted
+    /// </summary>
+    ENGINE_API bool Region_HasChunk(int chunkX);
+    
+    /// <summary>
+    /// Rewrite a chunk's region file without the space held by superseded saves
+    /// </summary>
+    ENGINE_API bool Region_Compact(int chunkX);
+    
+    /// <summary>
+    /// Flush and close all open region files
+    /// </summary>
+    ENGINE_API void Region_CloseAll();
+}
@@ -1,5 +1,19 @@
 #include "SDL2Renderer.h"
+#include "TextureAtlas.h"
+#include "TextureLoader.h"
+#include <algorithm>
 #include <cstdio>
+#include <cmath>
+#include <string>
+
+#if !SDL_VERSION_ATLEAST(2, 0, 18)
+#error "SDL2Renderer requires SDL 2.0.18 or newer (SDL_RenderGeometry)"
+#endif
+
+namespace {
+    const int DefaultAtlasPageSize = 2048;
+    const int AtlasPadding = 1;  // Transparent gap between regions
+}
 
 namespace Chronicles {
 
@@ -10,6 +24,8 @@ SDL2Renderer::SDL2Renderer()
     , m_windowHeight(0)
     , m_isRunning(false)
     , m_nextTextureId(1)
+    , m_batchTextureId(0)
+    , m_batchTexture(nullptr)
 {
 }
 
@@ -60,6 +76,10 @@ bool SDL2Renderer::Initialize(int width, int height, const char* title) {
     // Enable alpha blending
     SDL_SetRenderDrawBlendMode(m_renderer, SDL_BLENDMODE_BLEND);
     
+    // Reserve room for a typical frame of tiles so the batch never reallocates mid-frame
+    m_batchVertices.reserve(4 * 4096);
+    m_batchIndices.reserve(6 * 4096);
+    
     m_windowWidth = width;
     m_windowHeight = height;
     m_isRunning = true;
@@ -75,6 +95,12 @@ void SDL2Renderer::Shutdown() {
     
     printf("[SDL2Renderer] Shutting down\n");
     
+    // Drop pending quads; their textures are about to be destroyed
+    m_batchVertices.clear();
+    m_batchIndices.clear();
+    m_batchTextureId = 0;
+    m_batchTexture = nullptr;
+    
     // Clean up textures
     for (auto& pair : m_textures) {
         if (pair.second) {
@@ -82,6 +108,7 @@ void SDL2Renderer::Shutdown() {
         }
     }
     m_textures.clear();
+    m_atlases.clear();
     
     // Clean up SDL
     if (m_renderer) {
@@ -102,7 +129,7 @@ void SDL2Renderer::Shutdown() {
 }
 
 void SDL2Renderer::BeginFrame() {
-    // SDL2 doesn't need explicit frame begin
+    BeginBatch();
 }
 
 void SDL2Renderer::EndFrame() {
@@ -110,10 +137,15 @@ void SDL2Renderer::EndFrame() {
 }
 
 void SDL2Renderer::Present() {
+    FlushBatch();
     SDL_RenderPresent(m_renderer);
 }
 
 void SDL2Renderer::Clear(float r, float g, float b, float a) {
+    // Anything still pending would be overwritten by the clear
+    m_batchVertices.clear();
+    m_batchIndices.clear();
+    
     SDL_SetRenderDrawColor(m_renderer,
                           static_cast<Uint8>(r * 255),
                           static_cast<Uint8>(g * 255),
@@ -124,76 +156,289 @@ void SDL2Renderer::Clear(float r, float g, float b, float a) {
 
 void SDL2Renderer::DrawRect(float x, float y, float width, float height,
                             float r, float g, float b, float a) {
-    SDL_SetRenderDrawColor(m_renderer,
-                          static_cast<Uint8>(r * 255),
-                          static_cast<Uint8>(g * 255),
-                          static_cast<Uint8>(b * 255),
-                          static_cast<Uint8>(a * 255));
-    
-    SDL_Rect rect = {
-        static_cast<int>(x),
-        static_cast<int>(y),
-        static_cast<int>(width),
-        static_cast<int>(height)
-    };
-    
-    SDL_RenderFillRect(m_renderer, &rect);
+    BatchQuad quad;
+    quad.x = x;
+    quad.y = y;
+    quad.width = width;
+    quad.height = height;
+    quad.r = r;
+    quad.g = g;
+    quad.b = b;
+    quad.a = a;
+    PushQuad(quad);
 }
 
 void SDL2Renderer::DrawSprite(int textureId, float x, float y,
                               float width, float height, float rotation) {
-    auto it = m_textures.find(textureId);
-    if (it == m_textures.end()) {
+    BatchQuad quad;
+    quad.textureId = textureId;
+    quad.x = x;
+    quad.y = y;
+    quad.width = width;
+    quad.height = height;
+    quad.rotation = rotation;
+    PushQuad(quad);
+}
+
+void SDL2Renderer::BeginBatch() {
+    FlushBatch();
+    m_batchTextureId = 0;
+    m_batchTexture = nullptr;
+}
+
+void SDL2Renderer::PushQuad(const BatchQuad& quad) {
+    int textureId = quad.textureId > 0 ? quad.textureId : 0;
+    
+    // Switching textures ends the current run
+    if (textureId != m_batchTextureId) {
+        SDL_Texture* texture = nullptr;
+        if (textureId != 0) {
+            auto it = m_textures.find(textureId);
+            if (it == m_textures.end()) {
+                return;
+            }
+            texture = it->second;
+        }
+        
+        FlushBatch();
+        m_batchTextureId = textureId;
+        m_batchTexture = texture;
+    }
+    
+    AppendQuad(quad);
+}
+
+void SDL2Renderer::FlushBatch() {
+    if (m_batchIndices.empty()) {
         return;
     }
     
-    SDL_Rect destRect = {
-        static_cast<int>(x),
-        static_cast<int>(y),
-        static_cast<int>(width),
-        static_cast<int>(height)
-    };
+    SDL_RenderGeometry(m_renderer, m_batchTexture,
+                       m_batchVertices.data(), static_cast<int>(m_batchVertices.size()),
+                       m_batchIndices.data(), static_cast<int>(m_batchIndices.size()));
     
-    SDL_Point center = {
-        static_cast<int>(width / 2),
-        static_cast<int>(height / 2)
+    m_batchVertices.clear();
+    m_batchIndices.clear();
+}
+
+void SDL2Renderer::DrawRects(const RectInstance* rects, int count) {
+    if (!rects || count <= 0) {
+        return;
+    }
+    
+    if (m_batchTextureId != 0) {
+        FlushBatch();
+        m_batchTextureId = 0;
+        m_batchTexture = nullptr;
+    }
+    
+    BatchQuad quad;
+    for (int i = 0; i < count; i++) {
+        const RectInstance& rect = rects[i];
+        quad.x = rect.x;
+        quad.y = rect.y;
+        quad.width = rect.width;
+        quad.height = rect.height;
+        quad.r = rect.r;
+        quad.g = rect.g;
+        quad.b = rect.b;
+        quad.a = rect.a;
+        AppendQuad(quad);
+    }
+}
+
+void SDL2Renderer::AppendQuad(const BatchQuad& quad) {
+    SDL_Color color = {
+        static_cast<Uint8>(quad.r * 255),
+        static_cast<Uint8>(quad.g * 255),
+        static_cast<Uint8>(quad.b * 255),
+        static_cast<Uint8>(quad.a * 255)
     };
     
-    double angle = rotation * (180.0 / 3.14159265359); // Convert radians to degrees
+    // Corners in clockwise order: top-left, top-right, bottom-right, bottom-left
+    float cornersX[4] = { quad.x, quad.x + quad.width, quad.x + quad.width, quad.x };
+    float cornersY[4] = { quad.y, quad.y, quad.y + quad.height, quad.y + quad.height };
+    
+    if (quad.rotation != 0.0f) {
+        // Rotate around the quad center (clockwise on screen, matching SDL_RenderCopyEx)
+        float centerX = quad.x + quad.width * 0.5f;
+        float centerY = quad.y + quad.height * 0.5f;
+        float cosAngle = std::cos(quad.rotation);
+        float sinAngle = std::sin(quad.rotation);
+        for (int i = 0; i < 4; i++) {
+            float dx = cornersX[i] - centerX;
+            float dy = cornersY[i] - centerY;
+            cornersX[i] = centerX + dx * cosAngle - dy * sinAngle;
+            cornersY[i] = centerY + dx * sinAngle + dy * cosAngle;
+        }
+    }
+    
+    const float texU[4] = { quad.u0, quad.u1, quad.u1, quad.u0 };
+    const float texV[4] = { quad.v0, quad.v0, quad.v1, quad.v1 };
     
-    SDL_RenderCopyEx(m_renderer, it->second, nullptr, &destRect, angle, &center, SDL_FLIP_NONE);
+    int base = static_cast<int>(m_batchVertices.size());
+    for (int i = 0; i < 4; i++) {
+        SDL_Vertex vertex;
+        vertex.position = { cornersX[i], cornersY[i] };
+        vertex.color = color;
+        vertex.tex_coord = { texU[i], texV[i] };
+        m_batchVertices.push_back(vertex);
+    }
+    
+    m_batchIndices.push_back(base);
+    m_batchIndices.push_back(base + 1);
+    m_batchIndices.push_back(base + 2);
+    m_batchIndices.push_back(base);
+    m_batchIndices.push_back(base + 2);
+    m_batchIndices.push_back(base + 3);
 }
 
 int SDL2Renderer::LoadTexture(const char* filePath) {
-    printf("[SDL2Renderer] Loading texture: %s\n", filePath);
-    
-    SDL_Surface* surface = SDL_LoadBMP(filePath);
-    if (!surface) {
-        printf("[SDL2Renderer] ERROR: SDL_LoadBMP failed: %s\n", SDL_GetError());
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels;
+    std::string error;
+    if (!DecodeImageFile(filePath, width, height, pixels, error)) {
+        printf("[SDL2Renderer] ERROR: Failed to load texture %s: %s\n", filePath ? filePath : "(null)", error.c_str());
         return -1;
     }
     
-    SDL_Texture* texture = SDL_CreateTextureFromSurface(m_renderer, surface);
-    SDL_FreeSurface(surface);
+    int textureId = ReserveTextureId();
+    if (!UploadTexture(textureId, pixels.data(), width, height)) {
+        return -1;
+    }
+    return textureId;
+}
+
+bool SDL2Renderer::UploadTexture(int textureId, const uint8_t* rgbaPixels, int width, int height) {
+    if (!m_renderer || !rgbaPixels || width <= 0 || height <= 0 || m_textures.count(textureId) != 0) {
+        return false;
+    }
     
+    SDL_Texture* texture = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, width, height);
     if (!texture) {
-        printf("[SDL2Renderer] ERROR: SDL_CreateTextureFromSurface failed: %s\n", SDL_GetError());
-        return -1;
+        printf("[SDL2Renderer] ERROR: SDL_CreateTexture failed: %s\n", SDL_GetError());
+        return false;
+    }
+    if (SDL_UpdateTexture(texture, nullptr, rgbaPixels, width * 4) != 0) {
+        printf("[SDL2Renderer] ERROR: SDL_UpdateTexture failed: %s\n", SDL_GetError());
+        SDL_DestroyTexture(texture);
+        return false;
     }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
     
-    int textureId = m_nextTextureId++;
     m_textures[textureId] = texture;
-    
-    return textureId;
+    return true;
 }
 
 void SDL2Renderer::UnloadTexture(int textureId) {
     auto it = m_textures.find(textureId);
     if (it != m_textures.end()) {
+        // Pending quads may still reference this texture
+        if (textureId == m_batchTextureId) {
+            FlushBatch();
+            m_batchTextureId = 0;
+            m_batchTexture = nullptr;
+        }
         SDL_DestroyTexture(it->second);
         m_textures.erase(it);
         printf("[SDL2Renderer] Unloaded texture: %d\n", textureId);
     }
 }
 
+// ===== Texture Atlases =====
+
+int SDL2Renderer::LoadAtlas(const AtlasSpriteSource* sprites, int count, int pageSize) {
+    if (!m_renderer || !sprites || count <= 0) {
+        return -1;
+    }
+    
+    if (pageSize <= 0) {
+        pageSize = DefaultAtlasPageSize;
+    }
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(m_renderer, &info) == 0 && info.max_texture_width > 0 && info.max_texture_height > 0) {
+        pageSize = std::min(pageSize, std::min(info.max_texture_width, info.max_texture_height));
+    }
+    
+    // Compose pages in memory, then upload each one as a single texture
+    AtlasLayout layout;
+    std::vector<std::vector<uint8_t>> pages;
+    std::string error;
+    if (!ComposeAtlas(sprites, count, pageSize, AtlasPadding, layout, pages, error)) {
+        printf("[SDL2Renderer] ERROR: %s\n", error.c_str());
+        return -1;
+    }
+    
+    Atlas atlas;
+    for (size_t page = 0; page < pages.size(); page++) {
+        int textureId = ReserveTextureId();
+        if (!UploadTexture(textureId, pages[page].data(), pageSize, layout.pageHeights[page])) {
+            for (int uploadedId : atlas.pageTextureIds) {
+                UnloadTexture(uploadedId);
+            }
+            return -1;
+        }
+        atlas.pageTextureIds.push_back(textureId);
+    }
+    
+    atlas.regions.reserve(count);
+    for (int i = 0; i < count; i++) {
+        const AtlasPlacement& placement = layout.placements[i];
+        const float pageWidth = static_cast<float>(pageSize);
+        const float pageHeight = static_cast<float>(layout.pageHeights[placement.page]);
+        AtlasRegion region;
+        region.textureId = atlas.pageTextureIds[placement.page];
+        region.u0 = placement.x / pageWidth;
+        region.v0 = placement.y / pageHeight;
+        region.u1 = (placement.x + sprites[i].width) / pageWidth;
+        region.v1 = (placement.y + sprites[i].height) / pageHeight;
+        atlas.regions.push_back(region);
+    }
+    
+    printf("[SDL2Renderer] Packed %d atlas regions onto %zu page(s) of %dx%d\n",
+           count, atlas.pageTextureIds.size(), pageSize, pageSize);
+    
+    m_atlases.push_back(std::move(atlas));
+    return static_cast<int>(m_atlases.size());
+}
+
+void SDL2Renderer::UnloadAtlas(int atlasId) {
+    if (atlasId <= 0 || atlasId > static_cast<int>(m_atlases.size())) {
+        return;
+    }
+    
+    Atlas& atlas = m_atlases[atlasId - 1];
+    for (int textureId : atlas.pageTextureIds) {
+        UnloadTexture(textureId);
+    }
+    atlas.pageTextureIds.clear();
+    atlas.regions.clear();
+}
+
+void SDL2Renderer::DrawSpriteRegion(int atlasId, int regionId, float x, float y,
+                                    float width, float height, float rotation) {
+    if (atlasId <= 0 || atlasId > static_cast<int>(m_atlases.size())) {
+        return;
+    }
+    const Atlas& atlas = m_atlases[atlasId - 1];
+    if (regionId < 0 || regionId >= static_cast<int>(atlas.regions.size())) {
+        return;
+    }
+    
+    const AtlasRegion& region = atlas.regions[regionId];
+    BatchQuad quad;
+    quad.textureId = region.textureId;
+    quad.x = x;
+    quad.y = y;
+    quad.width = width;
+    quad.height = height;
+    quad.u0 = region.u0;
+    quad.v0 = region.v0;
+    quad.u1 = region.u1;
+    quad.v1 = region.v1;
+    quad.rotation = rotation;
+    PushQuad(quad);
+}
+
 } // namespace Chronicles
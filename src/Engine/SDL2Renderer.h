@@ -3,6 +3,7 @@
 #include "IRenderer.h"
 #include <SDL2/SDL.h>
 #include <map>
+#include <vector>
 #include <chrono>
 
 // SDL2 Renderer Implementation
@@ -28,6 +29,20 @@ public:
                    float width, float height, float rotation) override;
     int LoadTexture(const char* filePath) override;
     void UnloadTexture(int textureId) override;
+    int ReserveTextureId() override { return m_nextTextureId++; }
+    bool UploadTexture(int textureId, const uint8_t* rgbaPixels, int width, int height) override;
+    
+    // Batched submission (SDL_RenderGeometry)
+    void BeginBatch() override;
+    void PushQuad(const BatchQuad& quad) override;
+    void FlushBatch() override;
+    void DrawRects(const RectInstance* rects, int count) override;
+    
+    // Texture atlases
+    int LoadAtlas(const AtlasSpriteSource* sprites, int count, int pageSize) override;
+    void UnloadAtlas(int atlasId) override;
+    void DrawSpriteRegion(int atlasId, int regionId, float x, float y,
+                          float width, float height, float rotation) override;
     
     int GetWidth() const override { return m_windowWidth; }
     int GetHeight() const override { return m_windowHeight; }
@@ -43,6 +58,26 @@ private:
     
     std::map<int, SDL_Texture*> m_textures;
     int m_nextTextureId;
+    
+    // Pending quads, flushed with one SDL_RenderGeometry call per texture run
+    std::vector<SDL_Vertex> m_batchVertices;
+    std::vector<int> m_batchIndices;
+    int m_batchTextureId;
+    SDL_Texture* m_batchTexture;
+    
+    // Atlas pages are regular entries in m_textures, so consecutive regions on
+    // the same page extend the current geometry batch
+    struct AtlasRegion {
+        int textureId;
+        float u0, v0, u1, v1;
+    };
+    struct Atlas {
+        std::vector<int> pageTextureIds;
+        std::vector<AtlasRegion> regions;
+    };
+    std::vector<Atlas> m_atlases;  // Index = atlasId - 1; unloaded atlases are left empty
+    
+    void AppendQuad(const BatchQuad& quad);
 };
 
 } // namespace Chronicles
@@ -0,0 +1,349 @@
+#include "SceneDelta.h"
+#include "BinarySerialization.h"
+#include <cstring>
+
+namespace Chronicles {
+namespace IPC {
+
+using Reflection::PropertyType;
+
+namespace {
+    void AppendU8(std::string& out, uint8_t value) {
+        out.push_back(static_cast<char>(value));
+    }
+    
+    void AppendU16(std::string& out, uint16_t value) {
+        char bytes[2];
+        Serialization::Detail::CopyLittleEndian(bytes, &value, 2, 2);
+        out.append(bytes, 2);
+    }
+    
+    void AppendU32(std::string& out, uint32_t value) {
+        char bytes[4];
+        Serialization::Detail::CopyLittleEndian(bytes, &value, 4, 4);
+        out.append(bytes, 4);
+    }
+    
+    void PatchU16(std::string& out, size_t position, uint16_t value) {
+        Serialization::Detail::CopyLittleEndian(&out[position], &value, 2, 2);
+    }
+    
+    void PatchU32(std::string& out, size_t position, uint32_t value) {
+        Serialization::Detail::CopyLittleEndian(&out[position], &value, 4, 4);
+    }
+    
+    void AppendField(std::string& out, const SceneLayout::Field& field, const uint8_t* instance) {
+        AppendU16(out, field.index);
+        const uint8_t* value = instance + field.offset;
+        if (field.type == PropertyType::String) {
+            const std::string& text = *reinterpret_cast<const std::string*>(value);
+            AppendU32(out, static_cast<uint32_t>(text.size()));
+            out.append(text);
+        } else if (field.type == PropertyType::Bool) {
+            AppendU8(out, *reinterpret_cast<const bool*>(value) ? 1 : 0);
+        } else {
+            const size_t position = out.size();
+            out.resize(position + field.size);
+            Serialization::Detail::CopyLittleEndian(&out[position], value, field.size, field.elementSize);
+        }
+    }
+    
+    // Bounds-checked cursor over a received payload
+    struct Reader {
+        const uint8_t* cursor;
+        const uint8_t* end;
+        
+        bool Has(size_t count) const { return static_cast<size_t>(end - cursor) >= count; }
+        
+        bool U8(uint8_t& value) {
+            if (!Has(1)) return false;
+            value = *cursor++;
+            return true;
+        }
+        
+        bool U16(uint16_t& value) {
+            if (!Has(2)) return false;
+            Serialization::Detail::CopyLittleEndian(&value, cursor, 2, 2);
+            cursor += 2;
+            return true;
+        }
+        
+        bool U32(uint32_t& value) {
+            if (!Has(4)) return false;
+            Serialization::Detail::CopyLittleEndian(&value, cursor, 4, 4);
+            cursor += 4;
+            return true;
+        }
+        
+        bool Bytes(std::string& value, size_t count) {
+            if (!Has(count)) return false;
+            value.assign(reinterpret_cast<const char*>(cursor), count);
+            cursor += count;
+            return true;
+        }
+    };
+    
+    // Read one encoded value of the given type, keeping its encoded bytes
+    bool ReadValue(Reader& reader, uint8_t type, std::string& value) {
+        switch (static_cast<PropertyType>(type)) {
+            case PropertyType::String: {
+                const uint8_t* start = reader.cursor;
+                uint32_t length = 0;
+                if (!reader.U32(length) || !reader.Has(length)) return false;
+                reader.cursor += length;
+                value.assign(reinterpret_cast<const char*>(start), static_cast<size_t>(reader.cursor - start));
+                return true;
+            }
+            case PropertyType::Bool:
+                return reader.Bytes(value, 1);
+            case PropertyType::Custom:
+                return false;
+            default: {
+                const size_t size = Reflection::GetPropertySize(static_cast<PropertyType>(type));
+                return size > 0 && reader.Bytes(value, size);
+            }
+        }
+    }
+    
+    bool ReadFields(Reader& reader, SceneMirror::Object& object) {
+        uint16_t count = 0;
+        if (!reader.U16(count)) return false;
+        for (uint16_t i = 0; i < count; i++) {
+            uint16_t index = 0;
+            if (!reader.U16(index) || index >= object.fieldTypes.size()) return false;
+            if (!ReadValue(reader, object.fieldTypes[index], object.fields[index])) return false;
+        }
+        return true;
+    }
+}
+
+// ===== SceneLayout =====
+
+SceneLayout::SceneLayout(const Reflection::TypeInfo& typeInfo)
+    : m_type(typeInfo), m_schemaHash(Serialization::GetSchemaHash(typeInfo)) {
+    uint16_t index = 0;
+    for (const Reflection::FieldInfo& info : typeInfo.GetFields()) {
+        const PropertyType type = info.GetType();
+        m_fieldTypes.push_back(static_cast<uint8_t>(type));
+        
+        Field field = { index++, type, 4, info.GetOffset(), 0, 0 };
+        if (type == PropertyType::Custom) {
+            continue;
+        }
+        if (type == PropertyType::String) {
+            field.snapshotOffset = m_stringCount++;
+        } else {
+            field.size = Reflection::GetPropertySize(type);
+            field.elementSize = type == PropertyType::Double ? 8 : (type == PropertyType::Bool ? 1 : 4);
+            field.snapshotOffset = m_snapshotSize;
+            m_snapshotSize += field.size;
+        }
+        m_fields.push_back(field);
+    }
+}
+
+// ===== SceneRegistry =====
+
+bool SceneRegistry::Track(uint32_t objectId, const char* typeName, const void* instance) {
+    const Reflection::TypeInfo* typeInfo = typeName ? Reflection::ReflectionRegistry::Instance().GetType(typeName) : nullptr;
+    if (!typeInfo || !instance) {
+        return false;
+    }
+    
+    // Types stay registered (and their TypeInfo alive) for the process, so pointers key the cache
+    std::unique_ptr<SceneLayout>& layout = m_layouts[typeInfo];
+    if (!layout) {
+        layout = std::make_unique<SceneLayout>(*typeInfo);
+    }
+    m_objects[objectId] = { instance, layout.get() };
+    return true;
+}
+
+void SceneRegistry::Untrack(uint32_t objectId) {
+    m_objects.erase(objectId);
+}
+
+// ===== SceneSnapshot =====
+
+bool SceneSnapshot::EncodeDelta(const SceneRegistry& registry, std::string& out) {
+    const size_t start = out.size();
+    const bool fullSync = m_fullSync;
+    if (fullSync) {
+        m_objects.clear();
+    }
+    
+    AppendU32(out, SceneDeltaMagic);
+    AppendU16(out, SceneDeltaVersion);
+    AppendU16(out, fullSync ? SceneDeltaFullSync : 0);
+    AppendU32(out, fullSync ? 0 : m_sequence);
+    AppendU32(out, 0);  // Sequence, patched below
+    AppendU32(out, 0);  // Record count, patched below
+    uint32_t records = 0;
+    
+    const auto& objects = registry.GetObjects();
+    
+    // Objects that went away, or now have another type (re-added below)
+    for (auto it = m_objects.begin(); it != m_objects.end();) {
+        const auto tracked = objects.find(it->first);
+        if (tracked != objects.end() && tracked->second.layout == it->second.layout) {
+            ++it;
+            continue;
+        }
+        AppendU32(out, it->first);
+        AppendU8(out, static_cast<uint8_t>(SceneOp::Remove));
+        records++;
+        it = m_objects.erase(it);
+    }
+    
+    for (const auto& [objectId, entry] : objects) {
+        const SceneLayout& layout = *entry.layout;
+        const uint8_t* instance = static_cast<const uint8_t*>(entry.instance);
+        const auto& fields = layout.GetFields();
+        
+        auto [stateIt, added] = m_objects.try_emplace(objectId);
+        ObjectState& state = stateIt->second;
+        if (added) {
+            state.layout = &layout;
+            state.bytes.resize(layout.GetSnapshotSize());
+            state.strings.resize(layout.GetStringCount());
+            
+            const std::string& name = layout.GetType().GetName();
+            AppendU32(out, objectId);
+            AppendU8(out, static_cast<uint8_t>(SceneOp::Add));
+            AppendU32(out, layout.GetSchemaHash());
+            AppendU16(out, static_cast<uint16_t>(name.size()));
+            out.append(name);
+            AppendU16(out, static_cast<uint16_t>(layout.GetFieldTypes().size()));
+            out.append(reinterpret_cast<const char*>(layout.GetFieldTypes().data()), layout.GetFieldTypes().size());
+            AppendU16(out, static_cast<uint16_t>(fields.size()));
+            for (const SceneLayout::Field& field : fields) {
+                AppendField(out, field, instance);
+                if (field.type == PropertyType::String) {
+                    state.strings[field.snapshotOffset] = *reinterpret_cast<const std::string*>(instance + field.offset);
+                } else {
+                    std::memcpy(state.bytes.data() + field.snapshotOffset, instance + field.offset, field.size);
+                }
+            }
+            records++;
+            continue;
+        }
+        
+        // Header is written up front and dropped again if no field changed
+        const size_t recordStart = out.size();
+        uint16_t changed = 0;
+        for (const SceneLayout::Field& field : fields) {
+            const uint8_t* value = instance + field.offset;
+            if (field.type == PropertyType::String) {
+                const std::string& text = *reinterpret_cast<const std::string*>(value);
+                std::string& previous = state.strings[field.snapshotOffset];
+                if (text == previous) {
+                    continue;
+                }
+                previous = text;
+            } else {
+                uint8_t* previous = state.bytes.data() + field.snapshotOffset;
+                if (std::memcmp(previous, value, field.size) == 0) {
+                    continue;
+                }
+                std::memcpy(previous, value, field.size);
+            }
+            if (changed == 0) {
+                AppendU32(out, objectId);
+                AppendU8(out, static_cast<uint8_t>(SceneOp::Update));
+                AppendU16(out, 0);
+            }
+            AppendField(out, field, instance);
+            changed++;
+        }
+        if (changed > 0) {
+            PatchU16(out, recordStart + 5, changed);
+            records++;
+        }
+    }
+    
+    // A full resync is sent even when empty, since it also clears the mirror
+    if (records == 0 && !fullSync) {
+        out.resize(start);
+        return false;
+    }
+    
+    // Skip 0 on wrap-around: it is the sequence of a mirror that has never synced
+    m_sequence = m_sequence == UINT32_MAX ? 1 : m_sequence + 1;
+    m_fullSync = false;
+    PatchU32(out, start + 12, m_sequence);
+    PatchU32(out, start + 16, records);
+    return true;
+}
+
+// ===== SceneMirror =====
+
+SceneMirror::ApplyResult SceneMirror::Apply(const char* payload, size_t size) {
+    Reader reader = { reinterpret_cast<const uint8_t*>(payload), reinterpret_cast<const uint8_t*>(payload) + size };
+    uint32_t magic = 0, baseSequence = 0, sequence = 0, records = 0;
+    uint16_t version = 0, flags = 0;
+    if (!reader.U32(magic) || !reader.U16(version) || !reader.U16(flags) ||
+        !reader.U32(baseSequence) || !reader.U32(sequence) || !reader.U32(records) ||
+        magic != SceneDeltaMagic || version != SceneDeltaVersion) {
+        m_awaitingResync = true;
+        return ApplyResult::Malformed;
+    }
+    
+    const bool fullSync = (flags & SceneDeltaFullSync) != 0;
+    if (!fullSync) {
+        if (m_awaitingResync) {
+            return ApplyResult::Ignored;
+        }
+        if (baseSequence != m_sequence) {
+            m_awaitingResync = true;
+            return ApplyResult::NeedsResync;
+        }
+    } else {
+        m_objects.clear();
+    }
+    
+    for (uint32_t i = 0; i < records; i++) {
+        uint32_t objectId = 0;
+        uint8_t op = 0;
+        if (!reader.U32(objectId) || !reader.U8(op)) {
+            m_awaitingResync = true;
+            return ApplyResult::Malformed;
+        }
+        
+        bool ok = true;
+        if (op == static_cast<uint8_t>(SceneOp::Remove)) {
+            m_objects.erase(objectId);
+        } else if (op == static_cast<uint8_t>(SceneOp::Add)) {
+            Object& object = m_objects[objectId];
+            uint16_t nameLength = 0, fieldCount = 0;
+            std::string fieldTypes;
+            ok = reader.U32(object.schemaHash) && reader.U16(nameLength) && reader.Bytes(object.typeName, nameLength) &&
+                 reader.U16(fieldCount) && reader.Bytes(fieldTypes, fieldCount);
+            if (ok) {
+                object.fieldTypes.assign(fieldTypes.begin(), fieldTypes.end());
+                object.fields.assign(fieldCount, std::string());
+                ok = ReadFields(reader, object);
+            }
+        } else if (op == static_cast<uint8_t>(SceneOp::Update)) {
+            auto it = m_objects.find(objectId);
+            ok = it != m_objects.end() && ReadFields(reader, it->second);
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            m_awaitingResync = true;
+            return ApplyResult::Malformed;
+        }
+    }
+    
+    m_sequence = sequence;
+    m_awaitingResync = false;
+    return ApplyResult::Applied;
+}
+
+const SceneMirror::Object* SceneMirror::Find(uint32_t objectId) const {
+    auto it = m_objects.find(objectId);
+    return it != m_objects.end() ? &it->second : nullptr;
+}
+
+} // namespace IPC
+} // namespace Chronicles
@@ -0,0 +1,163 @@
+#pragma once
+
+#include "Reflection.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Chronicles of a Drifter - Scene Delta Streaming
+// Binary per-field deltas of tracked reflected objects, so an editor can mirror a running
+// scene every frame without full dumps
+//
+// SceneDelta payload (little-endian):
+//   Header   "CHRD" | u16 version | u16 flags (1 = full resync) | u32 base sequence |
+//            u32 sequence | u32 record count
+//   Records  u32 objectId | u8 op, then by op:
+//     Add     u32 schema hash | u16 name length | type name | u16 field count |
+//             u8 PropertyType per field | then the fields as in Update (all of them)
+//     Update  u16 changed field count | per field: u16 field index | value
+//     Remove  nothing
+//   Field indices are positions in the type's field list (as in GetTypeInfo). Values are
+//   encoded as in BinarySerialization: Bool 1 byte, Int/Float 4, Double 8,
+//   Vector2/Vector3/Color 2/3/4 floats, String u32 length + bytes. Custom fields are not sent.
+// A delta applies only to a mirror at exactly its base sequence; a full resync replaces the
+// mirror whatever its sequence. A mirror that falls out of step asks for a resync.
+
+namespace Chronicles {
+namespace IPC {
+
+const uint32_t SceneDeltaMagic = 0x44524843;  // "CHRD" read as little-endian
+const uint16_t SceneDeltaVersion = 1;
+const uint16_t SceneDeltaFullSync = 1;
+const size_t SceneDeltaHeaderSize = 20;
+
+enum class SceneOp : uint8_t {
+    Add = 0,
+    Update = 1,
+    Remove = 2
+};
+
+/// <summary>
+/// A type's streamable fields with where each lives in an instance and in a snapshot.
+/// Fixed-size fields are compared with memcmp at their TypeInfo offsets.
+/// </summary>
+class SceneLayout {
+public:
+    struct Field {
+        uint16_t index;                 // In TypeInfo::GetFields()
+        Reflection::PropertyType type;
+        uint32_t elementSize;           // Scalar width, for byte swapping
+        size_t offset;                  // In the instance
+        size_t size;                    // Bytes; 0 for String
+        size_t snapshotOffset;          // Into the snapshot bytes, or string slot for String
+    };
+    
+    explicit SceneLayout(const Reflection::TypeInfo& typeInfo);
+    
+    const Reflection::TypeInfo& GetType() const { return m_type; }
+    const std::vector<Field>& GetFields() const { return m_fields; }
+    const std::vector<uint8_t>& GetFieldTypes() const { return m_fieldTypes; }
+    uint32_t GetSchemaHash() const { return m_schemaHash; }
+    size_t GetSnapshotSize() const { return m_snapshotSize; }
+    size_t GetStringCount() const { return m_stringCount; }
+
+private:
+    const Reflection::TypeInfo& m_type;
+    std::vector<Field> m_fields;
+    std::vector<uint8_t> m_fieldTypes;  // PropertyType of every field, for Add records
+    uint32_t m_schemaHash = 0;
+    size_t m_snapshotSize = 0;
+    size_t m_stringCount = 0;
+};
+
+/// <summary>
+/// Objects the host streams. Instances are read in place on every publish, so they must
+/// stay valid (and at the same address) until untracked.
+/// </summary>
+class SceneRegistry {
+public:
+    struct Entry {
+        const void* instance;
+        const SceneLayout* layout;
+    };
+    
+    /// <summary>
+    /// Track (or retarget) an object; false if the type is not reflected
+    /// </summary>
+    bool Track(uint32_t objectId, const char* typeName, const void* instance);
+    void Untrack(uint32_t objectId);
+    void Clear() { m_objects.clear(); }
+    
+    const std::unordered_map<uint32_t, Entry>& GetObjects() const { return m_objects; }
+
+private:
+    std::unordered_map<uint32_t, Entry> m_objects;
+    std::unordered_map<const Reflection::TypeInfo*, std::unique_ptr<SceneLayout>> m_layouts;
+};
+
+/// <summary>
+/// Server side of one client's mirror: the field values it was last sent
+/// </summary>
+class SceneSnapshot {
+public:
+    /// <summary>
+    /// Append a SceneDelta payload with everything that changed since the last call.
+    /// Returns false, leaving out as it was, if nothing changed.
+    /// </summary>
+    bool EncodeDelta(const SceneRegistry& registry, std::string& out);
+    
+    /// <summary>
+    /// Make the next EncodeDelta a full resync
+    /// </summary>
+    void RequestFullSync() { m_fullSync = true; }
+    
+    uint32_t GetSequence() const { return m_sequence; }
+
+private:
+    struct ObjectState {
+        const SceneLayout* layout = nullptr;
+        std::vector<uint8_t> bytes;
+        std::vector<std::string> strings;
+    };
+    
+    std::unordered_map<uint32_t, ObjectState> m_objects;
+    uint32_t m_sequence = 0;
+    bool m_fullSync = true;
+};
+
+/// <summary>
+/// Editor side: rebuilds the scene from SceneDelta payloads. Field values are kept in
+/// their encoded form (see the format above), indexed by field.
+/// </summary>
+class SceneMirror {
+public:
+    enum class ApplyResult {
+        Applied,
+        Ignored,      // Stale delta while waiting for a resync
+        NeedsResync,  // Out of step: subscribe again with GetSequence()
+        Malformed     // Also needs a resync
+    };
+    
+    struct Object {
+        std::string typeName;
+        uint32_t schemaHash = 0;
+        std::vector<uint8_t> fieldTypes;
+        std::vector<std::string> fields;
+    };
+    
+    ApplyResult Apply(const char* payload, size_t size);
+    
+    uint32_t GetSequence() const { return m_sequence; }
+    const Object* Find(uint32_t objectId) const;
+    const std::unordered_map<uint32_t, Object>& GetObjects() const { return m_objects; }
+
+private:
+    std::unordered_map<uint32_t, Object> m_objects;
+    uint32_t m_sequence = 0;
+    bool m_awaitingResync = false;
+};
+
+} // namespace IPC
+} // namespace Chronicles
@@ -1,13 +1,16 @@
 #pragma once
 
 #include "Reflection.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <string>
-#include <sstream>
-#include <iomanip>
+#include <vector>
 
-// Chronicles of a Drifter - Simple JSON Serialization
-// Minimal JSON serializer/deserializer for reflection system
-// Note: For production, consider using nlohmann/json library
+// Chronicles of a Drifter - JSON Serialization
+// Streaming JSON writer and reader for reflected types
 
 namespace Chronicles {
 namespace Serialization {
@@ -25,200 +28,665 @@ enum class JsonType {
 };
 
 /// <summary>
-/// Simple JSON writer
+/// Streaming JSON writer. Output goes straight into either a caller-supplied buffer or a
+/// growable arena; numbers are formatted with std::to_chars and strings escaped in place,
+/// so writing allocates nothing beyond arena growth.
+/// A fixed buffer that runs out keeps counting: GetLength() is then the size required.
 /// </summary>
 class JsonWriter {
 public:
-    JsonWriter() : m_indent(0) {}
+    /// <summary>
+    /// Write into a fixed buffer (not NUL-terminated; see Terminate())
+    /// </summary>
+    JsonWriter(char* buffer, size_t capacity, bool pretty = true)
+        : m_data(buffer), m_capacity(buffer ? capacity : 0), m_arena(nullptr), m_pretty(pretty) {}
     
-    void BeginObject() {
-        m_ss << "{\n";
-        m_indent++;
+    /// <summary>
+    /// Append to an arena, growing it as needed. Reusing one arena across saves means
+    /// steady-state serialization never allocates.
+    /// </summary>
+    explicit JsonWriter(std::vector<char>& arena, bool pretty = true)
+        : m_data(arena.data()), m_capacity(arena.size()), m_arena(&arena), m_pretty(pretty) {}
+    
+    void BeginObject() { BeginContainer('{'); }
+    void EndObject() { EndContainer('}'); }
+    void BeginArray() { BeginContainer('['); }
+    void EndArray() { EndContainer(']'); }
+    
+    void BeginArray(const char* key) {
+        Key(key);
+        BeginArray();
     }
     
-    void EndObject() {
-        m_indent--;
-        WriteIndent();
-        m_ss << "}";
+    /// <summary>
+    /// Object member name; the next value call writes its value
+    /// </summary>
+    void Key(const char* key) {
+        BeginValue();
+        AppendString(key, std::strlen(key));
+        if (m_pretty) {
+            Append(": ", 2);
+        } else {
+            Append(':');
+        }
+        m_afterKey = true;
     }
     
-    void BeginArray(const std::string& key) {
-        WriteIndent();
-        m_ss << "\"" << key << "\": [\n";
-        m_indent++;
+    void Bool(bool value) {
+        BeginValue();
+        if (value) {
+            Append("true", 4);
+        } else {
+            Append("false", 5);
+        }
     }
     
-    void EndArray() {
-        m_indent--;
-        m_ss << "\n";
-        WriteIndent();
-        m_ss << "]";
+    void Int(int64_t value) {
+        BeginValue();
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        Append(digits, static_cast<size_t>(result.ptr - digits));
     }
     
-    void WriteField(const std::string& key, bool value, bool comma = true) {
-        WriteIndent();
-        m_ss << "\"" << key << "\": " << (value ? "true" : "false");
-        if (comma) m_ss << ",";
-        m_ss << "\n";
+    // Shortest text that parses back to the same value; JSON has no NaN/Inf, so those become null
+    void Float(float value) { Number(value); }
+    void Double(double value) { Number(value); }
+    
+    void String(const char* value, size_t length) {
+        BeginValue();
+        AppendString(value, length);
     }
     
-    void WriteField(const std::string& key, int value, bool comma = true) {
-        WriteIndent();
-        m_ss << "\"" << key << "\": " << value;
-        if (comma) m_ss << ",";
-        m_ss << "\n";
+    void String(const std::string& value) { String(value.data(), value.size()); }
+    
+    void Null() {
+        BeginValue();
+        Append("null", 4);
     }
     
-    void WriteField(const std::string& key, float value, bool comma = true) {
-        WriteIndent();
-        m_ss << "\"" << key << "\": " << std::fixed << std::setprecision(6) << value;
-        if (comma) m_ss << ",";
-        m_ss << "\n";
+    void WriteField(const char* key, bool value) { Key(key); Bool(value); }
+    void WriteField(const char* key, int value) { Key(key); Int(value); }
+    void WriteField(const char* key, float value) { Key(key); Float(value); }
+    void WriteField(const char* key, double value) { Key(key); Double(value); }
+    void WriteField(const char* key, const std::string& value) { Key(key); String(value); }
+    
+    /// <summary>
+    /// Bytes written so far, or the bytes needed if a fixed buffer overflowed
+    /// </summary>
+    size_t GetLength() const { return m_length; }
+    bool Overflowed() const { return m_length > m_capacity; }
+    const char* GetData() const { return m_data; }
+    
+    /// <summary>
+    /// NUL-terminate the output; false if there was no room for the text plus terminator
+    /// </summary>
+    bool Terminate() {
+        if (m_arena) {
+            Reserve(1);
+        }
+        if (m_length >= m_capacity) {
+            return false;
+        }
+        m_data[m_length] = '\0';
+        return true;
+    }
+
+private:
+    static const int MaxDepth = 64;
+    
+    template<typename T>
+    void Number(T value) {
+        if (!std::isfinite(value)) {
+            Null();
+            return;
+        }
+        BeginValue();
+        char digits[32];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        Append(digits, static_cast<size_t>(result.ptr - digits));
     }
     
-    void WriteField(const std::string& key, double value, bool comma = true) {
-        WriteIndent();
-        m_ss << "\"" << key << "\": " << std::fixed << std::setprecision(6) << value;
-        if (comma) m_ss << ",";
-        m_ss << "\n";
+    // Separator and indentation before a value or key
+    void BeginValue() {
+        if (m_afterKey) {
+            m_afterKey = false;
+            return;
+        }
+        if (m_depth > 0) {
+            const uint64_t bit = uint64_t(1) << (m_depth - 1);
+            if (m_hasItems & bit) {
+                Append(',');
+            }
+            m_hasItems |= bit;
+            NewLine();
+        }
     }
     
-    void WriteField(const std::string& key, const std::string& value, bool comma = true) {
-        WriteIndent();
-        m_ss << "\"" << key << "\": \"" << EscapeString(value) << "\"";
-        if (comma) m_ss << ",";
-        m_ss << "\n";
+    void BeginContainer(char open) {
+        BeginValue();
+        Append(open);
+        if (m_depth < MaxDepth) {
+            m_depth++;
+            m_hasItems &= ~(uint64_t(1) << (m_depth - 1));
+        }
     }
     
-    std::string GetJson() const {
-        return m_ss.str();
+    void EndContainer(char close) {
+        if (m_depth > 0) {
+            const bool hadItems = (m_hasItems >> (m_depth - 1)) & 1;
+            m_depth--;
+            if (hadItems) {
+                NewLine();
+            }
+        }
+        Append(close);
     }
     
-private:
-    void WriteIndent() {
-        for (int i = 0; i < m_indent; i++) {
-            m_ss << "  ";
+    void NewLine() {
+        if (!m_pretty) return;
+        Append('\n');
+        for (int i = 0; i < m_depth; i++) {
+            Append("  ", 2);
         }
     }
     
-    std::string EscapeString(const std::string& str) {
-        std::string result;
-        for (char c : str) {
+    void AppendString(const char* text, size_t length) {
+        static const char hex[] = "0123456789abcdef";
+        Append('"');
+        size_t runStart = 0;
+        for (size_t i = 0; i < length; i++) {
+            const unsigned char c = static_cast<unsigned char>(text[i]);
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                continue;
+            }
+            // Copy the unescaped run in one go, then the escape
+            Append(text + runStart, i - runStart);
+            runStart = i + 1;
             switch (c) {
-                case '"': result += "\\\""; break;
-                case '\\': result += "\\\\"; break;
-                case '\n': result += "\\n"; break;
-                case '\r': result += "\\r"; break;
-                case '\t': result += "\\t"; break;
-                default: result += c;
+                case '"': Append("\\\"", 2); break;
+                case '\\': Append("\\\\", 2); break;
+                case '\n': Append("\\n", 2); break;
+                case '\r': Append("\\r", 2); break;
+                case '\t': Append("\\t", 2); break;
+                default: {
+                    const char escaped[6] = { '\\', 'u', '0', '0', hex[c >> 4], hex[c & 15] };
+                    Append(escaped, sizeof(escaped));
+                    break;
+                }
             }
         }
-        return result;
+        Append(text + runStart, length - runStart);
+        Append('"');
+    }
+    
+    void Append(char c) {
+        Reserve(1);
+        if (m_length < m_capacity) {
+            m_data[m_length] = c;
+        }
+        m_length++;
     }
     
-    std::stringstream m_ss;
-    int m_indent;
+    void Append(const char* text, size_t length) {
+        Reserve(length);
+        if (m_length < m_capacity) {
+            std::memcpy(m_data + m_length, text, std::min(length, m_capacity - m_length));
+        }
+        m_length += length;
+    }
+    
+    void Reserve(size_t extra) {
+        if (!m_arena || m_length + extra <= m_capacity) return;
+        m_arena->resize(std::max(m_length + extra, m_arena->size() * 2 + 256));
+        m_data = m_arena->data();
+        m_capacity = m_arena->size();
+    }
+    
+    char* m_data;
+    size_t m_capacity;
+    size_t m_length = 0;
+    std::vector<char>* m_arena;
+    bool m_pretty;
+    bool m_afterKey = false;
+    int m_depth = 0;
+    uint64_t m_hasItems = 0;  // Bit per open container: something was already written in it
 };
 
 /// <summary>
-/// Serialize an object to JSON using reflection
+/// Write one reflected object. Fields whose type has no JSON form (Custom) are skipped.
 /// </summary>
-inline std::string SerializeObject(const std::string& typeName, void* instance) {
+inline void WriteObject(JsonWriter& writer, const Reflection::TypeInfo& typeInfo, const void* instance) {
     using namespace Reflection;
     
-    auto typeInfo = ReflectionRegistry::Instance().GetType(typeName);
-    if (!typeInfo || !instance) {
-        return "{}";
-    }
-    
-    JsonWriter writer;
     writer.BeginObject();
-    
-    const auto& fields = typeInfo->GetFields();
-    for (size_t i = 0; i < fields.size(); i++) {
-        const auto& field = fields[i];
-        bool isLast = (i == fields.size() - 1);
-        
+    for (const FieldInfo& field : typeInfo.GetFields()) {
+        const char* address = static_cast<const char*>(instance) + field.GetOffset();
         switch (field.GetType()) {
             case PropertyType::Bool:
-                writer.WriteField(field.GetName(), field.GetValue<bool>(instance), !isLast);
+                writer.WriteField(field.GetName(), *reinterpret_cast<const bool*>(address));
                 break;
             case PropertyType::Int:
-                writer.WriteField(field.GetName(), field.GetValue<int>(instance), !isLast);
+                writer.WriteField(field.GetName(), *reinterpret_cast<const int*>(address));
                 break;
             case PropertyType::Float:
-                writer.WriteField(field.GetName(), field.GetValue<float>(instance), !isLast);
+                writer.WriteField(field.GetName(), *reinterpret_cast<const float*>(address));
                 break;
             case PropertyType::Double:
-                writer.WriteField(field.GetName(), field.GetValue<double>(instance), !isLast);
+                writer.WriteField(field.GetName(), *reinterpret_cast<const double*>(address));
                 break;
             case PropertyType::String:
-                writer.WriteField(field.GetName(), field.GetValue<std::string>(instance), !isLast);
+                writer.WriteField(field.GetName(), *reinterpret_cast<const std::string*>(address));
+                break;
+            case PropertyType::Vector2:
+            case PropertyType::Vector3:
+            case PropertyType::Color: {
+                // Written as [x, y(, z)] or [r, g, b, a]
+                const float* components = reinterpret_cast<const float*>(address);
+                writer.BeginArray(field.GetName());
+                for (size_t i = 0; i < GetPropertySize(field.GetType()) / sizeof(float); i++) {
+                    writer.Float(components[i]);
+                }
+                writer.EndArray();
                 break;
+            }
             default:
                 // Skip unsupported types
                 break;
         }
     }
-    
     writer.EndObject();
-    return writer.GetJson();
 }
 
 /// <summary>
-/// Simple JSON value for deserialization
+/// Serialize an object to JSON using reflection
 /// </summary>
-class JsonValue {
+inline std::string SerializeObject(const std::string& typeName, void* instance) {
+    using namespace Reflection;
+    
+    auto typeInfo = ReflectionRegistry::Instance().GetType(typeName);
+    if (!typeInfo || !instance) {
+        return "{}";
+    }
+    
+    std::vector<char> arena;
+    JsonWriter writer(arena);
+    WriteObject(writer, *typeInfo, instance);
+    return std::string(writer.GetData(), writer.GetLength());
+}
+
+/// <summary>
+/// Where and why parsing stopped
+/// </summary>
+struct JsonError {
+    const char* message = nullptr;  // Null on success; static string
+    size_t offset = 0;              // Byte offset into the input
+};
+
+/// <summary>
+/// Single-pass SAX-style JSON reader that deserializes straight into a reflected object.
+/// Keys are matched against the type's hashed field table and values are parsed in place
+/// from the input and stored at the field offsets; there is no intermediate DOM, and the
+/// only allocation is growing a std::string field beyond its current capacity.
+/// Unknown keys are skipped. On error the object may be partially updated.
+/// </summary>
+class JsonReader {
 public:
-    JsonValue() : m_type(JsonType::Null) {}
+    JsonReader(const char* json, size_t length)
+        : m_begin(json), m_cursor(json), m_end(json + length) {}
     
-    JsonType GetType() const { return m_type; }
+    bool ReadObject(const Reflection::TypeInfo& typeInfo, void* instance) {
+        if (!ParseObject(typeInfo, static_cast<char*>(instance))) {
+            return false;
+        }
+        SkipWhitespace();
+        return m_cursor == m_end || Fail("Unexpected data after the object");
+    }
     
-    bool AsBool() const { return m_boolValue; }
-    int AsInt() const { return m_intValue; }
-    float AsFloat() const { return m_floatValue; }
-    const std::string& AsString() const { return m_stringValue; }
+    const JsonError& GetError() const { return m_error; }
+
+private:
+    static const int MaxDepth = 64;
+    static const size_t MaxKeyLength = 256;
     
-    static JsonValue FromBool(bool value) {
-        JsonValue v;
-        v.m_type = JsonType::Bool;
-        v.m_boolValue = value;
-        return v;
+    bool ParseObject(const Reflection::TypeInfo& typeInfo, char* instance) {
+        using namespace Reflection;
+        
+        SkipWhitespace();
+        if (!Consume('{')) return Fail("Expected '{'");
+        SkipWhitespace();
+        if (Consume('}')) return true;
+        
+        while (true) {
+            SkipWhitespace();
+            const FieldInfo* field = nullptr;
+            if (!ParseKey(typeInfo, field)) return false;
+            SkipWhitespace();
+            if (!Consume(':')) return Fail("Expected ':'");
+            SkipWhitespace();
+            
+            if (field) {
+                if (!ParseField(*field, instance + field->GetOffset())) return false;
+            } else if (!SkipValue(0)) {
+                return false;
+            }
+            
+            SkipWhitespace();
+            if (Consume('}')) return true;
+            if (!Consume(',')) return Fail("Expected ',' or '}'");
+        }
     }
     
-    static JsonValue FromInt(int value) {
-        JsonValue v;
-        v.m_type = JsonType::Number;
-        v.m_intValue = value;
-        v.m_floatValue = static_cast<float>(value);
-        return v;
+    // Hash the key while scanning it and look it up; field stays null for unknown keys
+    bool ParseKey(const Reflection::TypeInfo& typeInfo, const Reflection::FieldInfo*& field) {
+        if (!Consume('"')) return Fail("Expected a key");
+        
+        char decoded[MaxKeyLength];
+        size_t length = 0;
+        bool tooLong = false;
+        Reflection::NameId hash = 2166136261u;  // FNV-1a, as Reflection::HashName
+        
+        while (true) {
+            if (m_cursor == m_end) return Fail("Unterminated key");
+            char c = *m_cursor;
+            if (c == '"') {
+                m_cursor++;
+                break;
+            }
+            
+            char utf8[4];
+            size_t count = 0;
+            if (!ReadStringChar(utf8, count)) return false;
+            for (size_t i = 0; i < count; i++) {
+                hash ^= static_cast<uint8_t>(utf8[i]);
+                hash *= 16777619u;
+                if (length < MaxKeyLength - 1) {
+                    decoded[length++] = utf8[i];
+                } else {
+                    tooLong = true;
+                }
+            }
+        }
+        
+        decoded[length] = '\0';
+        field = tooLong ? nullptr : typeInfo.GetFieldById(hash);
+        if (field && std::strcmp(field->GetName(), decoded) != 0) {
+            field = nullptr;  // Hash collision with an unknown key
+        }
+        return true;
     }
     
-    static JsonValue FromFloat(float value) {
-        JsonValue v;
-        v.m_type = JsonType::Number;
-        v.m_floatValue = value;
-        v.m_intValue = static_cast<int>(value);
-        return v;
+    bool ParseField(const Reflection::FieldInfo& field, char* address) {
+        using namespace Reflection;
+        
+        switch (field.GetType()) {
+            case PropertyType::Bool:
+                if (Match("true")) {
+                    *reinterpret_cast<bool*>(address) = true;
+                    return true;
+                }
+                if (Match("false")) {
+                    *reinterpret_cast<bool*>(address) = false;
+                    return true;
+                }
+                return Fail("Expected true or false");
+            case PropertyType::Int: {
+                auto result = std::from_chars(m_cursor, m_end, *reinterpret_cast<int*>(address));
+                if (result.ec == std::errc::result_out_of_range) return Fail("Integer out of range");
+                if (result.ec != std::errc()) return Fail("Expected an integer");
+                m_cursor = result.ptr;
+                if (m_cursor != m_end && (*m_cursor == '.' || *m_cursor == 'e' || *m_cursor == 'E')) {
+                    return Fail("Expected an integer");
+                }
+                return true;
+            }
+            case PropertyType::Float:
+                return ParseNumber(*reinterpret_cast<float*>(address));
+            case PropertyType::Double:
+                return ParseNumber(*reinterpret_cast<double*>(address));
+            case PropertyType::String:
+                return ParseString(*reinterpret_cast<std::string*>(address));
+            case PropertyType::Vector2:
+            case PropertyType::Vector3:
+            case PropertyType::Color:
+                return ParseFloatArray(reinterpret_cast<float*>(address),
+                                       GetPropertySize(field.GetType()) / sizeof(float));
+            default:
+                // No JSON form (Custom); accept and ignore whatever is there
+                return SkipValue(0);
+        }
     }
     
-    static JsonValue FromString(const std::string& value) {
-        JsonValue v;
-        v.m_type = JsonType::String;
-        v.m_stringValue = value;
-        return v;
+    // null stands for a non-finite value, which the writer cannot represent
+    template<typename T>
+    bool ParseNumber(T& value) {
+        if (Match("null")) {
+            value = std::numeric_limits<T>::quiet_NaN();
+            return true;
+        }
+        // from_chars also takes "inf"/"nan", which JSON does not
+        if (!IsNumberStart()) return Fail("Expected a number");
+        auto result = std::from_chars(m_cursor, m_end, value);
+        if (result.ec == std::errc::result_out_of_range) return Fail("Number out of range");
+        if (result.ec != std::errc()) return Fail("Expected a number");
+        m_cursor = result.ptr;
+        return true;
     }
     
-private:
-    JsonType m_type;
-    bool m_boolValue = false;
-    int m_intValue = 0;
-    float m_floatValue = 0.0f;
-    std::string m_stringValue;
+    bool ParseFloatArray(float* values, size_t count) {
+        if (!Consume('[')) return Fail("Expected '['");
+        for (size_t i = 0; i < count; i++) {
+            SkipWhitespace();
+            if (i > 0) {
+                if (!Consume(',')) return Fail("Too few array elements");
+                SkipWhitespace();
+            }
+            if (!ParseNumber(values[i])) return false;
+        }
+        SkipWhitespace();
+        if (!Consume(']')) return Fail("Too many array elements");
+        return true;
+    }
+    
+    bool ParseString(std::string& value) {
+        if (!Consume('"')) return Fail("Expected a string");
+        value.clear();  // Keeps the capacity
+        
+        while (true) {
+            // Append the unescaped run up to the next quote or backslash in one go
+            const char* run = m_cursor;
+            while (m_cursor != m_end && *m_cursor != '"' && *m_cursor != '\\') {
+                if (static_cast<unsigned char>(*m_cursor) < 0x20) return Fail("Control character in string");
+                m_cursor++;
+            }
+            value.append(run, m_cursor);
+            
+            if (m_cursor == m_end) return Fail("Unterminated string");
+            if (*m_cursor == '"') {
+                m_cursor++;
+                return true;
+            }
+            
+            char utf8[4];
+            size_t count = 0;
+            if (!ReadStringChar(utf8, count)) return false;
+            value.append(utf8, count);
+        }
+    }
+    
+    // One character of a string body, escapes decoded, as UTF-8
+    bool ReadStringChar(char* utf8, size_t& count) {
+        const unsigned char c = static_cast<unsigned char>(*m_cursor);
+        if (c < 0x20) return Fail("Control character in string");
+        if (c != '\\') {
+            utf8[0] = static_cast<char>(c);
+            count = 1;
+            m_cursor++;
+            return true;
+        }
+        
+        m_cursor++;
+        if (m_cursor == m_end) return Fail("Unterminated escape");
+        const char escape = *m_cursor++;
+        count = 1;
+        switch (escape) {
+            case '"': utf8[0] = '"'; return true;
+            case '\\': utf8[0] = '\\'; return true;
+            case '/': utf8[0] = '/'; return true;
+            case 'b': utf8[0] = '\b'; return true;
+            case 'f': utf8[0] = '\f'; return true;
+            case 'n': utf8[0] = '\n'; return true;
+            case 'r': utf8[0] = '\r'; return true;
+            case 't': utf8[0] = '\t'; return true;
+            case 'u': break;
+            default:
+                m_cursor--;
+                return Fail("Invalid escape");
+        }
+        
+        uint32_t codePoint = 0;
+        if (!ReadHex4(codePoint)) return false;
+        if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+            // High surrogate: must be followed by \uDC00-\uDFFF
+            uint32_t low = 0;
+            if (!Match("\\u") || !ReadHex4(low) || low < 0xDC00 || low > 0xDFFF) {
+                return Fail("Invalid surrogate pair");
+            }
+            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+        } else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+            return Fail("Invalid surrogate pair");
+        }
+        
+        if (codePoint < 0x80) {
+            utf8[0] = static_cast<char>(codePoint);
+            count = 1;
+        } else if (codePoint < 0x800) {
+            utf8[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+            utf8[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+            count = 2;
+        } else if (codePoint < 0x10000) {
+            utf8[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+            utf8[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            utf8[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+            count = 3;
+        } else {
+            utf8[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+            utf8[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            utf8[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            utf8[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+            count = 4;
+        }
+        return true;
+    }
+    
+    bool ReadHex4(uint32_t& value) {
+        if (m_end - m_cursor < 4) return Fail("Truncated \\u escape");
+        auto result = std::from_chars(m_cursor, m_cursor + 4, value, 16);
+        if (result.ptr != m_cursor + 4) return Fail("Invalid \\u escape");
+        m_cursor += 4;
+        return true;
+    }
+    
+    // Validate and skip any value (for unknown keys)
+    bool SkipValue(int depth) {
+        if (depth >= MaxDepth) return Fail("Nesting too deep");
+        SkipWhitespace();
+        if (m_cursor == m_end) return Fail("Expected a value");
+        
+        switch (*m_cursor) {
+            case '{':
+            case '[': {
+                const char close = *m_cursor == '{' ? '}' : ']';
+                const bool isObject = close == '}';
+                m_cursor++;
+                SkipWhitespace();
+                if (Consume(close)) return true;
+                while (true) {
+                    SkipWhitespace();
+                    if (isObject) {
+                        if (m_cursor == m_end || *m_cursor != '"') return Fail("Expected a key");
+                        if (!SkipValue(depth + 1)) return false;
+                        SkipWhitespace();
+                        if (!Consume(':')) return Fail("Expected ':'");
+                    }
+                    if (!SkipValue(depth + 1)) return false;
+                    SkipWhitespace();
+                    if (Consume(close)) return true;
+                    if (!Consume(',')) return Fail(isObject ? "Expected ',' or '}'" : "Expected ',' or ']'");
+                }
+            }
+            case '"': {
+                m_cursor++;
+                while (m_cursor != m_end && *m_cursor != '"') {
+                    char utf8[4];
+                    size_t count = 0;
+                    if (!ReadStringChar(utf8, count)) return false;
+                }
+                if (!Consume('"')) return Fail("Unterminated string");
+                return true;
+            }
+            case 't': return Match("true") || Fail("Invalid literal");
+            case 'f': return Match("false") || Fail("Invalid literal");
+            case 'n': return Match("null") || Fail("Invalid literal");
+            default: {
+                double ignored;
+                if (!IsNumberStart()) return Fail("Expected a value");
+                auto result = std::from_chars(m_cursor, m_end, ignored);
+                if (result.ec == std::errc::invalid_argument) return Fail("Expected a value");
+                m_cursor = result.ptr;
+                return true;
+            }
+        }
+    }
+    
+    void SkipWhitespace() {
+        while (m_cursor != m_end && (*m_cursor == ' ' || *m_cursor == '\n' || *m_cursor == '\r' || *m_cursor == '\t')) {
+            m_cursor++;
+        }
+    }
+    
+    bool IsNumberStart() const {
+        return m_cursor != m_end && (*m_cursor == '-' || (*m_cursor >= '0' && *m_cursor <= '9'));
+    }
+    
+    bool Consume(char c) {
+        if (m_cursor != m_end && *m_cursor == c) {
+            m_cursor++;
+            return true;
+        }
+        return false;
+    }
+    
+    bool Match(const char* literal) {
+        const size_t length = std::strlen(literal);
+        if (static_cast<size_t>(m_end - m_cursor) < length || std::memcmp(m_cursor, literal, length) != 0) {
+            return false;
+        }
+        m_cursor += length;
+        return true;
+    }
+    
+    bool Fail(const char* message) {
+        m_error.message = message;
+        m_error.offset = static_cast<size_t>(m_cursor - m_begin);
+        return false;
+    }
+    
+    const char* m_begin;
+    const char* m_cursor;
+    const char* m_end;
+    JsonError m_error;
 };
 
-// Note: Full JSON parsing is complex. For production use, integrate nlohmann/json.
-// This is a minimal implementation for demonstration purposes.
+/// <summary>
+/// Deserialize one reflected object from JSON
+/// </summary>
+inline bool ReadObject(const char* json, size_t length, const Reflection::TypeInfo& typeInfo,
+                       void* instance, JsonError& error) {
+    JsonReader reader(json, length);
+    const bool ok = reader.ReadObject(typeInfo, instance);
+    error = reader.GetError();
+    return ok;
+}
 
 } // namespace Serialization
 } // namespace Chronicles
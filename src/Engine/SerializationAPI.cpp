@@ -1,46 +1,170 @@
 #include "SerializationAPI.h"
 #include "Serialization.h"
+#include "BinarySerialization.h"
+#include "MappedFile.h"
+#include <cstdio>
 #include <cstring>
 #include <fstream>
-#include <sstream>
+#include <limits>
+#include <vector>
 
 using namespace Chronicles::Serialization;
 
-extern "C" ENGINE_API int Serialization_ToJson(const char* typeName, void* instance, 
-                                               char* buffer, int bufferSize) {
-    if (!typeName || !instance || !buffer || bufferSize <= 0) {
-        return -1;
+namespace {
+    thread_local char t_lastError[128] = "";
+    thread_local int t_lastErrorOffset = -1;
+    
+    void RecordError(const char* message) {
+        snprintf(t_lastError, sizeof(t_lastError), "%s", message);
+        t_lastErrorOffset = -1;
+    }
+    
+    void RecordParseError(const JsonError& error) {
+        snprintf(t_lastError, sizeof(t_lastError), "%s at byte %zu", error.message, error.offset);
+        t_lastErrorOffset = static_cast<int>(error.offset);
+    }
+    
+    void RecordBinaryError(const BinaryError& error) {
+        snprintf(t_lastError, sizeof(t_lastError), "%s at byte %zu", error.message, error.offset);
+        t_lastErrorOffset = static_cast<int>(error.offset);
+    }
+    
+    void ClearError() {
+        t_lastError[0] = '\0';
+        t_lastErrorOffset = -1;
+    }
+    
+    bool ReadJson(const char* typeName, void* instance, const char* json, size_t length) {
+        auto typeInfo = Chronicles::Reflection::ReflectionRegistry::Instance().GetType(typeName);
+        if (!typeInfo) {
+            RecordError("Unknown type");
+            return false;
+        }
+        
+        JsonError error;
+        if (!ReadObject(json, length, *typeInfo, instance, error)) {
+            RecordParseError(error);
+            return false;
+        }
+        ClearError();
+        return true;
+    }
+    
+    int WriteJson(const char* typeName, void* instance, char* buffer, int bufferSize, bool pretty) {
+        if (!typeName || !instance || bufferSize < 0 || (!buffer && bufferSize > 0)) {
+            return -1;
+        }
+        
+        auto typeInfo = Chronicles::Reflection::ReflectionRegistry::Instance().GetType(typeName);
+        if (!typeInfo) {
+            return -1;
+        }
+        
+        // Formats straight into the caller's buffer; on overflow the writer keeps counting
+        JsonWriter writer(buffer, static_cast<size_t>(bufferSize), pretty);
+        WriteObject(writer, *typeInfo, instance);
+        if (!writer.Terminate() && bufferSize > 0) {
+            buffer[bufferSize - 1] = '\0';
+        }
+        return static_cast<int>(writer.GetLength());
+    }
+    
+    // Per-thread cache of the last type's layout; saves usually repeat one type many times.
+    // Runtime types only ever gain fields, so the field count tells if it went stale.
+    const BinaryLayout& GetBinaryLayout(const Chronicles::Reflection::TypeInfo& typeInfo) {
+        static thread_local BinaryLayout layout;
+        static thread_local const Chronicles::Reflection::TypeInfo* cachedType = nullptr;
+        static thread_local size_t cachedFieldCount = 0;
+        if (cachedType != &typeInfo || cachedFieldCount != typeInfo.GetFields().size()) {
+            layout.Build(typeInfo);
+            cachedType = &typeInfo;
+            cachedFieldCount = typeInfo.GetFields().size();
+        }
+        return layout;
     }
     
-    try {
-        std::string json = SerializeObject(typeName, instance);
+    int WriteBinary(const char* typeName, const void* instances, int stride, int count,
+                    void* buffer, int bufferSize) {
+        if (!typeName || (!instances && count > 0) || stride < 0 || count < 0 || bufferSize < 0 || (!buffer && bufferSize > 0)) {
+            return -1;
+        }
         
-        if (static_cast<int>(json.length()) >= bufferSize) {
-            // Buffer too small
+        auto typeInfo = Chronicles::Reflection::ReflectionRegistry::Instance().GetType(typeName);
+        if (!typeInfo) {
             return -1;
         }
         
-        std::strncpy(buffer, json.c_str(), bufferSize - 1);
-        buffer[bufferSize - 1] = '\0';
+        if (stride > 0 && static_cast<size_t>(stride) < typeInfo->GetSize()) {
+            RecordError("Stride smaller than type");
+            return -1;
+        }
         
-        return static_cast<int>(json.length());
+        const size_t recordStride = stride > 0 ? static_cast<size_t>(stride) : typeInfo->GetSize();
+        BinaryWriter writer(buffer, static_cast<size_t>(bufferSize));
+        writer.WriteArray(GetBinaryLayout(*typeInfo), instances, recordStride, static_cast<uint32_t>(count));
+        if (writer.GetLength() > static_cast<size_t>(std::numeric_limits<int>::max())) {
+            return -1;
+        }
+        return static_cast<int>(writer.GetLength());
     }
-    catch (...) {
-        return -1;
+    
+    int ReadBinary(const char* typeName, void* instances, int stride, int capacity,
+                   const void* data, int size) {
+        if (!typeName || (!instances && capacity > 0) || !data || stride < 0 || capacity < 0 || size < 0) {
+            RecordError("Invalid arguments");
+            return -1;
+        }
+        
+        auto typeInfo = Chronicles::Reflection::ReflectionRegistry::Instance().GetType(typeName);
+        if (!typeInfo) {
+            RecordError("Unknown type");
+            return -1;
+        }
+        
+        if (stride > 0 && static_cast<size_t>(stride) < typeInfo->GetSize()) {
+            RecordError("Stride smaller than type");
+            return -1;
+        }
+        
+        const BinaryLayout& layout = GetBinaryLayout(*typeInfo);
+        BinaryReader reader(data, static_cast<size_t>(size));
+        uint32_t count = 0;
+        if (!reader.ReadHeader(layout, count)) {
+            RecordBinaryError(reader.GetError());
+            return -1;
+        }
+        if (count > static_cast<uint32_t>(capacity)) {
+            RecordError("More records than capacity");
+            return -1;
+        }
+        
+        const size_t recordStride = stride > 0 ? static_cast<size_t>(stride) : typeInfo->GetSize();
+        if (!reader.ReadRecords(layout, instances, recordStride, count)) {
+            RecordBinaryError(reader.GetError());
+            return -1;
+        }
+        ClearError();
+        return static_cast<int>(count);
     }
 }
 
+extern "C" ENGINE_API int Serialization_ToJson(const char* typeName, void* instance, 
+                                               char* buffer, int bufferSize) {
+    return WriteJson(typeName, instance, buffer, bufferSize, true);
+}
+
+extern "C" ENGINE_API int Serialization_ToJsonCompact(const char* typeName, void* instance,
+                                                      char* buffer, int bufferSize) {
+    return WriteJson(typeName, instance, buffer, bufferSize, false);
+}
+
 extern "C" ENGINE_API bool Serialization_FromJson(const char* typeName, void* instance, 
                                                   const char* json) {
     if (!typeName || !instance || !json) {
         return false;
     }
     
-    // Note: Full JSON parsing not implemented in this minimal version.
-    // For production, integrate nlohmann/json or similar library.
-    // This would parse the JSON and use reflection to set field values.
-    
-    return false; // Not implemented yet
+    return ReadJson(typeName, instance, json, std::strlen(json));
 }
 
 extern "C" ENGINE_API bool Serialization_SaveToFile(const char* typeName, void* instance, 
@@ -49,22 +173,22 @@ extern "C" ENGINE_API bool Serialization_SaveToFile(const char* typeName, void*
         return false;
     }
     
-    try {
-        std::string json = SerializeObject(typeName, instance);
-        
-        std::ofstream file(filePath);
-        if (!file.is_open()) {
-            return false;
-        }
-        
-        file << json;
-        file.close();
-        
-        return true;
+    auto typeInfo = Chronicles::Reflection::ReflectionRegistry::Instance().GetType(typeName);
+    if (!typeInfo) {
+        return false;
     }
-    catch (...) {
+    
+    // Reused across saves, so repeated saves stop allocating once it has grown
+    static thread_local std::vector<char> arena;
+    JsonWriter writer(arena);
+    WriteObject(writer, *typeInfo, instance);
+    
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
         return false;
     }
+    file.write(writer.GetData(), static_cast<std::streamsize>(writer.GetLength()));
+    return static_cast<bool>(file);
 }
 
 extern "C" ENGINE_API bool Serialization_LoadFromFile(const char* typeName, void* instance,
@@ -73,22 +197,94 @@ extern "C" ENGINE_API bool Serialization_LoadFromFile(const char* typeName, void
         return false;
     }
     
-    try {
-        std::ifstream file(filePath);
-        if (!file.is_open()) {
-            return false;
-        }
-        
-        std::stringstream buffer;
-        buffer << file.rdbuf();
-        file.close();
-        
-        std::string json = buffer.str();
-        
-        // Note: Would call Serialization_FromJson here
-        return false; // Not fully implemented yet
+    // Parsed straight out of the mapping, with no copy of the file
+    Chronicles::MappedFile file;
+    if (!file.Open(filePath)) {
+        RecordError("Cannot open file");
+        return false;
+    }
+    file.Prefetch(0, file.GetSize());
+    
+    return ReadJson(typeName, instance, reinterpret_cast<const char*>(file.GetData()), file.GetSize());
+}
+
+extern "C" ENGINE_API bool Serialization_SaveBinaryFile(const char* typeName, void* instance,
+                                                        const char* filePath) {
+    if (!typeName || !instance || !filePath) {
+        return false;
+    }
+    
+    auto typeInfo = Chronicles::Reflection::ReflectionRegistry::Instance().GetType(typeName);
+    if (!typeInfo) {
+        return false;
+    }
+    
+    static thread_local std::vector<uint8_t> arena;
+    BinaryWriter writer(arena);
+    writer.WriteArray(GetBinaryLayout(*typeInfo), instance, typeInfo->GetSize(), 1);
+    
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(writer.GetData()), static_cast<std::streamsize>(writer.GetLength()));
+    return static_cast<bool>(file);
+}
+
+extern "C" ENGINE_API bool Serialization_LoadBinaryFile(const char* typeName, void* instance,
+                                                        const char* filePath) {
+    if (!typeName || !instance || !filePath) {
+        return false;
+    }
+    
+    Chronicles::MappedFile file;
+    if (!file.Open(filePath)) {
+        RecordError("Cannot open file");
+        return false;
     }
-    catch (...) {
+    if (file.GetSize() > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        RecordError("File too large");
         return false;
     }
+    
+    return ReadBinary(typeName, instance, 0, 1, file.GetData(), static_cast<int>(file.GetSize())) == 1;
+}
+
+extern "C" ENGINE_API int Serialization_ToBinary(const char* typeName, void* instance,
+                                                 void* buffer, int bufferSize) {
+    return WriteBinary(typeName, instance, 0, 1, buffer, bufferSize);
+}
+
+extern "C" ENGINE_API int Serialization_ToBinaryArray(const char* typeName, const void* instances,
+                                                      int stride, int count,
+                                                      void* buffer, int bufferSize) {
+    return WriteBinary(typeName, instances, stride, count, buffer, bufferSize);
+}
+
+extern "C" ENGINE_API bool Serialization_FromBinary(const char* typeName, void* instance,
+                                                    const void* data, int size) {
+    return ReadBinary(typeName, instance, 0, 1, data, size) == 1;
+}
+
+extern "C" ENGINE_API int Serialization_FromBinaryArray(const char* typeName, void* instances,
+                                                        int stride, int capacity,
+                                                        const void* data, int size) {
+    return ReadBinary(typeName, instances, stride, capacity, data, size);
+}
+
+extern "C" ENGINE_API unsigned int Serialization_GetSchemaHash(const char* typeName) {
+    if (!typeName) {
+        return 0;
+    }
+    
+    auto typeInfo = Chronicles::Reflection::ReflectionRegistry::Instance().GetType(typeName);
+    return typeInfo ? GetSchemaHash(*typeInfo) : 0;
+}
+
+extern "C" ENGINE_API const char* Serialization_GetLastError() {
+    return t_lastError;
+}
+
+extern "C" ENGINE_API int Serialization_GetLastErrorOffset() {
+    return t_lastErrorOffset;
 }
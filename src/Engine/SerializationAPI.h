@@ -11,24 +11,34 @@
 #endif
 
 // Chronicles of a Drifter - Serialization API for C# and Python
-// C-compatible API for serializing/deserializing objects
+// C-compatible API for serializing/deserializing objects as JSON or binary
 
 extern "C" {
     // ===== Serialization Functions =====
     
     /// <summary>
-    /// Serialize an object to JSON string
+    /// Serialize an object to indented JSON. Like snprintf, a return value &gt;= bufferSize
+    /// means the output was truncated: call again with a buffer of (return value + 1) bytes.
+    /// Passing a null buffer with size 0 just measures.
     /// </summary>
     /// <param name="typeName">Name of the type to serialize</param>
     /// <param name="instance">Pointer to object instance</param>
     /// <param name="buffer">Output buffer for JSON string</param>
     /// <param name="bufferSize">Size of output buffer</param>
-    /// <returns>Length of JSON string (excluding null terminator), or -1 on error</returns>
+    /// <returns>Length of the full JSON string (excluding null terminator), or -1 on error</returns>
     ENGINE_API int Serialization_ToJson(const char* typeName, void* instance, 
                                         char* buffer, int bufferSize);
     
     /// <summary>
-    /// Deserialize an object from JSON string
+    /// Same as Serialization_ToJson, without whitespace
+    /// </summary>
+    ENGINE_API int Serialization_ToJsonCompact(const char* typeName, void* instance,
+                                               char* buffer, int bufferSize);
+    
+    /// <summary>
+    /// Deserialize an object from JSON string. Keys that are not fields of the type are
+    /// ignored; on failure the object may be partially updated and
+    /// Serialization_GetLastError describes the problem.
     /// </summary>
     /// <param name="typeName">Name of the type to deserialize</param>
     /// <param name="instance">Pointer to object instance to populate</param>
@@ -44,8 +54,75 @@ extern "C" {
                                              const char* filePath);
     
     /// <summary>
-    /// Load object from JSON file
+    /// Load object from JSON file, parsing it in place from a memory mapping
     /// </summary>
     ENGINE_API bool Serialization_LoadFromFile(const char* typeName, void* instance,
                                                const char* filePath);
+    
+    // ===== Binary Format =====
+    // Little-endian packed records behind a header carrying a schema hash of the type
+    // (see BinarySerialization.h). Loading data written for a different version of the
+    // type fails instead of misreading it.
+    
+    /// <summary>
+    /// Serialize an object to the binary format. Like Serialization_ToJson, a return value
+    /// greater than bufferSize means the output did not fit; a null buffer with size 0 measures.
+    /// </summary>
+    /// <returns>Size of the full blob in bytes, or -1 on error</returns>
+    ENGINE_API int Serialization_ToBinary(const char* typeName, void* instance,
+                                          void* buffer, int bufferSize);
+    
+    /// <summary>
+    /// Serialize count objects laid out stride bytes apart (0 = the type's size) as one
+    /// length-prefixed blob. Tightly packed plain-data types are copied with a single memcpy.
+    /// </summary>
+    /// <returns>Size of the full blob in bytes, or -1 on error (including a stride smaller than the type)</returns>
+    ENGINE_API int Serialization_ToBinaryArray(const char* typeName, const void* instances,
+                                               int stride, int count,
+                                               void* buffer, int bufferSize);
+    
+    /// <summary>
+    /// Deserialize one object written by Serialization_ToBinary. Fails if the blob is
+    /// truncated or its schema hash does not match the type.
+    /// </summary>
+    ENGINE_API bool Serialization_FromBinary(const char* typeName, void* instance,
+                                             const void* data, int size);
+    
+    /// <summary>
+    /// Deserialize an array written by Serialization_ToBinaryArray into up to capacity
+    /// objects stride bytes apart (0 = the type's size)
+    /// </summary>
+    /// <returns>Number of objects read, or -1 on error (including more records than capacity
+    /// or a stride smaller than the type)</returns>
+    ENGINE_API int Serialization_FromBinaryArray(const char* typeName, void* instances,
+                                                 int stride, int capacity,
+                                                 const void* data, int size);
+    
+    /// <summary>
+    /// Save object to a binary file (same format as Serialization_ToBinary)
+    /// </summary>
+    ENGINE_API bool Serialization_SaveBinaryFile(const char* typeName, void* instance,
+                                                 const char* filePath);
+    
+    /// <summary>
+    /// Load object from a binary file, reading it in place from a memory mapping
+    /// </summary>
+    ENGINE_API bool Serialization_LoadBinaryFile(const char* typeName, void* instance,
+                                                 const char* filePath);
+    
+    /// <summary>
+    /// Schema hash stored in binary blobs of a type, or 0 if the type is unknown
+    /// </summary>
+    ENGINE_API unsigned int Serialization_GetSchemaHash(const char* typeName);
+    
+    /// <summary>
+    /// Why the last Serialization_FromJson/LoadFromFile/FromBinary/LoadBinaryFile on this thread failed
+    /// (e.g. "Expected ',' or '}' at byte 42"); empty after a success
+    /// </summary>
+    ENGINE_API const char* Serialization_GetLastError();
+    
+    /// <summary>
+    /// Byte offset in the input where the last parse on this thread failed, or -1
+    /// </summary>
+    ENGINE_API int Serialization_GetLastErrorOffset();
 }
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+
+// Chronicles of a Drifter - Shared-Memory Frame Ring
+// Single-producer/single-consumer ring of variable-size frames living in memory shared
+// between two processes. Unlike SpscRing it owns nothing: both sides attach a view to the
+// same bytes (header followed by the data area), so indices are plain offsets and
+// frames can be read in place without copying.
+//
+// Frame layout: u32 payload size | u32 requestId | u16 type | u16 reserved | payload,
+// padded to 8 bytes. A frame never wraps; a size of WrapMarker sends the reader back to
+// the start of the data area.
+
+namespace Chronicles {
+
+struct SharedRingHeader {
+    alignas(64) std::atomic<uint64_t> head;           // Bytes ever written (producer)
+    alignas(64) std::atomic<uint64_t> tail;           // Bytes ever consumed (consumer)
+    alignas(64) std::atomic<uint32_t> readerWaiting;  // Consumer is about to sleep; producer must wake it
+    uint32_t capacity;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+              "Shared ring indices must be lock-free to work across processes");
+
+class SharedMemoryRing {
+public:
+    static constexpr size_t FrameHeaderSize = 12;
+    static constexpr uint32_t WrapMarker = 0xFFFFFFFFu;
+    
+    /// <summary>
+    /// Bytes needed for a ring with the given data capacity (a power of two)
+    /// </summary>
+    static size_t RegionSize(uint32_t capacity) {
+        return sizeof(SharedRingHeader) + capacity;
+    }
+    
+    /// <summary>
+    /// Set up a ring in fresh memory. Only the side that creates the region calls this.
+    /// </summary>
+    static void Initialize(void* memory, uint32_t capacity) {
+        auto* header = new (memory) SharedRingHeader();
+        header->head.store(0, std::memory_order_relaxed);
+        header->tail.store(0, std::memory_order_relaxed);
+        header->readerWaiting.store(0, std::memory_order_relaxed);
+        header->capacity = capacity;
+    }
+    
+    /// <summary>
+    /// Attach to an initialized ring of size bytes; false if the header does not fit it
+    /// </summary>
+    bool Attach(void* memory, size_t size) {
+        if (size < sizeof(SharedRingHeader)) {
+            return false;
+        }
+        auto* header = static_cast<SharedRingHeader*>(memory);
+        const uint32_t capacity = header->capacity;
+        if (capacity < 64 || (capacity & (capacity - 1)) != 0 || RegionSize(capacity) > size) {
+            return false;
+        }
+        m_header = header;
+        m_data = static_cast<uint8_t*>(memory) + sizeof(SharedRingHeader);
+        m_capacity = capacity;
+        m_cachedHead = header->head.load(std::memory_order_acquire);
+        m_cachedTail = header->tail.load(std::memory_order_acquire);
+        return true;
+    }
+    
+    bool IsAttached() const { return m_header != nullptr; }
+    
+    /// <summary>
+    /// Largest payload TryWrite can ever accept
+    /// </summary>
+    size_t MaxPayload() const {
+        return m_capacity / 2 - FrameHeaderSize;
+    }
+    
+    /// <summary>
+    /// Producer only: append a frame; false if there is not enough free space right now
+    /// </summary>
+    bool TryWrite(uint16_t type, uint32_t requestId, const void* payload, size_t size) {
+        if (size > MaxPayload()) {
+            return false;
+        }
+        const uint64_t frameSize = PaddedSize(size);
+        uint64_t head = m_header->head.load(std::memory_order_relaxed);
+        const uint64_t offset = head & (m_capacity - 1);
+        const uint64_t skip = offset + frameSize > m_capacity ? m_capacity - offset : 0;
+        
+        if (head + skip + frameSize - m_cachedTail > m_capacity) {
+            m_cachedTail = m_header->tail.load(std::memory_order_acquire);
+            if (head + skip + frameSize - m_cachedTail > m_capacity) {
+                return false;
+            }
+        }
+        
+        if (skip > 0) {
+            PutU32(m_data + offset, WrapMarker);
+            head += skip;
+        }
+        uint8_t* frame = m_data + (head & (m_capacity - 1));
+        PutU32(frame, static_cast<uint32_t>(size));
+        PutU32(frame + 4, requestId);
+        PutU32(frame + 8, type);
+        if (size > 0) {
+            std::memcpy(frame + FrameHeaderSize, payload, size);
+        }
+        m_header->head.store(head + frameSize, std::memory_order_release);
+        return true;
+    }
+    
+    /// <summary>
+    /// Consumer only: hand up to maxFrames frames to visit(type, requestId, payload, size)
+    /// in order, reading them in place. The producer is another process and may be buggy,
+    /// so every frame is checked against the data area and the published head first.
+    /// Returns false, consuming nothing further, on a malformed frame; the ring is then
+    /// unusable and the connection should be dropped.
+    /// </summary>
+    template<typename Visitor>
+    bool Read(Visitor&& visit, size_t maxFrames = SIZE_MAX) {
+        uint64_t tail = m_header->tail.load(std::memory_order_relaxed);
+        size_t count = 0;
+        bool valid = true;
+        while (count < maxFrames) {
+            if (tail == m_cachedHead) {
+                m_cachedHead = m_header->head.load(std::memory_order_acquire);
+                if (tail == m_cachedHead) {
+                    break;
+                }
+            }
+            const uint64_t offset = tail & (m_capacity - 1);
+            if (m_cachedHead - tail > m_capacity || (offset & 7) != 0) {
+                valid = false;
+                break;
+            }
+            const uint8_t* frame = m_data + offset;
+            const uint32_t size = GetU32(frame);
+            if (size == WrapMarker) {
+                const uint64_t skip = m_capacity - offset;
+                if (m_cachedHead - tail < skip) {
+                    valid = false;
+                    break;
+                }
+                tail += skip;
+                continue;
+            }
+            const uint64_t frameSize = size <= MaxPayload() ? PaddedSize(size) : UINT64_MAX;
+            if (frameSize > m_capacity - offset || frameSize > m_cachedHead - tail) {
+                valid = false;
+                break;
+            }
+            visit(static_cast<uint16_t>(GetU32(frame + 8)), GetU32(frame + 4),
+                  reinterpret_cast<const char*>(frame + FrameHeaderSize), static_cast<size_t>(size));
+            tail += frameSize;
+            // Publish per frame so a producer waiting for space can continue
+            m_header->tail.store(tail, std::memory_order_release);
+            count++;
+        }
+        m_header->tail.store(tail, std::memory_order_release);
+        return valid;
+    }
+    
+    bool IsEmpty() const {
+        return m_header->tail.load(std::memory_order_relaxed) == m_header->head.load(std::memory_order_acquire);
+    }
+    
+    /// <summary>
+    /// Consumer: announce that it is about to sleep. Returns false if frames arrived in the
+    /// meantime (do not sleep). On true, sleep until the producer signals, then call EndWait.
+    /// </summary>
+    bool BeginWait() {
+        m_header->readerWaiting.store(1, std::memory_order_relaxed);
+        // Pairs with the fence in ShouldWake: either we see the new head or it sees the flag
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!IsEmpty()) {
+            m_header->readerWaiting.store(0, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+    
+    void EndWait() {
+        m_header->readerWaiting.store(0, std::memory_order_relaxed);
+    }
+    
+    /// <summary>
+    /// Producer, after writing: true if the consumer is asleep and must be signalled.
+    /// Consumers that keep polling never ask, so streaming costs no system calls.
+    /// </summary>
+    bool ShouldWake() {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return m_header->readerWaiting.load(std::memory_order_relaxed) != 0 &&
+               m_header->readerWaiting.exchange(0, std::memory_order_relaxed) != 0;
+    }
+
+private:
+    static uint64_t PaddedSize(size_t payloadSize) {
+        return (FrameHeaderSize + payloadSize + 7) & ~static_cast<uint64_t>(7);
+    }
+    
+    static void PutU32(uint8_t* out, uint32_t value) {
+        std::memcpy(out, &value, sizeof(value));
+    }
+    
+    static uint32_t GetU32(const uint8_t* in) {
+        uint32_t value;
+        std::memcpy(&value, in, sizeof(value));
+        return value;
+    }
+    
+    SharedRingHeader* m_header = nullptr;
+    uint8_t* m_data = nullptr;
+    uint32_t m_capacity = 0;
+    uint64_t m_cachedHead = 0;   // Consumer's copy of head
+    uint64_t m_cachedTail = 0;   // Producer's copy of tail
+};
+
+} // namespace Chronicles
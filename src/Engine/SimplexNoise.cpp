@@ -0,0 +1,203 @@
+#include "SimplexNoise.h"
+#include <cstring>
+
+using namespace Chronicles::Noise;
+
+namespace {
+    // Ken Perlin's reference permutation (used when seed == 0)
+    const uint8_t PermOriginal[256] = {
+        151, 160, 137, 91, 90, 15, 131, 13, 201, 95, 96, 53, 194, 233, 7, 225,
+        140, 36, 103, 30, 69, 142, 8, 99, 37, 240, 21, 10, 23, 190, 6, 148,
+        247, 120, 234, 75, 0, 26, 197, 62, 94, 252, 219, 203, 117, 35, 11, 32,
+        57, 177, 33, 88, 237, 149, 56, 87, 174, 20, 125, 136, 171, 168, 68, 175,
+        74, 165, 71, 134, 139, 48, 27, 166, 77, 146, 158, 231, 83, 111, 229, 122,
+        60, 211, 133, 230, 220, 105, 92, 41, 55, 46, 245, 40, 244, 102, 143, 54,
+        65, 25, 63, 161, 1, 216, 80, 73, 209, 76, 132, 187, 208, 89, 18, 169,
+        200, 196, 135, 130, 116, 188, 159, 86, 164, 100, 109, 198, 173, 186, 3, 64,
+        52, 217, 226, 250, 124, 123, 5, 202, 38, 147, 118, 126, 255, 82, 85, 212,
+        207, 206, 59, 227, 47, 16, 58, 17, 182, 189, 28, 42, 223, 183, 170, 213,
+        119, 248, 152, 2, 44, 154, 163, 70, 221, 153, 101, 155, 167, 43, 172, 9,
+        129, 22, 39, 253, 19, 98, 108, 110, 79, 113, 224, 232, 178, 185, 112, 104,
+        218, 246, 97, 228, 251, 34, 242, 193, 238, 210, 144, 12, 191, 179, 162, 241,
+        81, 51, 145, 235, 249, 14, 239, 107, 49, 192, 214, 31, 181, 199, 106, 157,
+        184, 84, 204, 176, 115, 121, 50, 45, 127, 4, 150, 254, 138, 236, 205, 93,
+        222, 114, 67, 29, 24, 72, 243, 141, 128, 195, 78, 66, 215, 61, 156, 180
+    };
+
+    // Seeded System.Random (Knuth subtractive generator) as used by .NET for
+    // explicit seeds. Arithmetic wraps like unchecked C# int math.
+    class LegacyRandom {
+    public:
+        explicit LegacyRandom(int32_t seed) {
+            const int32_t MBig = 0x7FFFFFFF;
+            const int32_t MSeed = 161803398;
+
+            int32_t subtraction = (seed == INT32_MIN) ? MBig : (seed < 0 ? -seed : seed);
+            int32_t mj = MSeed - subtraction;
+            m_seedArray[55] = mj;
+            int32_t mk = 1;
+            int ii = 0;
+            for (int i = 1; i < 55; i++) {
+                if ((ii += 21) >= 55) ii -= 55;
+                m_seedArray[ii] = mk;
+                mk = mj - mk;
+                if (mk < 0) mk += MBig;
+                mj = m_seedArray[ii];
+            }
+            for (int k = 1; k < 5; k++) {
+                for (int i = 1; i < 56; i++) {
+                    int n = i + 30;
+                    if (n >= 55) n -= 55;
+                    m_seedArray[i] = Wrap(static_cast<int64_t>(m_seedArray[i]) - m_seedArray[1 + n]);
+                    if (m_seedArray[i] < 0) m_seedArray[i] += MBig;
+                }
+            }
+            m_inext = 0;
+            m_inextp = 21;
+        }
+
+        int32_t InternalSample() {
+            int locINext = m_inext;
+            int locINextp = m_inextp;
+            if (++locINext >= 56) locINext = 1;
+            if (++locINextp >= 56) locINextp = 1;
+
+            int32_t retVal = Wrap(static_cast<int64_t>(m_seedArray[locINext]) - m_seedArray[locINextp]);
+            if (retVal == 0x7FFFFFFF) retVal--;
+            if (retVal < 0) retVal += 0x7FFFFFFF;
+
+            m_seedArray[locINext] = retVal;
+            m_inext = locINext;
+            m_inextp = locINextp;
+            return retVal;
+        }
+
+        void NextBytes(uint8_t* buffer, size_t length) {
+            for (size_t i = 0; i < length; i++) {
+                buffer[i] = static_cast<uint8_t>(InternalSample());
+            }
+        }
+
+    private:
+        static int32_t Wrap(int64_t value) {
+            return static_cast<int32_t>(static_cast<uint32_t>(value));
+        }
+
+        int32_t m_seedArray[56] = {};
+        int m_inext;
+        int m_inextp;
+    };
+
+    inline int FastFloor(float x) {
+        return (x > 0) ? static_cast<int>(x) : static_cast<int>(x) - 1;
+    }
+
+    inline int Mod(int x, int m) {
+        int a = x % m;
+        return a < 0 ? a + m : a;
+    }
+
+    inline float Grad(int hash, float x) {
+        int h = hash & 15;
+        float grad = 1.0f + (h & 7);  // Gradient value 1.0, 2.0, ..., 8.0
+        if ((h & 8) != 0) grad = -grad;
+        return grad * x;
+    }
+
+    inline float Grad(int hash, float x, float y) {
+        int h = hash & 7;
+        float u = h < 4 ? x : y;
+        float v = h < 4 ? y : x;
+        return ((h & 1) != 0 ? -u : u) + ((h & 2) != 0 ? -2.0f * v : 2.0f * v);
+    }
+}
+
+// ===== SimplexNoise Implementation =====
+
+SimplexNoise::SimplexNoise(int32_t seed)
+    : m_seed(seed) {
+    if (seed == 0) {
+        std::memcpy(m_perm, PermOriginal, 256);
+        std::memcpy(m_perm + 256, PermOriginal, 256);
+    } else {
+        LegacyRandom random(seed);
+        random.NextBytes(m_perm, sizeof(m_perm));
+    }
+    for (int i = 0; i < 512; i++) {
+        m_perm32[i] = m_perm[i];
+    }
+}
+
+float SimplexNoise::Generate(float x) const {
+    int i0 = FastFloor(x);
+    int i1 = i0 + 1;
+    float x0 = x - i0;
+    float x1 = x0 - 1.0f;
+
+    float t0 = 1.0f - x0 * x0;
+    t0 *= t0;
+    float n0 = t0 * t0 * Grad(m_perm[i0 & 0xff], x0);
+
+    float t1 = 1.0f - x1 * x1;
+    t1 *= t1;
+    float n1 = t1 * t1 * Grad(m_perm[i1 & 0xff], x1);
+
+    // The maximum value of this noise is 8*(3/4)^4 = 2.53125;
+    // 0.395 scales it to fit within [-1, 1]
+    return 0.395f * (n0 + n1);
+}
+
+float SimplexNoise::Generate(float x, float y) const {
+    const float F2 = 0.366025403f;  // 0.5 * (sqrt(3) - 1)
+    const float G2 = 0.211324865f;  // (3 - sqrt(3)) / 6
+
+    float n0, n1, n2;
+
+    // Skew the input space to find the simplex cell
+    float s = (x + y) * F2;
+    float xs = x + s;
+    float ys = y + s;
+    int i = FastFloor(xs);
+    int j = FastFloor(ys);
+
+    float t = static_cast<float>(i + j) * G2;
+    float X0 = i - t;
+    float Y0 = j - t;
+    float x0 = x - X0;
+    float y0 = y - Y0;
+
+    int i1, j1;
+    if (x0 > y0) { i1 = 1; j1 = 0; }
+    else { i1 = 0; j1 = 1; }
+
+    float x1 = x0 - i1 + G2;
+    float y1 = y0 - j1 + G2;
+    float x2 = x0 - 1.0f + 2.0f * G2;
+    float y2 = y0 - 1.0f + 2.0f * G2;
+
+    int ii = Mod(i, 256);
+    int jj = Mod(j, 256);
+
+    float t0 = 0.5f - x0 * x0 - y0 * y0;
+    if (t0 < 0.0f) n0 = 0.0f;
+    else {
+        t0 *= t0;
+        n0 = t0 * t0 * Grad(m_perm[ii + m_perm[jj]], x0, y0);
+    }
+
+    float t1 = 0.5f - x1 * x1 - y1 * y1;
+    if (t1 < 0.0f) n1 = 0.0f;
+    else {
+        t1 *= t1;
+        n1 = t1 * t1 * Grad(m_perm[ii + i1 + m_perm[jj + j1]], x1, y1);
+    }
+
+    float t2 = 0.5f - x2 * x2 - y2 * y2;
+    if (t2 < 0.0f) n2 = 0.0f;
+    else {
+        t2 *= t2;
+        n2 = t2 * t2 * Grad(m_perm[ii + 1 + m_perm[jj + 1]], x2, y2);
+    }
+
+    return 40.0f * (n0 + n1 + n2);
+}
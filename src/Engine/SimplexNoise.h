@@ -0,0 +1,110 @@
+#pragma once
+
+#include "EngineExport.h"
+#include <cstdint>
+
+// Chronicles of a Drifter - Simplex Noise
+// Native port of the SimplexNoise 2.0.0 package used by the managed world generator.
+// Results are bit-identical to SimplexNoise.Noise for the same seed, so native and
+// managed generation produce the same worlds. Requires strict IEEE float math
+// (no -ffast-math, no FMA contraction).
+
+namespace Chronicles {
+namespace Noise {
+
+/// <summary>
+/// Instruction set used by the batch kernels. Every level produces identical results.
+/// </summary>
+enum class SimdLevel : int {
+    Scalar = 0,
+    SSE2 = 1,
+    AVX2 = 2
+};
+
+/// <summary>
+/// Best level supported by this CPU and OS (detected once via CPUID)
+/// </summary>
+SimdLevel DetectSimdLevel();
+
+/// <summary>
+/// Level currently used by the batch functions
+/// </summary>
+SimdLevel GetSimdLevel();
+
+/// <summary>
+/// Override the batch level (clamped to what the CPU supports); returns the level applied
+/// </summary>
+SimdLevel SetSimdLevel(SimdLevel level);
+
+class SimplexNoise {
+public:
+    /// <summary>
+    /// Create a noise generator. Seed 0 uses Ken Perlin's reference permutation;
+    /// any other seed fills the permutation like SimplexNoise.Noise.Seed does.
+    /// </summary>
+    explicit SimplexNoise(int32_t seed = 0);
+
+    int32_t GetSeed() const { return m_seed; }
+
+    // Raw noise in [-1, 1]
+    float Generate(float x) const;
+    float Generate(float x, float y) const;
+
+    // Pixel helpers matching Noise.CalcPixel1D / CalcPixel2D (range 0-255)
+    float CalcPixel1D(int32_t x, float scale) const {
+        return Generate(static_cast<float>(x) * scale) * 128 + 128;
+    }
+
+    float CalcPixel2D(int32_t x, int32_t y, float scale) const {
+        return Generate(static_cast<float>(x) * scale, static_cast<float>(y) * scale) * 128 + 128;
+    }
+
+    /// <summary>
+    /// Batch CalcPixel1D: out[i] = CalcPixel1D(startX + i * step, scale)
+    /// </summary>
+    void CalcPixel1DBatch(int32_t startX, int32_t step, int count, float scale, float* out) const;
+
+    /// <summary>
+    /// Batch CalcPixel2D over a grid, row-major:
+    /// out[row * width + col] = CalcPixel2D(startX + col * step, startY + row * step, scale)
+    /// </summary>
+    void CalcPixel2DBatch(int32_t startX, int32_t startY, int32_t step, int width, int height,
+                          float scale, float* out) const;
+
+private:
+    int32_t m_seed;
+    uint8_t m_perm[512];
+    int32_t m_perm32[512];  // Widened copy for AVX2 gathers
+};
+
+} // namespace Noise
+} // namespace Chronicles
+
+// C API for cross-language access
+extern "C" {
+    /// <summary>
+    /// Reseed the shared noise generator used by the batch exports (like SimplexNoise.Noise.Seed)
+    /// </summary>
+    ENGINE_API void Noise_SetSeed(int seed);
+    
+    /// <summary>
+    /// Evaluate count samples of 1D pixel noise (0-255) at x = startX + i * step
+    /// </summary>
+    ENGINE_API void Noise_CalcPixel1DBatch(int startX, int step, int count, float scale, float* out);
+    
+    /// <summary>
+    /// Evaluate a width x height grid of 2D pixel noise (0-255), row-major
+    /// </summary>
+    ENGINE_API void Noise_CalcPixel2DBatch(int startX, int startY, int step, int width, int height,
+                                           float scale, float* out);
+    
+    /// <summary>
+    /// Get the active batch instruction set (0 = scalar, 1 = SSE2, 2 = AVX2)
+    /// </summary>
+    ENGINE_API int Noise_GetSimdLevel();
+    
+    /// <summary>
+    /// Force the batch instruction set (clamped to CPU support); returns the level applied
+    /// </summary>
+    ENGINE_API int Noise_SetSimdLevel(int level);
+}
@@ -0,0 +1,425 @@
+#include "SimplexNoise.h"
+#include <atomic>
+#include <memory>
+
+// Batch noise kernels. Each SIMD kernel performs exactly the same IEEE operations,
+// in the same order, as the scalar SimplexNoise::Generate, so every level returns
+// bit-identical results. Lanes that do not fill a full vector use the scalar path.
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define CHRONICLES_NOISE_X86 1
+    #include <immintrin.h>
+    #ifdef _MSC_VER
+        #include <intrin.h>
+        #define CHRONICLES_TARGET_AVX2
+    #else
+        #include <cpuid.h>
+        #define CHRONICLES_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#endif
+
+using namespace Chronicles::Noise;
+
+namespace {
+    const float F2 = 0.366025403f;
+    const float G2 = 0.211324865f;
+    
+    SimdLevel QueryCpu() {
+#ifdef CHRONICLES_NOISE_X86
+    #ifdef _MSC_VER
+        int info[4];
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+        __cpuid(info, 1);
+        bool sse2 = (info[3] & (1 << 26)) != 0;
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        bool avx2 = false;
+        if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 6) == 6) {
+            __cpuidex(info, 7, 0);
+            avx2 = (info[1] & (1 << 5)) != 0;
+        }
+    #else
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+            return SimdLevel::Scalar;
+        }
+        bool sse2 = (edx & (1u << 26)) != 0;
+        bool osxsave = (ecx & (1u << 27)) != 0;
+        bool avx = (ecx & (1u << 28)) != 0;
+        bool avx2 = false;
+        if (osxsave && avx) {
+            // XCR0 must have XMM and YMM state enabled by the OS
+            unsigned int xcr0Low, xcr0High;
+            __asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+            if ((xcr0Low & 6) == 6 && __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+                avx2 = (ebx & (1u << 5)) != 0;
+            }
+        }
+    #endif
+        if (avx2) return SimdLevel::AVX2;
+        if (sse2) return SimdLevel::SSE2;
+#endif
+        return SimdLevel::Scalar;
+    }
+    
+    std::atomic<int>& ActiveLevel() {
+        static std::atomic<int> level(static_cast<int>(DetectSimdLevel()));
+        return level;
+    }
+    
+    std::unique_ptr<SimplexNoise> g_sharedNoise;
+    
+    SimplexNoise& SharedNoise() {
+        if (!g_sharedNoise) {
+            g_sharedNoise = std::make_unique<SimplexNoise>(0);
+        }
+        return *g_sharedNoise;
+    }
+
+#ifdef CHRONICLES_NOISE_X86
+    // ===== SSE2 (4 lanes) =====
+    
+    inline __m128i FastFloor4(__m128 x) {
+        // (x > 0) ? (int)x : (int)x - 1
+        __m128i truncated = _mm_cvttps_epi32(x);
+        __m128i positive = _mm_castps_si128(_mm_cmpgt_ps(x, _mm_setzero_ps()));
+        return _mm_sub_epi32(truncated, _mm_andnot_si128(positive, _mm_set1_epi32(1)));
+    }
+    
+    inline __m128 Select4(__m128 mask, __m128 a, __m128 b) {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+    
+    inline __m128i Lookup4(const uint8_t* perm, __m128i index) {
+        alignas(16) int32_t lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), index);
+        return _mm_set_epi32(perm[lanes[3]], perm[lanes[2]], perm[lanes[1]], perm[lanes[0]]);
+    }
+    
+    inline __m128 Grad1D4(__m128i hash, __m128 x) {
+        __m128i h = _mm_and_si128(hash, _mm_set1_epi32(15));
+        __m128 grad = _mm_add_ps(_mm_set1_ps(1.0f), _mm_cvtepi32_ps(_mm_and_si128(h, _mm_set1_epi32(7))));
+        __m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(8)), 28);
+        grad = _mm_xor_ps(grad, _mm_castsi128_ps(sign));
+        return _mm_mul_ps(grad, x);
+    }
+    
+    inline __m128 Grad2D4(__m128i hash, __m128 x, __m128 y) {
+        __m128i h = _mm_and_si128(hash, _mm_set1_epi32(7));
+        __m128 low = _mm_castsi128_ps(_mm_cmplt_epi32(h, _mm_set1_epi32(4)));
+        __m128 u = Select4(low, x, y);
+        __m128 v = Select4(low, y, x);
+        __m128i signU = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(1)), 31);
+        __m128i signV = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(2)), 30);
+        u = _mm_xor_ps(u, _mm_castsi128_ps(signU));
+        v = _mm_xor_ps(_mm_mul_ps(_mm_set1_ps(2.0f), v), _mm_castsi128_ps(signV));
+        return _mm_add_ps(u, v);
+    }
+    
+    inline __m128 Pixel1D4(const uint8_t* perm, __m128i xi, __m128 scale) {
+        __m128 x = _mm_mul_ps(_mm_cvtepi32_ps(xi), scale);
+        __m128i i0 = FastFloor4(x);
+        __m128i i1 = _mm_add_epi32(i0, _mm_set1_epi32(1));
+        __m128 x0 = _mm_sub_ps(x, _mm_cvtepi32_ps(i0));
+        __m128 x1 = _mm_sub_ps(x0, _mm_set1_ps(1.0f));
+        
+        __m128i mask = _mm_set1_epi32(0xff);
+        __m128 t0 = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(x0, x0));
+        t0 = _mm_mul_ps(t0, t0);
+        __m128 n0 = _mm_mul_ps(_mm_mul_ps(t0, t0), Grad1D4(Lookup4(perm, _mm_and_si128(i0, mask)), x0));
+        
+        __m128 t1 = _mm_sub_ps(_mm_set1_ps(1.0f), _mm_mul_ps(x1, x1));
+        t1 = _mm_mul_ps(t1, t1);
+        __m128 n1 = _mm_mul_ps(_mm_mul_ps(t1, t1), Grad1D4(Lookup4(perm, _mm_and_si128(i1, mask)), x1));
+        
+        __m128 noise = _mm_mul_ps(_mm_set1_ps(0.395f), _mm_add_ps(n0, n1));
+        return _mm_add_ps(_mm_mul_ps(noise, _mm_set1_ps(128.0f)), _mm_set1_ps(128.0f));
+    }
+    
+    inline __m128 Corner2D4(__m128 x, __m128 y, __m128i hash) {
+        __m128 t = _mm_sub_ps(_mm_sub_ps(_mm_set1_ps(0.5f), _mm_mul_ps(x, x)), _mm_mul_ps(y, y));
+        __m128 inside = _mm_cmpge_ps(t, _mm_setzero_ps());
+        t = _mm_mul_ps(t, t);
+        __m128 n = _mm_mul_ps(_mm_mul_ps(t, t), Grad2D4(hash, x, y));
+        return _mm_and_ps(inside, n);
+    }
+    
+    inline __m128 Pixel2D4(const uint8_t* perm, __m128i xi, __m128 y, __m128 scale) {
+        __m128 x = _mm_mul_ps(_mm_cvtepi32_ps(xi), scale);
+        
+        __m128 s = _mm_mul_ps(_mm_add_ps(x, y), _mm_set1_ps(F2));
+        __m128i i = FastFloor4(_mm_add_ps(x, s));
+        __m128i j = FastFloor4(_mm_add_ps(y, s));
+        
+        __m128 t = _mm_mul_ps(_mm_cvtepi32_ps(_mm_add_epi32(i, j)), _mm_set1_ps(G2));
+        __m128 x0 = _mm_sub_ps(x, _mm_sub_ps(_mm_cvtepi32_ps(i), t));
+        __m128 y0 = _mm_sub_ps(y, _mm_sub_ps(_mm_cvtepi32_ps(j), t));
+        
+        __m128i upper = _mm_castps_si128(_mm_cmpgt_ps(x0, y0));
+        __m128i i1 = _mm_and_si128(upper, _mm_set1_epi32(1));
+        __m128i j1 = _mm_andnot_si128(upper, _mm_set1_epi32(1));
+        
+        __m128 g2 = _mm_set1_ps(G2);
+        __m128 x1 = _mm_add_ps(_mm_sub_ps(x0, _mm_cvtepi32_ps(i1)), g2);
+        __m128 y1 = _mm_add_ps(_mm_sub_ps(y0, _mm_cvtepi32_ps(j1)), g2);
+        __m128 x2 = _mm_add_ps(_mm_sub_ps(x0, _mm_set1_ps(1.0f)), _mm_set1_ps(2.0f * G2));
+        __m128 y2 = _mm_add_ps(_mm_sub_ps(y0, _mm_set1_ps(1.0f)), _mm_set1_ps(2.0f * G2));
+        
+        __m128i mask = _mm_set1_epi32(0xff);
+        __m128i one = _mm_set1_epi32(1);
+        __m128i ii = _mm_and_si128(i, mask);
+        __m128i jj = _mm_and_si128(j, mask);
+        
+        __m128i h0 = Lookup4(perm, _mm_add_epi32(ii, Lookup4(perm, jj)));
+        __m128i h1 = Lookup4(perm, _mm_add_epi32(_mm_add_epi32(ii, i1), Lookup4(perm, _mm_add_epi32(jj, j1))));
+        __m128i h2 = Lookup4(perm, _mm_add_epi32(_mm_add_epi32(ii, one), Lookup4(perm, _mm_add_epi32(jj, one))));
+        
+        __m128 n = _mm_add_ps(_mm_add_ps(Corner2D4(x0, y0, h0), Corner2D4(x1, y1, h1)), Corner2D4(x2, y2, h2));
+        __m128 noise = _mm_mul_ps(_mm_set1_ps(40.0f), n);
+        return _mm_add_ps(_mm_mul_ps(noise, _mm_set1_ps(128.0f)), _mm_set1_ps(128.0f));
+    }
+    
+    int Pixel1DBatchSSE2(const uint8_t* perm, int32_t startX, int32_t step, int count, float scale, float* out) {
+        __m128 scale4 = _mm_set1_ps(scale);
+        __m128i laneOffsets = _mm_set_epi32(3 * step, 2 * step, step, 0);
+        int i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128i xi = _mm_add_epi32(_mm_set1_epi32(startX + i * step), laneOffsets);
+            _mm_storeu_ps(out + i, Pixel1D4(perm, xi, scale4));
+        }
+        return i;
+    }
+    
+    int Pixel2DRowSSE2(const uint8_t* perm, int32_t startX, int32_t y, int32_t step, int width, float scale, float* out) {
+        __m128 scale4 = _mm_set1_ps(scale);
+        __m128 y4 = _mm_set1_ps(static_cast<float>(y) * scale);
+        __m128i laneOffsets = _mm_set_epi32(3 * step, 2 * step, step, 0);
+        int i = 0;
+        for (; i + 4 <= width; i += 4) {
+            __m128i xi = _mm_add_epi32(_mm_set1_epi32(startX + i * step), laneOffsets);
+            _mm_storeu_ps(out + i, Pixel2D4(perm, xi, y4, scale4));
+        }
+        return i;
+    }
+    
+    // ===== AVX2 (8 lanes) =====
+    
+    CHRONICLES_TARGET_AVX2 inline __m256i FastFloor8(__m256 x) {
+        __m256i truncated = _mm256_cvttps_epi32(x);
+        __m256i positive = _mm256_castps_si256(_mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_GT_OQ));
+        return _mm256_sub_epi32(truncated, _mm256_andnot_si256(positive, _mm256_set1_epi32(1)));
+    }
+    
+    CHRONICLES_TARGET_AVX2 inline __m256i Lookup8(const int32_t* perm32, __m256i index) {
+        return _mm256_i32gather_epi32(perm32, index, 4);
+    }
+    
+    CHRONICLES_TARGET_AVX2 inline __m256 Grad1D8(__m256i hash, __m256 x) {
+        __m256i h = _mm256_and_si256(hash, _mm256_set1_epi32(15));
+        __m256 grad = _mm256_add_ps(_mm256_set1_ps(1.0f),
+                                    _mm256_cvtepi32_ps(_mm256_and_si256(h, _mm256_set1_epi32(7))));
+        __m256i sign = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(8)), 28);
+        grad = _mm256_xor_ps(grad, _mm256_castsi256_ps(sign));
+        return _mm256_mul_ps(grad, x);
+    }
+    
+    CHRONICLES_TARGET_AVX2 inline __m256 Grad2D8(__m256i hash, __m256 x, __m256 y) {
+        __m256i h = _mm256_and_si256(hash, _mm256_set1_epi32(7));
+        __m256 high = _mm256_castsi256_ps(_mm256_cmpgt_epi32(h, _mm256_set1_epi32(3)));
+        __m256 u = _mm256_blendv_ps(x, y, high);
+        __m256 v = _mm256_blendv_ps(y, x, high);
+        __m256i signU = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(1)), 31);
+        __m256i signV = _mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(2)), 30);
+        u = _mm256_xor_ps(u, _mm256_castsi256_ps(signU));
+        v = _mm256_xor_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), v), _mm256_castsi256_ps(signV));
+        return _mm256_add_ps(u, v);
+    }
+    
+    CHRONICLES_TARGET_AVX2 inline __m256 Pixel1D8(const int32_t* perm32, __m256i xi, __m256 scale) {
+        __m256 x = _mm256_mul_ps(_mm256_cvtepi32_ps(xi), scale);
+        __m256i i0 = FastFloor8(x);
+        __m256i i1 = _mm256_add_epi32(i0, _mm256_set1_epi32(1));
+        __m256 x0 = _mm256_sub_ps(x, _mm256_cvtepi32_ps(i0));
+        __m256 x1 = _mm256_sub_ps(x0, _mm256_set1_ps(1.0f));
+        
+        __m256i mask = _mm256_set1_epi32(0xff);
+        __m256 t0 = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(x0, x0));
+        t0 = _mm256_mul_ps(t0, t0);
+        __m256 n0 = _mm256_mul_ps(_mm256_mul_ps(t0, t0),
+                                  Grad1D8(Lookup8(perm32, _mm256_and_si256(i0, mask)), x0));
+        
+        __m256 t1 = _mm256_sub_ps(_mm256_set1_ps(1.0f), _mm256_mul_ps(x1, x1));
+        t1 = _mm256_mul_ps(t1, t1);
+        __m256 n1 = _mm256_mul_ps(_mm256_mul_ps(t1, t1),
+                                  Grad1D8(Lookup8(perm32, _mm256_and_si256(i1, mask)), x1));
+        
+        __m256 noise = _mm256_mul_ps(_mm256_set1_ps(0.395f), _mm256_add_ps(n0, n1));
+        return _mm256_add_ps(_mm256_mul_ps(noise, _mm256_set1_ps(128.0f)), _mm256_set1_ps(128.0f));
+    }
+    
+    CHRONICLES_TARGET_AVX2 inline __m256 Corner2D8(__m256 x, __m256 y, __m256i hash) {
+        __m256 t = _mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(0.5f), _mm256_mul_ps(x, x)), _mm256_mul_ps(y, y));
+        __m256 inside = _mm256_cmp_ps(t, _mm256_setzero_ps(), _CMP_GE_OQ);
+        t = _mm256_mul_ps(t, t);
+        __m256 n = _mm256_mul_ps(_mm256_mul_ps(t, t), Grad2D8(hash, x, y));
+        return _mm256_and_ps(inside, n);
+    }
+    
+    CHRONICLES_TARGET_AVX2 inline __m256 Pixel2D8(const int32_t* perm32, __m256i xi, __m256 y, __m256 scale) {
+        __m256 x = _mm256_mul_ps(_mm256_cvtepi32_ps(xi), scale);
+        
+        __m256 s = _mm256_mul_ps(_mm256_add_ps(x, y), _mm256_set1_ps(F2));
+        __m256i i = FastFloor8(_mm256_add_ps(x, s));
+        __m256i j = FastFloor8(_mm256_add_ps(y, s));
+        
+        __m256 t = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_add_epi32(i, j)), _mm256_set1_ps(G2));
+        __m256 x0 = _mm256_sub_ps(x, _mm256_sub_ps(_mm256_cvtepi32_ps(i), t));
+        __m256 y0 = _mm256_sub_ps(y, _mm256_sub_ps(_mm256_cvtepi32_ps(j), t));
+        
+        __m256i upper = _mm256_castps_si256(_mm256_cmp_ps(x0, y0, _CMP_GT_OQ));
+        __m256i i1 = _mm256_and_si256(upper, _mm256_set1_epi32(1));
+        __m256i j1 = _mm256_andnot_si256(upper, _mm256_set1_epi32(1));
+        
+        __m256 g2 = _mm256_set1_ps(G2);
+        __m256 x1 = _mm256_add_ps(_mm256_sub_ps(x0, _mm256_cvtepi32_ps(i1)), g2);
+        __m256 y1 = _mm256_add_ps(_mm256_sub_ps(y0, _mm256_cvtepi32_ps(j1)), g2);
+        __m256 x2 = _mm256_add_ps(_mm256_sub_ps(x0, _mm256_set1_ps(1.0f)), _mm256_set1_ps(2.0f * G2));
+        __m256 y2 = _mm256_add_ps(_mm256_sub_ps(y0, _mm256_set1_ps(1.0f)), _mm256_set1_ps(2.0f * G2));
+        
+        __m256i mask = _mm256_set1_epi32(0xff);
+        __m256i one = _mm256_set1_epi32(1);
+        __m256i ii = _mm256_and_si256(i, mask);
+        __m256i jj = _mm256_and_si256(j, mask);
+        
+        __m256i h0 = Lookup8(perm32, _mm256_add_epi32(ii, Lookup8(perm32, jj)));
+        __m256i h1 = Lookup8(perm32, _mm256_add_epi32(_mm256_add_epi32(ii, i1),
+                                                       Lookup8(perm32, _mm256_add_epi32(jj, j1))));
+        __m256i h2 = Lookup8(perm32, _mm256_add_epi32(_mm256_add_epi32(ii, one),
+                                                       Lookup8(perm32, _mm256_add_epi32(jj, one))));
+        
+        __m256 n = _mm256_add_ps(_mm256_add_ps(Corner2D8(x0, y0, h0), Corner2D8(x1, y1, h1)),
+                                 Corner2D8(x2, y2, h2));
+        __m256 noise = _mm256_mul_ps(_mm256_set1_ps(40.0f), n);
+        return _mm256_add_ps(_mm256_mul_ps(noise, _mm256_set1_ps(128.0f)), _mm256_set1_ps(128.0f));
+    }
+    
+    CHRONICLES_TARGET_AVX2
+    int Pixel1DBatchAVX2(const int32_t* perm32, int32_t startX, int32_t step, int count, float scale, float* out) {
+        __m256 scale8 = _mm256_set1_ps(scale);
+        __m256i laneOffsets = _mm256_mullo_epi32(_mm256_set1_epi32(step), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        int i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256i xi = _mm256_add_epi32(_mm256_set1_epi32(startX + i * step), laneOffsets);
+            _mm256_storeu_ps(out + i, Pixel1D8(perm32, xi, scale8));
+        }
+        return i;
+    }
+    
+    CHRONICLES_TARGET_AVX2
+    int Pixel2DRowAVX2(const int32_t* perm32, int32_t startX, int32_t y, int32_t step, int width, float scale, float* out) {
+        __m256 scale8 = _mm256_set1_ps(scale);
+        __m256 y8 = _mm256_set1_ps(static_cast<float>(y) * scale);
+        __m256i laneOffsets = _mm256_mullo_epi32(_mm256_set1_epi32(step), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        int i = 0;
+        for (; i + 8 <= width; i += 8) {
+            __m256i xi = _mm256_add_epi32(_mm256_set1_epi32(startX + i * step), laneOffsets);
+            _mm256_storeu_ps(out + i, Pixel2D8(perm32, xi, y8, scale8));
+        }
+        return i;
+    }
+#endif
+}
+
+// ===== SIMD Level Selection =====
+
+SimdLevel Chronicles::Noise::DetectSimdLevel() {
+    static const SimdLevel detected = QueryCpu();
+    return detected;
+}
+
+SimdLevel Chronicles::Noise::GetSimdLevel() {
+    return static_cast<SimdLevel>(ActiveLevel().load(std::memory_order_relaxed));
+}
+
+SimdLevel Chronicles::Noise::SetSimdLevel(SimdLevel level) {
+    int applied = static_cast<int>(level);
+    int supported = static_cast<int>(DetectSimdLevel());
+    if (applied > supported) applied = supported;
+    if (applied < 0) applied = 0;
+    ActiveLevel().store(applied, std::memory_order_relaxed);
+    return static_cast<SimdLevel>(applied);
+}
+
+// ===== Batch Evaluation =====
+
+void SimplexNoise::CalcPixel1DBatch(int32_t startX, int32_t step, int count, float scale, float* out) const {
+    int done = 0;
+#ifdef CHRONICLES_NOISE_X86
+    switch (GetSimdLevel()) {
+        case SimdLevel::AVX2:
+            done = Pixel1DBatchAVX2(m_perm32, startX, step, count, scale, out);
+            break;
+        case SimdLevel::SSE2:
+            done = Pixel1DBatchSSE2(m_perm, startX, step, count, scale, out);
+            break;
+        default:
+            break;
+    }
+#endif
+    for (int i = done; i < count; i++) {
+        out[i] = CalcPixel1D(startX + i * step, scale);
+    }
+}
+
+void SimplexNoise::CalcPixel2DBatch(int32_t startX, int32_t startY, int32_t step, int width, int height,
+                                    float scale, float* out) const {
+    SimdLevel level = GetSimdLevel();
+    for (int row = 0; row < height; row++) {
+        int32_t y = startY + row * step;
+        float* rowOut = out + static_cast<size_t>(row) * width;
+        int done = 0;
+#ifdef CHRONICLES_NOISE_X86
+        switch (level) {
+            case SimdLevel::AVX2:
+                done = Pixel2DRowAVX2(m_perm32, startX, y, step, width, scale, rowOut);
+                break;
+            case SimdLevel::SSE2:
+                done = Pixel2DRowSSE2(m_perm, startX, y, step, width, scale, rowOut);
+                break;
+            default:
+                break;
+        }
+#else
+        (void)level;
+#endif
+        for (int col = done; col < width; col++) {
+            rowOut[col] = CalcPixel2D(startX + col * step, y, scale);
+        }
+    }
+}
+
+// ===== C API Implementation =====
+
+extern "C" ENGINE_API void Noise_SetSeed(int seed) {
+    g_sharedNoise = std::make_unique<SimplexNoise>(seed);
+}
+
+extern "C" ENGINE_API void Noise_CalcPixel1DBatch(int startX, int step, int count, float scale, float* out) {
+    if (!out || count <= 0) return;
+    SharedNoise().CalcPixel1DBatch(startX, step, count, scale, out);
+}
+
+extern "C" ENGINE_API void Noise_CalcPixel2DBatch(int startX, int startY, int step, int width, int height,
+                                                  float scale, float* out) {
+    if (!out || width <= 0 || height <= 0) return;
+    SharedNoise().CalcPixel2DBatch(startX, startY, step, width, height, scale, out);
+}
+
+extern "C" ENGINE_API int Noise_GetSimdLevel() {
+    return static_cast<int>(GetSimdLevel());
+}
+
+extern "C" ENGINE_API int Noise_SetSimdLevel(int level) {
+    return static_cast<int>(SetSimdLevel(static_cast<SimdLevel>(level)));
+}
@@ -0,0 +1,341 @@
+#include "SoftwareRasterizer.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define CHRONICLES_RASTER_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+namespace Chronicles {
+
+namespace {
+    const int BandRows = 32;
+    const int MaxThreads = 8;
+    
+    uint8_t ToByte(float value) {
+        return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+    }
+    
+    // Exact round(x / 255) for x in [0, 255 * 255]; the SIMD path uses the same formula
+    inline uint32_t Div255(uint32_t x) {
+        x += 128;
+        return (x + (x >> 8)) >> 8;
+    }
+    
+    // Standard "over" blending of non-premultiplied color, matching SDL_BLENDMODE_BLEND
+    inline void BlendPixel(uint8_t* dest, const uint8_t source[4]) {
+        const uint32_t alpha = source[3];
+        const uint32_t inverse = 255 - alpha;
+        dest[0] = static_cast<uint8_t>(Div255(source[0] * alpha + dest[0] * inverse));
+        dest[1] = static_cast<uint8_t>(Div255(source[1] * alpha + dest[1] * inverse));
+        dest[2] = static_cast<uint8_t>(Div255(source[2] * alpha + dest[2] * inverse));
+        dest[3] = static_cast<uint8_t>(Div255(alpha * 255 + dest[3] * inverse));
+    }
+    
+    void StoreSpan(uint8_t* row, int count, const uint8_t color[4]) {
+        int i = 0;
+#ifdef CHRONICLES_RASTER_SSE2
+        uint32_t packed;
+        memcpy(&packed, color, 4);
+        const __m128i fill = _mm_set1_epi32(static_cast<int>(packed));
+        for (; i + 4 <= count; i += 4) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(row + i * 4), fill);
+        }
+#endif
+        for (; i < count; i++) {
+            memcpy(row + i * 4, color, 4);
+        }
+    }
+    
+    void BlendSpan(uint8_t* row, int count, const uint8_t color[4]) {
+        int i = 0;
+#ifdef CHRONICLES_RASTER_SSE2
+        const uint32_t alpha = color[3];
+        const uint32_t inverse = 255 - alpha;
+        // Two pixels per 8 x u16 half: dest = Div255(source * alpha + dest * inverse)
+        const short s0 = static_cast<short>(color[0] * alpha);
+        const short s1 = static_cast<short>(color[1] * alpha);
+        const short s2 = static_cast<short>(color[2] * alpha);
+        const short s3 = static_cast<short>(255 * alpha);
+        const __m128i source = _mm_setr_epi16(s0, s1, s2, s3, s0, s1, s2, s3);
+        const __m128i factor = _mm_set1_epi16(static_cast<short>(inverse));
+        const __m128i bias = _mm_set1_epi16(128);
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 4 <= count; i += 4) {
+            __m128i* pixels = reinterpret_cast<__m128i*>(row + i * 4);
+            const __m128i dest = _mm_loadu_si128(pixels);
+            __m128i low = _mm_unpacklo_epi8(dest, zero);
+            __m128i high = _mm_unpackhi_epi8(dest, zero);
+            low = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(low, factor), source), bias);
+            high = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(high, factor), source), bias);
+            low = _mm_srli_epi16(_mm_add_epi16(low, _mm_srli_epi16(low, 8)), 8);
+            high = _mm_srli_epi16(_mm_add_epi16(high, _mm_srli_epi16(high, 8)), 8);
+            _mm_storeu_si128(pixels, _mm_packus_epi16(low, high));
+        }
+#endif
+        for (; i < count; i++) {
+            BlendPixel(row + i * 4, color);
+        }
+    }
+    
+    void FillSpan(uint8_t* row, int count, const uint8_t color[4]) {
+        if (color[3] == 255) {
+            StoreSpan(row, count, color);
+        } else {
+            BlendSpan(row, count, color);
+        }
+    }
+}
+
+SoftwareRasterizer::SoftwareRasterizer(int width, int height, int threadCount)
+    : m_width(std::max(width, 0))
+    , m_height(std::max(height, 0))
+    , m_pixels(static_cast<size_t>(m_width) * m_height * 4, 0)
+    , m_generation(0)
+    , m_busyWorkers(0)
+    , m_stopping(false)
+    , m_bandCount(0)
+    , m_nextBand(0)
+{
+    if (threadCount <= 0) {
+        threadCount = std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, MaxThreads);
+    }
+    
+    // The thread calling Flush() rasterizes bands too
+    const int maxUseful = std::max(1, (m_height + BandRows - 1) / BandRows);
+    threadCount = std::min(threadCount, maxUseful);
+    m_workers.reserve(threadCount - 1);
+    for (int i = 1; i < threadCount; i++) {
+        m_workers.emplace_back(&SoftwareRasterizer::WorkerLoop, this);
+    }
+}
+
+SoftwareRasterizer::~SoftwareRasterizer() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_startCondition.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void SoftwareRasterizer::SetTexture(int textureId, const uint8_t* rgbaPixels, int width, int height) {
+    if (!rgbaPixels || width <= 0 || height <= 0) {
+        return;
+    }
+    
+    // Recorded commands may still reference the texture being replaced
+    if (m_textures.count(textureId) != 0) {
+        Flush();
+    }
+    
+    Texture& texture = m_textures[textureId];
+    texture.width = width;
+    texture.height = height;
+    texture.pixels.assign(rgbaPixels, rgbaPixels + static_cast<size_t>(width) * height * 4);
+}
+
+void SoftwareRasterizer::RemoveTexture(int textureId) {
+    if (m_textures.count(textureId) != 0) {
+        Flush();
+        m_textures.erase(textureId);
+    }
+}
+
+void SoftwareRasterizer::Clear(float r, float g, float b, float a) {
+    // Everything recorded so far would be overwritten
+    m_commands.clear();
+    
+    Command command = {};
+    command.isClear = true;
+    command.color[0] = ToByte(r);
+    command.color[1] = ToByte(g);
+    command.color[2] = ToByte(b);
+    command.color[3] = ToByte(a);
+    command.maxX = m_width;
+    command.maxY = m_height;
+    m_commands.push_back(command);
+}
+
+void SoftwareRasterizer::DrawQuad(const BatchQuad& quad) {
+    if (quad.width <= 0.0f || quad.height <= 0.0f) {
+        return;
+    }
+    
+    Command command = {};
+    if (quad.textureId > 0) {
+        auto it = m_textures.find(quad.textureId);
+        if (it == m_textures.end()) {
+            return;
+        }
+        command.texture = &it->second;
+    }
+    
+    command.color[0] = ToByte(quad.r);
+    command.color[1] = ToByte(quad.g);
+    command.color[2] = ToByte(quad.b);
+    command.color[3] = ToByte(quad.a);
+    if (command.color[3] == 0) {
+        return;
+    }
+    
+    command.isAxisAligned = quad.rotation == 0.0f;
+    command.centerX = quad.x + quad.width * 0.5f;
+    command.centerY = quad.y + quad.height * 0.5f;
+    command.halfWidth = quad.width * 0.5f;
+    command.halfHeight = quad.height * 0.5f;
+    command.cosAngle = std::cos(quad.rotation);
+    command.sinAngle = std::sin(quad.rotation);
+    command.u0 = quad.u0;
+    command.v0 = quad.v0;
+    command.uScale = quad.u1 - quad.u0;
+    command.vScale = quad.v1 - quad.v0;
+    
+    // Screen-space extent of the (rotated) quad
+    const float extentX = std::abs(command.halfWidth * command.cosAngle) + std::abs(command.halfHeight * command.sinAngle);
+    const float extentY = std::abs(command.halfWidth * command.sinAngle) + std::abs(command.halfHeight * command.cosAngle);
+    const float left = command.isAxisAligned ? quad.x : command.centerX - extentX;
+    const float top = command.isAxisAligned ? quad.y : command.centerY - extentY;
+    const float right = command.isAxisAligned ? quad.x + quad.width : command.centerX + extentX;
+    const float bottom = command.isAxisAligned ? quad.y + quad.height : command.centerY + extentY;
+    
+    // A pixel is covered when its center lies inside; clip to the screen
+    command.minX = static_cast<int>(std::max(0.0f, std::ceil(left - 0.5f)));
+    command.minY = static_cast<int>(std::max(0.0f, std::ceil(top - 0.5f)));
+    command.maxX = static_cast<int>(std::min(static_cast<float>(m_width), std::ceil(right - 0.5f)));
+    command.maxY = static_cast<int>(std::min(static_cast<float>(m_height), std::ceil(bottom - 0.5f)));
+    if (command.minX >= command.maxX || command.minY >= command.maxY) {
+        return;
+    }
+    
+    m_commands.push_back(command);
+}
+
+void SoftwareRasterizer::Flush() {
+    CHRONICLES_PROFILE_SCOPE("Rasterize");
+    if (m_commands.empty() || m_pixels.empty()) {
+        m_commands.clear();
+        return;
+    }
+    
+    m_bandCount = (m_height + BandRows - 1) / BandRows;
+    m_nextBand.store(0, std::memory_order_relaxed);
+    
+    if (m_workers.empty()) {
+        RunBands();
+    } else {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_busyWorkers = static_cast<int>(m_workers.size());
+            m_generation++;
+        }
+        m_startCondition.notify_all();
+        
+        RunBands();
+        
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_doneCondition.wait(lock, [this] { return m_busyWorkers == 0; });
+    }
+    
+    m_commands.clear();
+}
+
+void SoftwareRasterizer::RunBands() {
+    CHRONICLES_PROFILE_SCOPE("RasterizeBands");
+    int band;
+    while ((band = m_nextBand.fetch_add(1, std::memory_order_relaxed)) < m_bandCount) {
+        const int minY = band * BandRows;
+        RasterizeBand(minY, std::min(minY + BandRows, m_height));
+    }
+}
+
+void SoftwareRasterizer::WorkerLoop() {
+    uint64_t seenGeneration = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_startCondition.wait(lock, [&] { return m_stopping || m_generation != seenGeneration; });
+            if (m_stopping) return;
+            seenGeneration = m_generation;
+        }
+        
+        RunBands();
+        
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (--m_busyWorkers == 0) {
+            m_doneCondition.notify_one();
+        }
+    }
+}
+
+void SoftwareRasterizer::RasterizeBand(int minY, int maxY) {
+    const size_t pitch = static_cast<size_t>(m_width) * 4;
+    
+    for (const Command& command : m_commands) {
+        const int top = std::max(minY, command.minY);
+        const int bottom = std::min(maxY, command.maxY);
+        if (top >= bottom) {
+            continue;
+        }
+        
+        if (command.isClear) {
+            for (int y = top; y < bottom; y++) {
+                StoreSpan(&m_pixels[y * pitch], m_width, command.color);
+            }
+        } else if (command.isAxisAligned && !command.texture) {
+            const int count = command.maxX - command.minX;
+            for (int y = top; y < bottom; y++) {
+                FillSpan(&m_pixels[y * pitch + static_cast<size_t>(command.minX) * 4], count, command.color);
+            }
+        } else {
+            DrawTransformed(command, top, bottom);
+        }
+    }
+}
+
+void SoftwareRasterizer::DrawTransformed(const Command& command, int minY, int maxY) {
+    const size_t pitch = static_cast<size_t>(m_width) * 4;
+    const Texture* texture = command.texture;
+    const float width = command.halfWidth * 2.0f;
+    const float height = command.halfHeight * 2.0f;
+    
+    for (int y = minY; y < maxY; y++) {
+        const float dy = y + 0.5f - command.centerY;
+        uint8_t* pixel = &m_pixels[y * pitch + static_cast<size_t>(command.minX) * 4];
+        for (int x = command.minX; x < command.maxX; x++, pixel += 4) {
+            const float dx = x + 0.5f - command.centerX;
+            const float localX = dx * command.cosAngle + dy * command.sinAngle + command.halfWidth;
+            const float localY = dy * command.cosAngle - dx * command.sinAngle + command.halfHeight;
+            if (localX < 0.0f || localX >= width || localY < 0.0f || localY >= height) {
+                continue;
+            }
+            
+            uint8_t source[4];
+            if (texture) {
+                const float u = command.u0 + (localX / width) * command.uScale;
+                const float v = command.v0 + (localY / height) * command.vScale;
+                const int texelX = std::clamp(static_cast<int>(std::floor(u * texture->width)), 0, texture->width - 1);
+                const int texelY = std::clamp(static_cast<int>(std::floor(v * texture->height)), 0, texture->height - 1);
+                const uint8_t* texel = &texture->pixels[(static_cast<size_t>(texelY) * texture->width + texelX) * 4];
+                for (int c = 0; c < 4; c++) {
+                    source[c] = static_cast<uint8_t>(Div255(texel[c] * static_cast<uint32_t>(command.color[c])));
+                }
+            } else {
+                memcpy(source, command.color, 4);
+            }
+            
+            if (source[3] == 255) {
+                memcpy(pixel, source, 4);
+            } else if (source[3] != 0) {
+                BlendPixel(pixel, source);
+            }
+        }
+    }
+}
+
+} // namespace Chronicles
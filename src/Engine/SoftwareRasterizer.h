@@ -0,0 +1,109 @@
+#pragma once
+
+#include "IRenderer.h"  // For BatchQuad
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Chronicles of a Drifter - CPU Rasterizer
+// Draws clears, solid and textured quads (with rotation) into an RGBA8 framebuffer.
+// Draws are recorded and rasterized on Flush(): the screen is split into horizontal
+// bands that a small thread pool processes in parallel, each band replaying every
+// command in submission order so the result is identical for any thread count.
+
+namespace Chronicles {
+
+class SoftwareRasterizer {
+public:
+    /// <summary>
+    /// Create a rasterizer with a cleared (transparent black) framebuffer
+    /// </summary>
+    /// <param name="threadCount">Threads rasterizing bands, including the caller; &lt;= 0 picks one per core (max 8)</param>
+    SoftwareRasterizer(int width, int height, int threadCount);
+    ~SoftwareRasterizer();
+    
+    SoftwareRasterizer(const SoftwareRasterizer&) = delete;
+    SoftwareRasterizer& operator=(const SoftwareRasterizer&) = delete;
+    
+    /// <summary>
+    /// Store a copy of an RGBA8 texture, replacing any texture with the same ID
+    /// </summary>
+    void SetTexture(int textureId, const uint8_t* rgbaPixels, int width, int height);
+    void RemoveTexture(int textureId);
+    bool HasTexture(int textureId) const { return m_textures.count(textureId) != 0; }
+    
+    /// <summary>
+    /// Record a clear; commands recorded before it are discarded
+    /// </summary>
+    void Clear(float r, float g, float b, float a);
+    
+    /// <summary>
+    /// Record a quad. textureId &lt;= 0 fills with the quad color; otherwise the
+    /// texture is sampled (nearest) and modulated by the quad color.
+    /// Quads with an unknown texture are ignored.
+    /// </summary>
+    void DrawQuad(const BatchQuad& quad);
+    
+    /// <summary>
+    /// Rasterize all recorded commands into the framebuffer
+    /// </summary>
+    void Flush();
+    
+    /// <summary>
+    /// RGBA8 rows, width * height * 4 bytes, as of the last Flush()
+    /// </summary>
+    const std::vector<uint8_t>& GetPixels() const { return m_pixels; }
+    int GetWidth() const { return m_width; }
+    int GetHeight() const { return m_height; }
+    int GetThreadCount() const { return static_cast<int>(m_workers.size()) + 1; }
+
+private:
+    struct Texture {
+        int width;
+        int height;
+        std::vector<uint8_t> pixels;
+    };
+    
+    struct Command {
+        bool isClear;
+        bool isAxisAligned;     // Unrotated, so rows can be filled as spans
+        uint8_t color[4];
+        const Texture* texture; // Null for solid fills and clears
+        // Clipped screen bounds [minX, maxX) x [minY, maxY)
+        int minX, minY, maxX, maxY;
+        // Inverse transform: quad-local position = rotate(pixel center - center, -rotation)
+        float centerX, centerY;
+        float halfWidth, halfHeight;
+        float cosAngle, sinAngle;
+        float u0, v0, uScale, vScale;  // Texture coordinate = u0 + localX01 * uScale
+    };
+    
+    void RasterizeBand(int minY, int maxY);
+    void DrawTransformed(const Command& command, int minY, int maxY);
+    void RunBands();
+    void WorkerLoop();
+    
+    int m_width;
+    int m_height;
+    std::vector<uint8_t> m_pixels;
+    std::unordered_map<int, Texture> m_textures;  // Nodes never move, so commands may point into it
+    std::vector<Command> m_commands;
+    
+    // Band scheduling: Flush bumps m_generation, then workers and the caller take bands
+    // from m_nextBand until none are left
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_startCondition;
+    std::condition_variable m_doneCondition;
+    uint64_t m_generation;
+    int m_busyWorkers;
+    bool m_stopping;
+    int m_bandCount;
+    std::atomic<int> m_nextBand;
+};
+
+} // namespace Chronicles
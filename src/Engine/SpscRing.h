@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+// Chronicles of a Drifter - Single-Producer/Single-Consumer Ring Buffer
+// Wait-free bounded ring for handing data from one thread to exactly one other.
+// Each side caches the other's index so the shared counters are only re-read
+// when the ring looks full (producer) or empty (consumer).
+
+namespace Chronicles {
+
+template<typename T>
+class SpscRing {
+public:
+    /// <summary>
+    /// Create a ring holding up to capacity items (rounded up to a power of two)
+    /// </summary>
+    explicit SpscRing(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        m_mask = size - 1;
+        m_buffer = std::make_unique<T[]>(size);
+    }
+    
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+    
+    size_t Capacity() const { return m_mask + 1; }
+    
+    /// <summary>
+    /// Producer only: append an item; returns false if the ring is full
+    /// </summary>
+    bool TryPush(const T& value) {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_cachedTail > m_mask) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+            if (head - m_cachedTail > m_mask) {
+                return false;
+            }
+        }
+        m_buffer[head & m_mask] = value;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+    
+    /// <summary>
+    /// Consumer only: remove up to maxCount items in FIFO order; returns the number copied
+    /// </summary>
+    size_t PopMany(T* out, size_t maxCount) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (m_cachedHead - tail < maxCount) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+        }
+        size_t available = m_cachedHead - tail;
+        size_t count = available < maxCount ? available : maxCount;
+        for (size_t i = 0; i < count; i++) {
+            out[i] = m_buffer[(tail + i) & m_mask];
+        }
+        m_tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+    
+    /// <summary>
+    /// Consumer only: remove one item; returns false if the ring is empty
+    /// </summary>
+    bool TryPop(T& out) {
+        return PopMany(&out, 1) == 1;
+    }
+    
+    /// <summary>
+    /// Approximate number of queued items (exact when called from either endpoint while the other is idle)
+    /// </summary>
+    size_t Size() const {
+        return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+    }
+
+private:
+    std::unique_ptr<T[]> m_buffer;
+    size_t m_mask;
+    
+    // Producer-owned line: write index plus its cached copy of the read index
+    alignas(64) std::atomic<size_t> m_head{0};
+    size_t m_cachedTail = 0;
+    
+    // Consumer-owned line: read index plus its cached copy of the write index
+    alignas(64) std::atomic<size_t> m_tail{0};
+    size_t m_cachedHead = 0;
+};
+
+} // namespace Chronicles
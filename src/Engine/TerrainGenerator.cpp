@@ -0,0 +1,437 @@
+#include "TerrainGenerator.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+using namespace Chronicles::World;
+
+namespace {
+    // Noise parameters (must match the managed generators)
+    const float SurfaceFrequency = 0.03f;
+    const float BiomeFrequency = 0.005f;
+    const float CaveFrequency = 0.08f;
+    const float VegetationFrequency = 0.15f;
+    const float RiverFrequency = 0.005f;
+    const float LakeFrequency = 0.008f;
+    const float OceanFrequency = 0.002f;
+    
+    const float RiverThreshold = 0.60f;
+    const float LakeThreshold = 0.65f;
+    const float OceanThreshold = 0.70f;
+    
+    const int RiverDepth = 2;
+    const int LakeDepth = 3;
+    const int OceanDepth = 5;
+    
+    const int CompletedQueueCapacity = 256;
+    
+    inline uint8_t Tile(TileType type) {
+        return static_cast<uint8_t>(type);
+    }
+    
+    TileType GetSurfaceBlock(BiomeType biome) {
+        switch (biome) {
+            case BiomeType::Desert:
+            case BiomeType::Beach:
+                return TileType::Sand;
+            case BiomeType::Snow:
+                return TileType::Snow;
+            case BiomeType::Rocky:
+                return TileType::Stone;
+            default:
+                return TileType::Grass;
+        }
+    }
+    
+    TileType GetTopsoilBlock(BiomeType biome) {
+        switch (biome) {
+            case BiomeType::Desert:
+            case BiomeType::Beach:
+                return TileType::Sand;
+            case BiomeType::Snow:
+                return TileType::Snow;
+            case BiomeType::Rocky:
+                return TileType::Stone;
+            default:
+                return TileType::Dirt;
+        }
+    }
+    
+    bool IsSolid(uint8_t tile) {
+        switch (static_cast<TileType>(tile)) {
+            case TileType::Air:
+            case TileType::Water:
+            case TileType::DeepWater:
+            case TileType::TallGrass:
+            case TileType::Flower:
+            case TileType::Torch:
+                return false;
+            default:
+                return true;
+        }
+    }
+    
+    bool IsValidVegetationSurface(uint8_t tile) {
+        switch (static_cast<TileType>(tile)) {
+            case TileType::Grass:
+            case TileType::Sand:
+            case TileType::Dirt:
+            case TileType::Snow:
+            case TileType::Stone:
+                return true;
+            default:
+                return false;
+        }
+    }
+    
+    // Probability tables from VegetationGenerator; Air means no vegetation
+    TileType DetermineVegetation(BiomeType biome, float p, int roll) {
+        switch (biome) {
+            case BiomeType::Forest:
+                if (p < 0.40f) return TileType::Air;
+                if (p < 0.70f) return roll < 70 ? TileType::TreeOak : TileType::TreePine;
+                if (p < 0.85f) return TileType::Bush;
+                if (p < 0.95f) return TileType::TallGrass;
+                return TileType::Flower;
+            case BiomeType::Plains:
+                if (p < 0.70f) return TileType::Air;
+                if (p < 0.80f) return TileType::TreeOak;
+                if (p < 0.90f) return TileType::TallGrass;
+                if (p < 0.95f) return TileType::Bush;
+                return TileType::Flower;
+            case BiomeType::Desert:
+                if (p < 0.95f) return TileType::Air;
+                if (p < 0.98f) return TileType::Cactus;
+                return TileType::TreePalm;
+            case BiomeType::Snow:
+                if (p < 0.70f) return TileType::Air;
+                if (p < 0.95f) return TileType::TreePine;
+                return TileType::Bush;
+            case BiomeType::Swamp:
+                if (p < 0.60f) return TileType::Air;
+                if (p < 0.80f) return TileType::TreeOak;
+                if (p < 0.95f) return TileType::TallGrass;
+                return TileType::Bush;
+            case BiomeType::Rocky:
+                if (p < 0.90f) return TileType::Air;
+                if (p < 0.95f) return TileType::Bush;
+                return TileType::TallGrass;
+            case BiomeType::Jungle:
+                if (p < 0.30f) return TileType::Air;
+                if (p < 0.60f) return TileType::TreeOak;
+                if (p < 0.80f) return TileType::Bush;
+                if (p < 0.95f) return TileType::TallGrass;
+                return TileType::Flower;
+            case BiomeType::Beach:
+                if (p < 0.85f) return TileType::Air;
+                if (p < 0.92f) return TileType::TreePalm;
+                if (p < 0.97f) return TileType::TallGrass;
+                return TileType::Bush;
+        }
+        return TileType::Air;
+    }
+    
+    BiomeType ClassifyBiome(float temperature, float moisture) {
+        if (temperature < 0.25f) return BiomeType::Snow;
+        if (temperature > 0.75f && moisture < 0.3f) return BiomeType::Desert;
+        if (temperature > 0.7f && moisture > 0.6f) return BiomeType::Jungle;
+        if (moisture > 0.7f) return BiomeType::Swamp;
+        if (temperature >= 0.4f && temperature <= 0.7f && moisture >= 0.4f && moisture <= 0.7f) return BiomeType::Forest;
+        if (moisture < 0.3f && temperature >= 0.3f && temperature <= 0.6f) return BiomeType::Rocky;
+        if (moisture >= 0.35f && moisture <= 0.45f) return BiomeType::Beach;
+        return BiomeType::Plains;
+    }
+    
+    TileType GetUndergroundBlock(int y, float caveNoise, float oreNoise) {
+        // Cave pockets
+        if (caveNoise > 200) return TileType::Air;
+        
+        if (y >= 10 && y < 18 && oreNoise > 230) return TileType::CopperOre;
+        if (y >= 14 && y < 24 && oreNoise > 240) return TileType::IronOre;
+        if (y >= 20 && y < 28 && oreNoise > 245) return TileType::GoldOre;
+        
+        return y < 15 ? TileType::Stone : TileType::DeepStone;
+    }
+    
+    // Fill a column with water from its surface (first non-air tile) down
+    void FloodColumn(uint8_t* tiles, int localX, int depth, bool keepDeepStone) {
+        int surfaceY = -1;
+        for (int y = 0; y < ChunkHeight; y++) {
+            if (tiles[y * ChunkWidth + localX] != Tile(TileType::Air)) {
+                surfaceY = y;
+                break;
+            }
+        }
+        if (surfaceY < 0) return;
+        
+        for (int y = surfaceY; y < surfaceY + depth && y < ChunkHeight; y++) {
+            uint8_t& tile = tiles[y * ChunkWidth + localX];
+            if (tile == Tile(TileType::Bedrock)) continue;
+            if (keepDeepStone && tile == Tile(TileType::DeepStone)) continue;
+            tile = Tile(TileType::Water);
+        }
+    }
+}
+
+// ===== TerrainGenerator Implementation =====
+
+TerrainGenerator::TerrainGenerator(int32_t seed)
+    : m_seed(seed)
+    , m_noise(seed) {
+}
+
+BiomeType TerrainGenerator::GetBiomeAt(int32_t worldX) const {
+    float temperature = m_noise.CalcPixel1D(worldX, BiomeFrequency) / 255.0f;
+    float moisture = m_noise.CalcPixel1D(worldX + 10000, BiomeFrequency * 1.2f) / 255.0f;
+    return ClassifyBiome(temperature, moisture);
+}
+
+void TerrainGenerator::GenerateChunk(int32_t chunkX, uint8_t* tiles, uint8_t* vegetation) const {
+    int32_t startX = chunkX * ChunkWidth;
+    BiomeType biomeMap[ChunkWidth];
+    
+    // Evaluate all noise for the chunk up front with the batch kernels
+    float temperature[ChunkWidth];
+    float moisture[ChunkWidth];
+    float surface[ChunkWidth];
+    float cave[ChunkTileCount];
+    float ore[ChunkTileCount];
+    m_noise.CalcPixel1DBatch(startX, 1, ChunkWidth, BiomeFrequency, temperature);
+    m_noise.CalcPixel1DBatch(startX + 10000, 1, ChunkWidth, BiomeFrequency * 1.2f, moisture);
+    m_noise.CalcPixel1DBatch(startX, 1, ChunkWidth, SurfaceFrequency, surface);
+    m_noise.CalcPixel2DBatch(startX, 0, 1, ChunkWidth, ChunkHeight, CaveFrequency, cave);
+    m_noise.CalcPixel2DBatch(startX * 2, 0, 2, ChunkWidth, ChunkHeight, 0.1f, ore);
+    
+    for (int localX = 0; localX < ChunkWidth; localX++) {
+        BiomeType biome = ClassifyBiome(temperature[localX] / 255.0f, moisture[localX] / 255.0f);
+        biomeMap[localX] = biome;
+        
+        int surfaceHeight = 4 + static_cast<int>((surface[localX] / 255.0f) * 6);
+        
+        for (int y = 0; y < ChunkHeight; y++) {
+            TileType type;
+            if (y < surfaceHeight) {
+                type = TileType::Air;
+            } else if (y == surfaceHeight) {
+                type = GetSurfaceBlock(biome);
+            } else if (y < surfaceHeight + 4) {
+                type = GetTopsoilBlock(biome);
+            } else if (y < ChunkHeight - 1) {
+                int index = y * ChunkWidth + localX;
+                type = GetUndergroundBlock(y, cave[index], ore[index]);
+            } else {
+                type = TileType::Bedrock;
+            }
+            tiles[y * ChunkWidth + localX] = Tile(type);
+        }
+    }
+    
+    GenerateWater(tiles, startX, biomeMap);
+    GenerateVegetation(tiles, vegetation, startX, biomeMap);
+}
+
+void TerrainGenerator::GenerateWater(uint8_t* tiles, int32_t startX, const BiomeType* biomeMap) const {
+    float ocean[ChunkWidth];
+    float river1[ChunkWidth];
+    float river2[ChunkWidth];
+    float lake[ChunkWidth];
+    m_noise.CalcPixel1DBatch(startX, 1, ChunkWidth, OceanFrequency, ocean);
+    m_noise.CalcPixel1DBatch(startX, 1, ChunkWidth, RiverFrequency, river1);
+    m_noise.CalcPixel1DBatch(startX + 5000, 1, ChunkWidth, RiverFrequency * 1.5f, river2);
+    m_noise.CalcPixel1DBatch(startX, 1, ChunkWidth, LakeFrequency, lake);
+    
+    for (int localX = 0; localX < ChunkWidth; localX++) {
+        BiomeType biome = biomeMap[localX];
+        
+        if (biome == BiomeType::Beach && ocean[localX] / 255.0f > OceanThreshold) {
+            FloodColumn(tiles, localX, OceanDepth, true);
+            continue;
+        }
+        
+        if (biome != BiomeType::Desert && biome != BiomeType::Snow &&
+            (river1[localX] + river2[localX] * 0.5f) / (255.0f * 1.5f) > RiverThreshold) {
+            FloodColumn(tiles, localX, RiverDepth, false);
+            continue;
+        }
+        
+        if ((biome == BiomeType::Swamp || biome == BiomeType::Forest || biome == BiomeType::Plains) &&
+            lake[localX] / 255.0f > LakeThreshold) {
+            FloodColumn(tiles, localX, LakeDepth, true);
+        }
+    }
+}
+
+void TerrainGenerator::GenerateVegetation(const uint8_t* tiles, uint8_t* vegetation, int32_t startX,
+                                          const BiomeType* biomeMap) const {
+    float density[ChunkWidth];
+    m_noise.CalcPixel1DBatch(startX, 1, ChunkWidth, VegetationFrequency, density);
+    
+    for (int localX = 0; localX < ChunkWidth; localX++) {
+        vegetation[localX] = Tile(TileType::Air);
+        
+        int surfaceY = -1;
+        for (int y = 0; y < ChunkHeight; y++) {
+            if (IsSolid(tiles[y * ChunkWidth + localX])) {
+                surfaceY = y;
+                break;
+            }
+        }
+        if (surfaceY < 0 || !IsValidVegetationSurface(tiles[surfaceY * ChunkWidth + localX])) {
+            continue;
+        }
+        
+        int32_t worldX = startX + localX;
+        float probability = density[localX] / 255.0f;
+        // Wraps like the unchecked C# addition instead of overflowing
+        int roll = VegetationRoll(static_cast<int32_t>(static_cast<uint32_t>(m_seed) + 12345u), worldX);
+        vegetation[localX] = Tile(DetermineVegetation(biomeMap[localX], probability, roll));
+    }
+}
+
+// ===== TerrainPipeline Implementation =====
+
+TerrainPipeline::TerrainPipeline(int32_t seed, int workerCount)
+    : m_generator(seed)
+    , m_stopping(false)
+    , m_focusChunk(0)
+    , m_completed(CompletedQueueCapacity) {
+    if (workerCount <= 0) {
+        workerCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()) - 1);
+    }
+    
+    m_workers.reserve(workerCount);
+    for (int i = 0; i < workerCount; i++) {
+        m_workers.emplace_back(&TerrainPipeline::WorkerLoop, this);
+    }
+}
+
+TerrainPipeline::~TerrainPipeline() {
+    {
+        std::lock_guard<std::mutex> lock(m_requestMutex);
+        m_stopping = true;
+        m_requests.clear();
+    }
+    m_requestCondition.notify_all();
+    
+    // Workers waiting on a full completion queue see m_stopping and discard their chunk
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+    
+    TerrainChunkResult* result = nullptr;
+    while (m_completed.TryPop(result)) {
+        delete result;
+    }
+}
+
+bool TerrainPipeline::RequestChunk(int32_t chunkX) {
+    if (!m_pending.insert(chunkX).second) {
+        return false;
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(m_requestMutex);
+        m_requests.push_back(chunkX);
+    }
+    m_requestCondition.notify_one();
+    return true;
+}
+
+TerrainChunkResult* TerrainPipeline::PollCompleted() {
+    TerrainChunkResult* result = nullptr;
+    if (!m_completed.TryPop(result)) {
+        return nullptr;
+    }
+    m_pending.erase(result->chunkX);
+    return result;
+}
+
+void TerrainPipeline::WorkerLoop() {
+    while (true) {
+        int32_t chunkX;
+        {
+            std::unique_lock<std::mutex> lock(m_requestMutex);
+            m_requestCondition.wait(lock, [this] { return m_stopping || !m_requests.empty(); });
+            if (m_stopping) return;
+            
+            // Serve the request closest to the focus chunk first
+            int32_t focus = m_focusChunk.load(std::memory_order_relaxed);
+            auto nearest = std::min_element(m_requests.begin(), m_requests.end(),
+                [focus](int32_t a, int32_t b) {
+                    return std::abs(static_cast<int64_t>(a) - focus) < std::abs(static_cast<int64_t>(b) - focus);
+                });
+            chunkX = *nearest;
+            *nearest = m_requests.back();
+            m_requests.pop_back();
+        }
+        
+        TerrainChunkResult* result = new TerrainChunkResult();
+        result->chunkX = chunkX;
+        m_generator.GenerateChunk(chunkX, result->tiles, result->vegetation);
+        
+        while (!m_completed.TryPush(result)) {
+            {
+                std::lock_guard<std::mutex> lock(m_requestMutex);
+                if (m_stopping) {
+                    delete result;
+                    return;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+}
+
+// ===== C API Implementation =====
+
+extern "C" ENGINE_API void* Terrain_CreatePipeline(int seed, int workerCount) {
+    auto* pipeline = new TerrainPipeline(seed, workerCount);
+    printf("[Terrain] Native generator started with %d worker(s), seed %d\n",
+           pipeline->GetWorkerCount(), seed);
+    return pipeline;
+}
+
+extern "C" ENGINE_API void Terrain_DestroyPipeline(void* pipeline) {
+    delete static_cast<TerrainPipeline*>(pipeline);
+}
+
+extern "C" ENGINE_API bool Terrain_RequestChunk(void* pipeline, int chunkX) {
+    return pipeline && static_cast<TerrainPipeline*>(pipeline)->RequestChunk(chunkX);
+}
+
+extern "C" ENGINE_API void Terrain_SetFocusChunk(void* pipeline, int chunkX) {
+    if (pipeline) {
+        static_cast<TerrainPipeline*>(pipeline)->SetFocusChunk(chunkX);
+    }
+}
+
+extern "C" ENGINE_API bool Terrain_PollCompleted(void* pipeline, int* outChunkX, uint8_t* outTiles, uint8_t* outVegetation) {
+    if (!pipeline || !outChunkX || !outTiles || !outVegetation) {
+        return false;
+    }
+    
+    std::unique_ptr<TerrainChunkResult> result(static_cast<TerrainPipeline*>(pipeline)->PollCompleted());
+    if (!result) {
+        return false;
+    }
+    
+    *outChunkX = result->chunkX;
+    std::memcpy(outTiles, result->tiles, ChunkTileCount);
+    std::memcpy(outVegetation, result->vegetation, ChunkWidth);
+    return true;
+}
+
+extern "C" ENGINE_API bool Terrain_GenerateChunk(void* pipeline, int chunkX, uint8_t* outTiles, uint8_t* outVegetation) {
+    if (!pipeline || !outTiles || !outVegetation) {
+        return false;
+    }
+    
+    static_cast<TerrainPipeline*>(pipeline)->GetGenerator().GenerateChunk(chunkX, outTiles, outVegetation);
+    return true;
+}
+
+extern "C" ENGINE_API int Terrain_GetPendingCount(void* pipeline) {
+    return pipeline ? static_cast<TerrainPipeline*>(pipeline)->GetPendingCount() : 0;
+}
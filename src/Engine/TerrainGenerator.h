@@ -0,0 +1,183 @@
+#pragma once
+
+#include "EngineExport.h"
+#include "ChunkStore.h"
+#include "SimplexNoise.h"
+#include "LockFreeQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+// Chronicles of a Drifter - Native Terrain Generation
+// Port of the managed TerrainGenerator/WaterGenerator/VegetationGenerator pipeline,
+// producing the same chunks for the same seed, plus a worker pool for async generation
+
+namespace Chronicles {
+namespace World {
+
+/// <summary>
+/// Biome types; values must match the managed BiomeType enum
+/// </summary>
+enum class BiomeType : uint8_t {
+    Plains,
+    Desert,
+    Forest,
+    Snow,
+    Swamp,
+    Rocky,
+    Jungle,
+    Beach
+};
+
+/// <summary>
+/// Deterministic per-column roll in [0, 100) used for vegetation variety.
+/// Must match VegetationGenerator.VegetationRoll in C#.
+/// </summary>
+inline int VegetationRoll(int32_t seed, int32_t worldX) {
+    uint32_t h = static_cast<uint32_t>(seed) * 0x9E3779B1u ^ static_cast<uint32_t>(worldX) * 0x85EBCA77u;
+    h ^= h >> 15;
+    h *= 0x2C1B3C6Du;
+    h ^= h >> 12;
+    h *= 0x297A2D39u;
+    h ^= h >> 15;
+    return static_cast<int>(h % 100u);
+}
+
+/// <summary>
+/// Stateless chunk generator. GenerateChunk is safe to call from multiple threads.
+/// </summary>
+class TerrainGenerator {
+public:
+    explicit TerrainGenerator(int32_t seed);
+    
+    int32_t GetSeed() const { return m_seed; }
+    
+    /// <summary>
+    /// Generate a chunk into caller-provided buffers
+    /// </summary>
+    /// <param name="tiles">ChunkTileCount bytes, row-major (y * ChunkWidth + x)</param>
+    /// <param name="vegetation">ChunkWidth bytes, 0 = no vegetation</param>
+    void GenerateChunk(int32_t chunkX, uint8_t* tiles, uint8_t* vegetation) const;
+    
+    BiomeType GetBiomeAt(int32_t worldX) const;
+
+private:
+    void GenerateWater(uint8_t* tiles, int32_t startX, const BiomeType* biomeMap) const;
+    void GenerateVegetation(const uint8_t* tiles, uint8_t* vegetation, int32_t startX,
+                            const BiomeType* biomeMap) const;
+    
+    int32_t m_seed;
+    Noise::SimplexNoise m_noise;
+};
+
+/// <summary>
+/// A finished chunk waiting to be picked up by the main thread
+/// </summary>
+struct TerrainChunkResult {
+    int32_t chunkX;
+    uint8_t tiles[ChunkTileCount];
+    uint8_t vegetation[ChunkWidth];
+};
+
+/// <summary>
+/// Worker pool that generates requested chunks in the background.
+/// Requests are served nearest-to-focus first; finished chunks are handed back
+/// through a lock-free queue so polling never blocks on the workers.
+/// RequestChunk/PollCompleted must be called from a single (main) thread.
+/// </summary>
+class TerrainPipeline {
+public:
+    TerrainPipeline(int32_t seed, int workerCount);
+    ~TerrainPipeline();
+    
+    TerrainPipeline(const TerrainPipeline&) = delete;
+    TerrainPipeline& operator=(const TerrainPipeline&) = delete;
+    
+    const TerrainGenerator& GetGenerator() const { return m_generator; }
+    
+    /// <summary>
+    /// Queue a chunk; returns false if it is already queued or awaiting pickup
+    /// </summary>
+    bool RequestChunk(int32_t chunkX);
+    
+    /// <summary>
+    /// Chunk around which pending requests are prioritized (usually the player's)
+    /// </summary>
+    void SetFocusChunk(int32_t chunkX) { m_focusChunk.store(chunkX, std::memory_order_relaxed); }
+    
+    /// <summary>
+    /// Take one finished chunk; returns nullptr if none are ready.
+    /// The caller owns the result and must delete it.
+    /// </summary>
+    TerrainChunkResult* PollCompleted();
+    
+    int GetPendingCount() const { return static_cast<int>(m_pending.size()); }
+    int GetWorkerCount() const { return static_cast<int>(m_workers.size()); }
+
+private:
+    void WorkerLoop();
+    
+    TerrainGenerator m_generator;
+    std::vector<std::thread> m_workers;
+    
+    std::mutex m_requestMutex;
+    std::condition_variable m_requestCondition;
+    std::vector<int32_t> m_requests;
+    bool m_stopping;
+    
+    std::atomic<int32_t> m_focusChunk;
+    std::unordered_set<int32_t> m_pending;  // Requested and not yet polled (main thread only)
+    LockFreeQueue<TerrainChunkResult*> m_completed;
+};
+
+} // namespace World
+} // namespace Chronicles
+
+// C API for cross-language access
+// Each pipeline is independent, so several worlds (or tests) can generate side by side
+extern "C" {
+    /// <summary>
+    /// Start a terrain worker pool
+    /// </summary>
+    /// <param name="seed">World seed (same value passed to the managed TerrainGenerator)</param>
+    /// <param name="workerCount">Worker threads, or &lt;= 0 for one per core minus one</param>
+    /// <returns>Pipeline handle for the other Terrain_ functions</returns>
+    ENGINE_API void* Terrain_CreatePipeline(int seed, int workerCount);
+    
+    /// <summary>
+    /// Stop the worker pool and discard unfinished chunks
+    /// </summary>
+    ENGINE_API void Terrain_DestroyPipeline(void* pipeline);
+    
+    /// <summary>
+    /// Queue a chunk for background generation
+    /// </summary>
+    /// <returns>false if the chunk is already pending</returns>
+    ENGINE_API bool Terrain_RequestChunk(void* pipeline, int chunkX);
+    
+    /// <summary>
+    /// Set the chunk around which pending requests are prioritized
+    /// </summary>
+    ENGINE_API void Terrain_SetFocusChunk(void* pipeline, int chunkX);
+    
+    /// <summary>
+    /// Retrieve one finished chunk
+    /// </summary>
+    /// <param name="outTiles">ChunkWidth * ChunkHeight bytes, row-major</param>
+    /// <param name="outVegetation">ChunkWidth bytes, 0 = none</param>
+    /// <returns>true if a chunk was written to the output buffers</returns>
+    ENGINE_API bool Terrain_PollCompleted(void* pipeline, int* outChunkX, uint8_t* outTiles, uint8_t* outVegetation);
+    
+    /// <summary>
+    /// Generate a chunk synchronously on the calling thread
+    /// </summary>
+    ENGINE_API bool Terrain_GenerateChunk(void* pipeline, int chunkX, uint8_t* outTiles, uint8_t* outVegetation);
+    
+    /// <summary>
+    /// Number of chunks requested but not yet polled
+    /// </summary>
+    ENGINE_API int Terrain_GetPendingCount(void* pipeline);
+}
@@ -0,0 +1,246 @@
+#include "TextureAtlas.h"
+#include "TextureLoader.h"
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <unordered_map>
+
+namespace Chronicles {
+
+// ===== SkylinePacker Implementation =====
+
+SkylinePacker::SkylinePacker(int width, int height)
+    : m_width(width)
+    , m_height(height)
+    , m_usedHeight(0)
+{
+    m_skyline.push_back({ 0, 0, width });
+}
+
+bool SkylinePacker::Insert(int width, int height, int& outX, int& outY) {
+    int bestTop = m_height + 1;
+    int bestSegmentWidth = m_width + 1;
+    size_t bestIndex = m_skyline.size();
+    int bestY = 0;
+    
+    for (size_t i = 0; i < m_skyline.size(); i++) {
+        int y = FitAt(i, width, height);
+        if (y < 0) {
+            continue;
+        }
+        
+        // Lowest top edge wins; ties go to the narrowest segment to keep gaps small
+        int top = y + height;
+        if (top < bestTop || (top == bestTop && m_skyline[i].width < bestSegmentWidth)) {
+            bestTop = top;
+            bestSegmentWidth = m_skyline[i].width;
+            bestIndex = i;
+            bestY = y;
+        }
+    }
+    
+    if (bestIndex == m_skyline.size()) {
+        return false;
+    }
+    
+    outX = m_skyline[bestIndex].x;
+    outY = bestY;
+    AddLevel(bestIndex, outX, outY, width, height);
+    m_usedHeight = std::max(m_usedHeight, outY + height);
+    return true;
+}
+
+int SkylinePacker::FitAt(size_t index, int width, int height) const {
+    int x = m_skyline[index].x;
+    if (x + width > m_width) {
+        return -1;
+    }
+    
+    // The rectangle rests on the highest segment it spans
+    int y = m_skyline[index].y;
+    int remaining = width;
+    for (size_t i = index; remaining > 0; i++) {
+        y = std::max(y, m_skyline[i].y);
+        if (y + height > m_height) {
+            return -1;
+        }
+        remaining -= m_skyline[i].width;
+    }
+    return y;
+}
+
+void SkylinePacker::AddLevel(size_t index, int x, int y, int width, int height) {
+    m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(index), { x, y + height, width });
+    
+    // Trim or remove the segments now hidden under the new one
+    for (size_t i = index + 1; i < m_skyline.size(); ) {
+        int previousEnd = m_skyline[i - 1].x + m_skyline[i - 1].width;
+        if (m_skyline[i].x >= previousEnd) {
+            break;
+        }
+        int overlap = previousEnd - m_skyline[i].x;
+        if (m_skyline[i].width <= overlap) {
+            m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+        m_skyline[i].x += overlap;
+        m_skyline[i].width -= overlap;
+        break;
+    }
+    
+    // Merge neighbours at the same height
+    for (size_t i = 0; i + 1 < m_skyline.size(); ) {
+        if (m_skyline[i].y == m_skyline[i + 1].y) {
+            m_skyline[i].width += m_skyline[i + 1].width;
+            m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        } else {
+            i++;
+        }
+    }
+}
+
+// ===== Atlas Packing =====
+
+bool PackAtlas(const int* widths, const int* heights, int count, int pageSize, int padding,
+               AtlasLayout& outLayout) {
+    outLayout.placements.assign(static_cast<size_t>(count > 0 ? count : 0), AtlasPlacement{ -1, 0, 0 });
+    outLayout.pageHeights.clear();
+    if (count <= 0 || pageSize <= 0) {
+        return count == 0;
+    }
+    
+    for (int i = 0; i < count; i++) {
+        if (widths[i] <= 0 || heights[i] <= 0 ||
+            widths[i] + padding > pageSize || heights[i] + padding > pageSize) {
+            return false;
+        }
+    }
+    
+    // Tallest first (then widest) keeps the skyline flat
+    std::vector<int> order(static_cast<size_t>(count));
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+        if (heights[a] != heights[b]) return heights[a] > heights[b];
+        return widths[a] > widths[b];
+    });
+    
+    std::vector<SkylinePacker> pages;
+    for (int index : order) {
+        const int width = widths[index] + padding;
+        const int height = heights[index] + padding;
+        
+        AtlasPlacement& placement = outLayout.placements[static_cast<size_t>(index)];
+        for (size_t page = 0; page < pages.size(); page++) {
+            if (pages[page].Insert(width, height, placement.x, placement.y)) {
+                placement.page = static_cast<int>(page);
+                break;
+            }
+        }
+        
+        if (placement.page < 0) {
+            pages.emplace_back(pageSize, pageSize);
+            pages.back().Insert(width, height, placement.x, placement.y);
+            placement.page = static_cast<int>(pages.size() - 1);
+        }
+    }
+    
+    for (const SkylinePacker& page : pages) {
+        outLayout.pageHeights.push_back(page.GetUsedHeight());
+    }
+    return true;
+}
+
+// ===== Atlas Composition =====
+
+bool ComposeAtlas(const AtlasSpriteSource* sprites, int count, int pageSize, int padding,
+                  AtlasLayout& outLayout, std::vector<std::vector<uint8_t>>& outPages,
+                  std::string& outError) {
+    outPages.clear();
+    if (!sprites || count <= 0) {
+        outError = "No atlas regions";
+        return false;
+    }
+    
+    // Decode each distinct source image once
+    struct SourceImage {
+        int width = 0;
+        int height = 0;
+        std::vector<uint8_t> pixels;
+    };
+    std::unordered_map<std::string, SourceImage> images;
+    std::vector<const SourceImage*> spriteImages(count, nullptr);
+    std::vector<int> widths(count);
+    std::vector<int> heights(count);
+    
+    for (int i = 0; i < count; i++) {
+        const AtlasSpriteSource& sprite = sprites[i];
+        widths[i] = sprite.width;
+        heights[i] = sprite.height;
+        if (!sprite.texturePath) {
+            continue;
+        }
+        
+        auto it = images.find(sprite.texturePath);
+        if (it == images.end()) {
+            SourceImage image;
+            std::string error;
+            if (!DecodeImageFile(sprite.texturePath, image.width, image.height, image.pixels, error)) {
+                outError = std::string("Failed to load atlas image ") + sprite.texturePath + ": " + error;
+                return false;
+            }
+            it = images.emplace(sprite.texturePath, std::move(image)).first;
+        }
+        
+        const SourceImage* image = &it->second;
+        if (sprite.srcX < 0 || sprite.srcY < 0 ||
+            sprite.srcX + sprite.width > image->width || sprite.srcY + sprite.height > image->height) {
+            outError = "Atlas region " + std::to_string(i) + " lies outside " + sprite.texturePath;
+            return false;
+        }
+        spriteImages[i] = image;
+    }
+    
+    if (!PackAtlas(widths.data(), heights.data(), count, pageSize, padding, outLayout)) {
+        outError = "Atlas regions must be non-empty and fit on a " +
+                   std::to_string(pageSize) + "x" + std::to_string(pageSize) + " page";
+        return false;
+    }
+    
+    const size_t pageCount = outLayout.pageHeights.size();
+    outPages.resize(pageCount);
+    for (size_t page = 0; page < pageCount; page++) {
+        outPages[page].assign(static_cast<size_t>(pageSize) * outLayout.pageHeights[page] * 4, 0);
+    }
+    
+    const size_t destPitch = static_cast<size_t>(pageSize) * 4;
+    for (int i = 0; i < count; i++) {
+        const AtlasSpriteSource& sprite = sprites[i];
+        const AtlasPlacement& placement = outLayout.placements[i];
+        uint8_t* dest = outPages[placement.page].data() + static_cast<size_t>(placement.y) * destPitch + static_cast<size_t>(placement.x) * 4;
+        
+        if (const SourceImage* image = spriteImages[i]) {
+            const size_t srcPitch = static_cast<size_t>(image->width) * 4;
+            const uint8_t* src = image->pixels.data() + static_cast<size_t>(sprite.srcY) * srcPitch + static_cast<size_t>(sprite.srcX) * 4;
+            for (int row = 0; row < sprite.height; row++) {
+                memcpy(dest + row * destPitch, src + row * srcPitch, static_cast<size_t>(sprite.width) * 4);
+            }
+        } else {
+            const uint8_t color[4] = {
+                static_cast<uint8_t>(sprite.r * 255),
+                static_cast<uint8_t>(sprite.g * 255),
+                static_cast<uint8_t>(sprite.b * 255),
+                static_cast<uint8_t>(sprite.a * 255)
+            };
+            for (int row = 0; row < sprite.height; row++) {
+                uint8_t* pixel = dest + row * destPitch;
+                for (int col = 0; col < sprite.width; col++, pixel += 4) {
+                    memcpy(pixel, color, 4);
+                }
+            }
+        }
+    }
+    
+    return true;
+}
+
+} // namespace Chronicles
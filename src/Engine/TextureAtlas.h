@@ -0,0 +1,84 @@
+#pragma once
+
+#include "ChroniclesEngine.h"  // For AtlasSpriteSource
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Chronicles of a Drifter - Texture Atlas Packing
+// Backend-independent rectangle packing used to combine many small images
+// (tileset tiles, sprites) into a few large atlas pages
+
+namespace Chronicles {
+
+/// <summary>
+/// Skyline bottom-left rectangle packer for a single fixed-size page.
+/// The skyline is the upper contour of everything placed so far; each rectangle
+/// goes where its top edge ends up lowest, which wastes little space for
+/// similarly sized tiles.
+/// </summary>
+class SkylinePacker {
+public:
+    SkylinePacker(int width, int height);
+    
+    /// <summary>
+    /// Reserve a width x height area; returns false if it does not fit on the page
+    /// </summary>
+    bool Insert(int width, int height, int& outX, int& outY);
+    
+    /// <summary>
+    /// Height of the tallest column in use (pages can be trimmed to this)
+    /// </summary>
+    int GetUsedHeight() const { return m_usedHeight; }
+
+private:
+    struct Segment {
+        int x;
+        int y;
+        int width;
+    };
+    
+    // Y at which a width x height rectangle would sit if placed at segment index, or -1
+    int FitAt(size_t index, int width, int height) const;
+    void AddLevel(size_t index, int x, int y, int width, int height);
+    
+    int m_width;
+    int m_height;
+    int m_usedHeight;
+    std::vector<Segment> m_skyline;
+};
+
+/// <summary>
+/// Where one input rectangle ended up
+/// </summary>
+struct AtlasPlacement {
+    int page;
+    int x;
+    int y;
+};
+
+struct AtlasLayout {
+    std::vector<AtlasPlacement> placements;  // One per input rectangle, in input order
+    std::vector<int> pageHeights;            // Used height of each page
+};
+
+/// <summary>
+/// Pack rectangles onto as few pageSize x pageSize pages as possible.
+/// Each rectangle is reserved with padding extra pixels on its right and bottom
+/// so neighbours never bleed into each other when sampled.
+/// </summary>
+/// <returns>false if a rectangle has a non-positive size or cannot fit on an empty page</returns>
+bool PackAtlas(const int* widths, const int* heights, int count, int pageSize, int padding,
+               AtlasLayout& outLayout);
+
+/// <summary>
+/// Decode the source images (each distinct file once), pack the regions and compose
+/// RGBA8 pages of pageSize x pageHeights[page] pixels ready for upload.
+/// </summary>
+/// <param name="outError">Reason for failure, if any</param>
+bool ComposeAtlas(const AtlasSpriteSource* sprites, int count, int pageSize, int padding,
+                  AtlasLayout& outLayout, std::vector<std::vector<uint8_t>>& outPages,
+                  std::string& outError);
+
+} // namespace Chronicles
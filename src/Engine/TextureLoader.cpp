@@ -0,0 +1,306 @@
+#include "TextureLoader.h"
+#include "IRenderer.h"
+#include "MappedFile.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#ifdef HAS_LIBPNG
+#include <png.h>
+#endif
+#ifdef HAS_SDL2
+#include <SDL2/SDL.h>
+#endif
+
+namespace Chronicles {
+
+namespace {
+    const size_t CompletedQueueCapacity = 64;
+
+#if defined(HAS_LIBPNG) || defined(HAS_SDL2)
+    bool TryResize(std::vector<uint8_t>& buffer, size_t size) {
+        try {
+            buffer.resize(size);
+            return true;
+        } catch (const std::bad_alloc&) {
+            buffer.clear();
+            return false;
+        }
+    }
+#endif
+
+    bool DecodePng(const uint8_t* data, size_t size, int& outWidth, int& outHeight,
+                   std::vector<uint8_t>& outPixels, std::string& outError) {
+#ifdef HAS_LIBPNG
+        png_image image;
+        memset(&image, 0, sizeof(image));
+        image.version = PNG_IMAGE_VERSION;
+        
+        if (!png_image_begin_read_from_memory(&image, data, size)) {
+            outError = image.message;
+            return false;
+        }
+        
+        image.format = PNG_FORMAT_RGBA;
+        // The header may claim far more than memory holds; this runs on loader threads,
+        // where an escaping exception would end the process
+        if (!TryResize(outPixels, PNG_IMAGE_SIZE(image))) {
+            outError = "Image too large to decode";
+            png_image_free(&image);
+            return false;
+        }
+        if (!png_image_finish_read(&image, nullptr, outPixels.data(), 0, nullptr)) {
+            outError = image.message;
+            png_image_free(&image);
+            return false;
+        }
+        
+        outWidth = static_cast<int>(image.width);
+        outHeight = static_cast<int>(image.height);
+        return true;
+#else
+        (void)data; (void)size; (void)outWidth; (void)outHeight; (void)outPixels;
+        outError = "PNG support not available (engine built without libpng)";
+        return false;
+#endif
+    }
+    
+    bool DecodeBmp(const uint8_t* data, size_t size, int& outWidth, int& outHeight,
+                   std::vector<uint8_t>& outPixels, std::string& outError) {
+#ifdef HAS_SDL2
+        SDL_Surface* loaded = SDL_LoadBMP_RW(SDL_RWFromConstMem(data, static_cast<int>(size)), 1);
+        if (!loaded) {
+            outError = SDL_GetError();
+            return false;
+        }
+        SDL_Surface* image = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+        SDL_FreeSurface(loaded);
+        if (!image) {
+            outError = SDL_GetError();
+            return false;
+        }
+        
+        const size_t rowBytes = static_cast<size_t>(image->w) * 4;
+        if (!TryResize(outPixels, rowBytes * image->h)) {
+            outError = "Image too large to decode";
+            SDL_FreeSurface(image);
+            return false;
+        }
+        for (int row = 0; row < image->h; row++) {
+            memcpy(outPixels.data() + row * rowBytes,
+                   static_cast<const uint8_t*>(image->pixels) + static_cast<size_t>(row) * image->pitch, rowBytes);
+        }
+        
+        outWidth = image->w;
+        outHeight = image->h;
+        SDL_FreeSurface(image);
+        return true;
+#else
+        (void)data; (void)size; (void)outWidth; (void)outHeight; (void)outPixels;
+        outError = "BMP support not available (engine built without SDL2)";
+        return false;
+#endif
+    }
+}
+
+// ===== Image Decoding/Encoding =====
+
+bool DecodeImageFile(const char* filePath, int& outWidth, int& outHeight,
+                     std::vector<uint8_t>& outPixels, std::string& outError) {
+    if (!filePath) {
+        outError = "No file path";
+        return false;
+    }
+    
+    // Decoders read the compressed image straight from the mapping
+    MappedFile file;
+    if (!file.Open(filePath)) {
+        outError = "Cannot open file";
+        return false;
+    }
+    file.Prefetch(0, file.GetSize());
+    const uint8_t* data = file.GetData();
+    const size_t size = file.GetSize();
+    
+    static const unsigned char PngSignature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    if (size >= sizeof(PngSignature) && memcmp(data, PngSignature, sizeof(PngSignature)) == 0) {
+        return DecodePng(data, size, outWidth, outHeight, outPixels, outError);
+    }
+    if (size >= 2 && data[0] == 'B' && data[1] == 'M') {
+        if (size > static_cast<size_t>(INT_MAX)) {
+            outError = "BMP file too large";
+            return false;
+        }
+        return DecodeBmp(data, size, outWidth, outHeight, outPixels, outError);
+    }
+    
+    outError = "Unsupported image format (expected PNG or BMP)";
+    return false;
+}
+
+bool WritePngFile(const char* filePath, int width, int height,
+                  const uint8_t* rgbaPixels, std::string& outError) {
+    if (!filePath || !rgbaPixels || width <= 0 || height <= 0) {
+        outError = "Invalid image";
+        return false;
+    }
+
+#ifdef HAS_LIBPNG
+    png_image image;
+    memset(&image, 0, sizeof(image));
+    image.version = PNG_IMAGE_VERSION;
+    image.width = static_cast<png_uint_32>(width);
+    image.height = static_cast<png_uint_32>(height);
+    image.format = PNG_FORMAT_RGBA;
+    
+    if (!png_image_write_to_file(&image, filePath, 0, rgbaPixels, 0, nullptr)) {
+        outError = image.message;
+        return false;
+    }
+    return true;
+#else
+    outError = "PNG support not available (engine built without libpng)";
+    return false;
+#endif
+}
+
+// ===== TextureLoader Implementation =====
+
+TextureLoader::TextureLoader(int workerCount)
+    : m_stopping(false)
+    , m_completed(CompletedQueueCapacity)
+    , m_deferred(nullptr) {
+    if (workerCount <= 0) {
+        workerCount = std::clamp(static_cast<int>(std::thread::hardware_concurrency()) / 2, 1, 4);
+    }
+    
+    m_workers.reserve(workerCount);
+    for (int i = 0; i < workerCount; i++) {
+        m_workers.emplace_back(&TextureLoader::WorkerLoop, this);
+    }
+}
+
+TextureLoader::~TextureLoader() {
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_stopping = true;
+        m_jobs.clear();
+    }
+    m_jobCondition.notify_all();
+    
+    // Workers waiting on a full completion queue see m_stopping and discard their image
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+    
+    delete m_deferred;
+    DecodedImage* image = nullptr;
+    while (m_completed.TryPop(image)) {
+        delete image;
+    }
+}
+
+void TextureLoader::Request(int textureId, const char* filePath) {
+    m_states[textureId] = TEXTURE_STATE_PENDING;
+    {
+        std::lock_guard<std::mutex> lock(m_jobMutex);
+        m_jobs.push_back({ textureId, filePath });
+    }
+    m_jobCondition.notify_one();
+}
+
+void TextureLoader::Cancel(int textureId) {
+    if (m_states.erase(textureId) == 0) {
+        return;
+    }
+    
+    std::lock_guard<std::mutex> lock(m_jobMutex);
+    m_jobs.erase(std::remove_if(m_jobs.begin(), m_jobs.end(),
+                                [textureId](const Job& job) { return job.textureId == textureId; }),
+                 m_jobs.end());
+}
+
+int TextureLoader::GetState(int textureId) const {
+    auto it = m_states.find(textureId);
+    return it != m_states.end() ? it->second : TEXTURE_STATE_INVALID;
+}
+
+int TextureLoader::UploadCompleted(IRenderer& renderer, size_t byteBudget) {
+    int uploaded = 0;
+    size_t uploadedBytes = 0;
+    
+    while (true) {
+        DecodedImage* image = m_deferred;
+        m_deferred = nullptr;
+        if (!image && !m_completed.TryPop(image)) {
+            break;
+        }
+        
+        // Cancelled while decoding
+        auto state = m_states.find(image->textureId);
+        if (state == m_states.end()) {
+            delete image;
+            continue;
+        }
+        
+        if (!image->succeeded) {
+            state->second = TEXTURE_STATE_FAILED;
+            delete image;
+            continue;
+        }
+        
+        if (uploaded > 0 && uploadedBytes + image->pixels.size() > byteBudget) {
+            m_deferred = image;
+            break;
+        }
+        
+        bool ok = renderer.UploadTexture(image->textureId, image->pixels.data(), image->width, image->height);
+        state->second = ok ? TEXTURE_STATE_READY : TEXTURE_STATE_FAILED;
+        uploadedBytes += image->pixels.size();
+        uploaded++;
+        delete image;
+    }
+    
+    return uploaded;
+}
+
+void TextureLoader::WorkerLoop() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_jobMutex);
+            m_jobCondition.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+            if (m_stopping) return;
+            
+            job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+        }
+        
+        CHRONICLES_PROFILE_SCOPE("DecodeTexture");
+        DecodedImage* image = new DecodedImage();
+        image->textureId = job.textureId;
+        image->width = 0;
+        image->height = 0;
+        
+        std::string error;
+        image->succeeded = DecodeImageFile(job.filePath.c_str(), image->width, image->height, image->pixels, error);
+        if (!image->succeeded) {
+            printf("[TextureLoader] ERROR: Failed to decode %s: %s\n", job.filePath.c_str(), error.c_str());
+        }
+        
+        while (!m_completed.TryPush(image)) {
+            {
+                std::lock_guard<std::mutex> lock(m_jobMutex);
+                if (m_stopping) {
+                    delete image;
+                    return;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+}
+
+} // namespace Chronicles
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "LockFreeQueue.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Chronicles of a Drifter - Image Decoding/Encoding and Asynchronous Texture Loading
+// Files are decoded to RGBA8 on worker threads; the render thread uploads the
+// finished images a few at a time so loading never stalls a frame
+
+namespace Chronicles {
+
+class IRenderer;
+
+/// <summary>
+/// Decode a PNG or BMP file (detected by its signature) into tightly packed RGBA8 pixels.
+/// Safe to call from any thread.
+/// </summary>
+/// <param name="outError">Reason for failure, if any</param>
+bool DecodeImageFile(const char* filePath, int& outWidth, int& outHeight,
+                     std::vector<uint8_t>& outPixels, std::string& outError);
+
+/// <summary>
+/// Write tightly packed RGBA8 pixels to a PNG file. Requires libpng.
+/// </summary>
+/// <param name="outError">Reason for failure, if any</param>
+bool WritePngFile(const char* filePath, int width, int height,
+                  const uint8_t* rgbaPixels, std::string& outError);
+
+/// <summary>
+/// Worker pool that decodes texture files in the background.
+/// Request/Cancel/GetState/UploadCompleted must all be called from the render thread.
+/// </summary>
+class TextureLoader {
+public:
+    explicit TextureLoader(int workerCount);
+    ~TextureLoader();
+    
+    TextureLoader(const TextureLoader&) = delete;
+    TextureLoader& operator=(const TextureLoader&) = delete;
+    
+    /// <summary>
+    /// Queue a file to be decoded into the texture ID reserved for it
+    /// </summary>
+    void Request(int textureId, const char* filePath);
+    
+    /// <summary>
+    /// Forget a texture; a decode still in flight is discarded when it finishes
+    /// </summary>
+    void Cancel(int textureId);
+    
+    /// <summary>
+    /// TEXTURE_STATE_* value for a requested texture (TEXTURE_STATE_INVALID if unknown)
+    /// </summary>
+    int GetState(int textureId) const;
+    
+    /// <summary>
+    /// Upload finished images until byteBudget bytes of pixels have been uploaded.
+    /// At least one image is uploaded per call so oversized images still make progress.
+    /// </summary>
+    /// <returns>Number of textures uploaded</returns>
+    int UploadCompleted(IRenderer& renderer, size_t byteBudget);
+
+private:
+    struct Job {
+        int textureId;
+        std::string filePath;
+    };
+    
+    struct DecodedImage {
+        int textureId;
+        int width;
+        int height;
+        bool succeeded;
+        std::vector<uint8_t> pixels;
+    };
+    
+    void WorkerLoop();
+    
+    std::vector<std::thread> m_workers;
+    
+    std::mutex m_jobMutex;
+    std::condition_variable m_jobCondition;
+    std::deque<Job> m_jobs;
+    bool m_stopping;
+    
+    LockFreeQueue<DecodedImage*> m_completed;
+    DecodedImage* m_deferred;                   // Dequeued but over this frame's budget
+    std::unordered_map<int, int> m_states;      // Render thread only
+};
+
+} // namespace Chronicles
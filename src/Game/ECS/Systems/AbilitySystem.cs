@@ -134,7 +134,7 @@ public class AbilitySystem : ISystem
         {
             foreach (var (key, abilityType) in KeyBindings)
             {
-                if (EngineInterop.Input_IsKeyPressed(key))
+                if (FrameInput.IsKeyPressed(key))
                 {
                     if (abilityComp.UseAbility(abilityType, _gameTime))
                     {
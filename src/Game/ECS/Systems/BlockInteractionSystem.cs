@@ -56,7 +56,7 @@ public class BlockInteractionSystem : ISystem
         HandleBlockSelection(inventory);
         
         // Mining logic
-        if (EngineInterop.Input_IsKeyDown(KEY_M))
+        if (FrameInput.IsKeyDown(KEY_M))
         {
             HandleMining(world, chunkManager, playerEntity.Value, playerPos, inventory, currentTool, deltaTime);
         }
@@ -66,7 +66,7 @@ public class BlockInteractionSystem : ISystem
         }
         
         // Placing logic
-        if (EngineInterop.Input_IsKeyPressed(KEY_P))
+        if (FrameInput.IsKeyPressed(KEY_P))
         {
             HandlePlacement(world, chunkManager, playerPos, inventory);
         }
@@ -78,7 +78,7 @@ public class BlockInteractionSystem : ISystem
         for (int i = 1; i <= 9; i++)
         {
             int keyCode = 48 + i; // ASCII codes for '1' to '9'
-            if (EngineInterop.Input_IsKeyPressed(keyCode))
+            if (FrameInput.IsKeyPressed(keyCode))
             {
                 // Get the i-th item from inventory
                 var items = inventory.GetAllItems();
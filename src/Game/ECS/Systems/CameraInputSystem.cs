@@ -31,14 +31,14 @@ public class CameraInputSystem : ISystem
                 continue;
             
             // Zoom in (+ or = keys)
-            if (EngineInterop.Input_IsKeyDown(KEY_EQUALS) || EngineInterop.Input_IsKeyDown(KEY_PLUS))
+            if (FrameInput.IsKeyDown(KEY_EQUALS) || FrameInput.IsKeyDown(KEY_PLUS))
             {
                 camera.Zoom += _zoomSpeed * deltaTime;
                 camera.Zoom = MathF.Min(camera.Zoom, 4.0f); // Max zoom 4x
             }
             
             // Zoom out (- or _ keys)
-            if (EngineInterop.Input_IsKeyDown(KEY_MINUS) || EngineInterop.Input_IsKeyDown(KEY_UNDERSCORE))
+            if (FrameInput.IsKeyDown(KEY_MINUS) || FrameInput.IsKeyDown(KEY_UNDERSCORE))
             {
                 camera.Zoom -= _zoomSpeed * deltaTime;
                 camera.Zoom = MathF.Max(camera.Zoom, 0.25f); // Min zoom 0.25x
@@ -1,4 +1,5 @@
 using ChroniclesOfADrifter.ECS.Components;
+using ChroniclesOfADrifter.Engine;
 using ChroniclesOfADrifter.Terrain;
 
 namespace ChroniclesOfADrifter.ECS.Systems;
@@ -6,15 +7,63 @@ namespace ChroniclesOfADrifter.ECS.Systems;
 /// <summary>
 /// Collision detection and resolution system
 /// Handles entity-to-terrain and entity-to-entity collisions
+/// Entity-to-entity collisions run in the native physics world (grid broadphase) when
+/// the engine library is loaded, falling back to testing every pair here otherwise;
+/// both send a blocked mover back to where it was
 /// </summary>
 public class CollisionSystem : ISystem
 {
     private ChunkManager? _chunkManager;
     private const float BLOCK_SIZE = 32.0f; // Size of a block in world units
     
+    private static bool? _nativePhysics;
+    
+    // Entities with a native body
+    private HashSet<int> _bodies = new();
+    private HashSet<int> _seenBodies = new();
+    
+    // This frame's moving entities, where they start and where terrain lets them go
+    private struct Mover
+    {
+        public Entity Entity;
+        public CollisionComponent Collision;
+        public PositionComponent Position;
+        public float FromX, FromY, ToX, ToY;
+        public bool Reverted;
+    }
+    private readonly List<Mover> _movers = new();
+    private readonly Dictionary<int, int> _moverIndices = new();
+    private readonly List<int> _blocked = new();
+    
     public void Initialize(World world)
     {
         // Chunk manager will be set externally by scenes that need terrain collision
+        
+        // The engine has a single physics world; the active scene's collision system owns it
+        if (UseNativePhysics)
+        {
+            EngineInterop.Physics_ClearBodies();
+        }
+    }
+    
+    private static bool UseNativePhysics => _nativePhysics ??= ProbeNativePhysics();
+    
+    /// <summary>
+    /// Whether entity collisions run in the native physics world (the engine library is loaded)
+    /// </summary>
+    public static bool IsNativePhysicsAvailable => UseNativePhysics;
+    
+    private static bool ProbeNativePhysics()
+    {
+        try
+        {
+            EngineInterop.Physics_GetBodyCount();
+            return true;
+        }
+        catch (Exception ex) when (ex is DllNotFoundException || ex is EntryPointNotFoundException)
+        {
+            return false;
+        }
     }
     
     /// <summary>
@@ -30,6 +79,8 @@ public class CollisionSystem : ISystem
         // Get all entities with collision components
         var collisionEntities = world.GetEntitiesWithComponent<CollisionComponent>().ToList();
         
+        _movers.Clear();
+        _moverIndices.Clear();
         foreach (var entity in collisionEntities)
         {
             var collision = world.GetComponent<CollisionComponent>(entity);
@@ -54,16 +105,90 @@ public class CollisionSystem : ISystem
                     collision, position.X, position.Y, desiredX, desiredY);
             }
             
-            // Check entity-to-entity collision if enabled
-            if (collision.CheckEntities)
+            _moverIndices[entity.Id] = _movers.Count;
+            _movers.Add(new Mover
+            {
+                Entity = entity, Collision = collision, Position = position,
+                FromX = position.X, FromY = position.Y, ToX = desiredX, ToY = desiredY
+            });
+        }
+        
+        // Entity-to-entity collision moves everything at once: a mover that would overlap
+        // something it collides with goes back to where it was, whichever order they are in
+        if (UseNativePhysics)
+        {
+            UpdateNative(world, collisionEntities);
+        }
+        else
+        {
+            ResolveEntityCollisions(world, collisionEntities);
+        }
+        
+        // Update position with collision-resolved coordinates
+        foreach (var mover in _movers)
+        {
+            mover.Position.X = mover.Reverted ? mover.FromX : mover.ToX;
+            mover.Position.Y = mover.Reverted ? mover.FromY : mover.ToY;
+        }
+    }
+    
+    /// <summary>
+    /// Mirrors collision entities into the native physics world and steps it to find
+    /// which movers are blocked by other entities
+    /// </summary>
+    private void UpdateNative(World world, List<Entity> collisionEntities)
+    {
+        _seenBodies.Clear();
+        
+        foreach (var entity in collisionEntities)
+        {
+            var collision = world.GetComponent<CollisionComponent>(entity);
+            var position = world.GetComponent<PositionComponent>(entity);
+            
+            if (collision == null || position == null)
+                continue;
+            
+            // Bodies are boxes around the collision center; entities that skip entity
+            // checks still block others but are blocked by nothing
+            bool moves = _moverIndices.TryGetValue(entity.Id, out int index);
+            var flags = moves ? PhysicsBodyFlags.NoSlide | PhysicsBodyFlags.NoGravity : PhysicsBodyFlags.Static;
+            float centerX = position.X + collision.OffsetX;
+            float centerY = position.Y + collision.OffsetY;
+            EngineInterop.Physics_CreateBody(entity.Id, centerX, centerY, collision.Width, collision.Height, flags,
+                (int)collision.Layer, collision.CheckEntities ? (int)collision.CollidesWith : 0);
+            _seenBodies.Add(entity.Id);
+            
+            // A one-second step with the frame's move as velocity lands bodies on their targets
+            if (moves)
             {
-                (desiredX, desiredY) = ResolveEntityCollisions(
-                    world, entity, collision, position.X, position.Y, desiredX, desiredY, collisionEntities);
+                var mover = _movers[index];
+                EngineInterop.Physics_SetBodyState(entity.Id, centerX, centerY,
+                    mover.ToX - mover.FromX, mover.ToY - mover.FromY);
             }
+        }
+        
+        // Drop bodies of entities that were destroyed or lost their collision component
+        foreach (int id in _bodies)
+        {
+            if (!_seenBodies.Contains(id))
+                EngineInterop.Physics_DestroyBody(id);
+        }
+        (_bodies, _seenBodies) = (_seenBodies, _bodies);
+        
+        EngineInterop.Physics_Step(1.0f);
+        
+        // Blocked bodies are back where they started; the rest keep their exact target
+        for (int i = 0; i < _movers.Count; i++)
+        {
+            var mover = _movers[i];
+            if (!EngineInterop.Physics_GetBodyState(mover.Entity.Id, out float x, out float y, out _, out _))
+                continue;
             
-            // Update position with collision-resolved coordinates
-            position.X = desiredX;
-            position.Y = desiredY;
+            if (x == mover.FromX + mover.Collision.OffsetX && y == mover.FromY + mover.Collision.OffsetY)
+            {
+                mover.Reverted = true;
+                _movers[i] = mover;
+            }
         }
     }
     
@@ -170,48 +295,67 @@ public class CollisionSystem : ISystem
     }
     
     /// <summary>
-    /// Resolves collision with other entities
+    /// Resolves collision with other entities, sending blocked movers back to their
+    /// previous position; each round retests the movers against where the last one left everything
     /// </summary>
-    private (float x, float y) ResolveEntityCollisions(
-        World world,
-        Entity entity,
-        CollisionComponent collision,
-        float currentX, float currentY,
-        float desiredX, float desiredY,
-        List<Entity> allCollisionEntities)
+    private void ResolveEntityCollisions(World world, List<Entity> allCollisionEntities)
     {
-        var bounds = collision.GetBounds(desiredX, desiredY);
-        
-        foreach (var otherEntity in allCollisionEntities)
+        while (true)
         {
-            // Don't collide with self
-            if (otherEntity.Id == entity.Id)
-                continue;
-            
-            var otherCollision = world.GetComponent<CollisionComponent>(otherEntity);
-            var otherPosition = world.GetComponent<PositionComponent>(otherEntity);
-            
-            if (otherCollision == null || otherPosition == null)
-                continue;
-            
-            // Check collision layer filtering
-            if ((collision.CollidesWith & otherCollision.Layer) == 0)
-                continue;
+            _blocked.Clear();
+            for (int i = 0; i < _movers.Count; i++)
+            {
+                var mover = _movers[i];
+                if (mover.Reverted || !mover.Collision.CheckEntities ||
+                    (mover.ToX == mover.FromX && mover.ToY == mover.FromY))
+                    continue;
+                
+                var bounds = mover.Collision.GetBounds(mover.ToX, mover.ToY);
+                
+                foreach (var otherEntity in allCollisionEntities)
+                {
+                    // Don't collide with self
+                    if (otherEntity.Id == mover.Entity.Id)
+                        continue;
+                    
+                    var otherCollision = world.GetComponent<CollisionComponent>(otherEntity);
+                    var otherPosition = world.GetComponent<PositionComponent>(otherEntity);
+                    
+                    if (otherCollision == null || otherPosition == null)
+                        continue;
+                    
+                    // Check collision layer filtering
+                    if ((mover.Collision.CollidesWith & otherCollision.Layer) == 0)
+                        continue;
+                    
+                    float otherX = otherPosition.X;
+                    float otherY = otherPosition.Y;
+                    if (_moverIndices.TryGetValue(otherEntity.Id, out int otherIndex) && !_movers[otherIndex].Reverted)
+                    {
+                        otherX = _movers[otherIndex].ToX;
+                        otherY = _movers[otherIndex].ToY;
+                    }
+                    
+                    // Check for AABB collision
+                    if (CheckAABBCollision(bounds, otherCollision.GetBounds(otherX, otherY)))
+                    {
+                        _blocked.Add(i);
+                        break;
+                    }
+                }
+            }
             
-            var otherBounds = otherCollision.GetBounds(otherPosition.X, otherPosition.Y);
+            if (_blocked.Count == 0)
+                break;
             
-            // Check for AABB collision
-            if (CheckAABBCollision(bounds, otherBounds))
+            // Simple collision response: push back to previous position
+            foreach (int i in _blocked)
             {
-                // Simple collision response: push back to previous position
-                // More sophisticated responses could be added here
-                desiredX = currentX;
-                desiredY = currentY;
-                break;
+                var mover = _movers[i];
+                mover.Reverted = true;
+                _movers[i] = mover;
             }
         }
-        
-        return (desiredX, desiredY);
     }
     
     /// <summary>
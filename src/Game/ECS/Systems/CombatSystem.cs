@@ -40,7 +40,7 @@ public class CombatSystem : ISystem
             if (combat != null && position != null)
             {
                 // Check for attack input
-                if (EngineInterop.Input_IsKeyPressed(KEY_SPACE) && 
+                if (FrameInput.IsKeyPressed(KEY_SPACE) && 
                     combat.TimeSinceLastAttack >= combat.AttackCooldown)
                 {
                     // Find nearest enemy in range
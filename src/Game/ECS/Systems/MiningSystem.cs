@@ -53,7 +53,7 @@ public class MiningSystem : ISystem
         // For now, we'll use keyboard input instead of mouse until we implement mouse handling
         // Press 'M' key to mine
         const int KEY_M = 77;
-        if (EngineInterop.Input_IsKeyDown(KEY_M))
+        if (FrameInput.IsKeyDown(KEY_M))
         {
             // Get mouse position in world coordinates
             // For now, we'll use a simplified approach - mine the block the player is standing on/near
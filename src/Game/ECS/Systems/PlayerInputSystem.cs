@@ -60,27 +60,27 @@ public class PlayerInputSystem : ISystem
                 float vy = 0;
                 
                 // Horizontal movement - West (left)
-                if (EngineInterop.Input_IsKeyDown(SDL_KEY_A) || EngineInterop.Input_IsKeyDown(VK_A) || 
-                    EngineInterop.Input_IsKeyDown(SDL_KEY_LEFT) || EngineInterop.Input_IsKeyDown(VK_LEFT))
+                if (FrameInput.IsKeyDown(SDL_KEY_A) || FrameInput.IsKeyDown(VK_A) || 
+                    FrameInput.IsKeyDown(SDL_KEY_LEFT) || FrameInput.IsKeyDown(VK_LEFT))
                 {
                     vx -= player.Speed;
                 }
                 // Horizontal movement - East (right)
-                if (EngineInterop.Input_IsKeyDown(SDL_KEY_D) || EngineInterop.Input_IsKeyDown(VK_D) || 
-                    EngineInterop.Input_IsKeyDown(SDL_KEY_RIGHT) || EngineInterop.Input_IsKeyDown(VK_RIGHT))
+                if (FrameInput.IsKeyDown(SDL_KEY_D) || FrameInput.IsKeyDown(VK_D) || 
+                    FrameInput.IsKeyDown(SDL_KEY_RIGHT) || FrameInput.IsKeyDown(VK_RIGHT))
                 {
                     vx += player.Speed;
                 }
                 
                 // Vertical movement - North (up)
-                if (EngineInterop.Input_IsKeyDown(SDL_KEY_W) || EngineInterop.Input_IsKeyDown(VK_W) || 
-                    EngineInterop.Input_IsKeyDown(SDL_KEY_UP) || EngineInterop.Input_IsKeyDown(VK_UP))
+                if (FrameInput.IsKeyDown(SDL_KEY_W) || FrameInput.IsKeyDown(VK_W) || 
+                    FrameInput.IsKeyDown(SDL_KEY_UP) || FrameInput.IsKeyDown(VK_UP))
                 {
                     vy -= player.Speed;
                 }
                 // Vertical movement - South (down)
-                if (EngineInterop.Input_IsKeyDown(SDL_KEY_S) || EngineInterop.Input_IsKeyDown(VK_S) || 
-                    EngineInterop.Input_IsKeyDown(SDL_KEY_DOWN) || EngineInterop.Input_IsKeyDown(VK_DOWN))
+                if (FrameInput.IsKeyDown(SDL_KEY_S) || FrameInput.IsKeyDown(VK_S) || 
+                    FrameInput.IsKeyDown(SDL_KEY_DOWN) || FrameInput.IsKeyDown(VK_DOWN))
                 {
                     vy += player.Speed;
                 }
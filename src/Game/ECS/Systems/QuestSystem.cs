@@ -22,7 +22,7 @@ public class QuestSystem : ISystem
         lastKeyPressTime += deltaTime;
         
         // Check for quest log display
-        if (EngineInterop.Input_IsKeyPressed(KEY_Q) && lastKeyPressTime >= keyPressCooldown)
+        if (FrameInput.IsKeyPressed(KEY_Q) && lastKeyPressTime >= keyPressCooldown)
         {
             DisplayQuestLog(world);
             lastKeyPressTime = 0;
@@ -128,8 +128,11 @@ public class SaveSystem : ISystem
         {
             LogInfo($"Loading game: {saveName}...");
             
-            string json = File.ReadAllText(filePath);
-            var saveData = JsonSerializer.Deserialize<SaveData>(json, _jsonOptions);
+            SaveData? saveData;
+            using (var stream = File.OpenRead(filePath))
+            {
+                saveData = JsonSerializer.Deserialize<SaveData>(stream, _jsonOptions);
+            }
             
             if (saveData == null)
             {
@@ -250,8 +253,8 @@ public class SaveSystem : ISystem
         {
             try
             {
-                string json = File.ReadAllText(file);
-                var saveData = JsonSerializer.Deserialize<SaveData>(json, _jsonOptions);
+                using var stream = File.OpenRead(file);
+                var saveData = JsonSerializer.Deserialize<SaveData>(stream, _jsonOptions);
                 
                 if (saveData != null)
                 {
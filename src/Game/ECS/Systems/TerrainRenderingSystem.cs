@@ -1,6 +1,7 @@
 using ChroniclesOfADrifter.ECS;
 using ChroniclesOfADrifter.ECS.Components;
 using ChroniclesOfADrifter.Engine;
+using ChroniclesOfADrifter.Rendering;
 using ChroniclesOfADrifter.Terrain;
 
 namespace ChroniclesOfADrifter.ECS.Systems;
@@ -19,6 +20,18 @@ public class TerrainRenderingSystem : ISystem
     private const int ChunkWidth = 32;
     private const int ChunkHeight = 30;
     
+    // Tile rects for the current frame, submitted with a single Renderer_DrawRects call
+    private RectInstance[] tileBatch = new RectInstance[2048];
+    private int tileBatchCount = 0;
+    
+    // Entity draws for the current frame, submitted as one command stream
+    private readonly RenderCommandBuffer entityCommands = new RenderCommandBuffer();
+    
+    // Atlas tiles for the current frame; tiles without a region stay solid rects
+    private readonly RenderCommandBuffer tileCommands = new RenderCommandBuffer();
+    private int tileAtlasId = -1;
+    private int[] tileRegions = Array.Empty<int>();
+    
     public void Initialize(World world)
     {
         // Get chunk manager from world shared resources
@@ -150,20 +163,22 @@ public class TerrainRenderingSystem : ISystem
                 var (screenX, screenY) = camera.WorldToScreen(worldPosX, worldPosY);
                 float size = BlockSize * camera.Zoom;
                 
-                // Get tile color
-                var (r, g, b) = GetTileColor(tile);
-                
-                // Apply lighting if enabled
-                if (lightingSystem != null)
+                float lightLevel = lightingSystem?.GetLightLevel(worldX, worldY) ?? 1.0f;
+                int regionId = (int)tile < tileRegions.Length ? tileRegions[(int)tile] : -1;
+                if (regionId >= 0)
                 {
-                    float lightLevel = lightingSystem.GetLightLevel(worldX, worldY);
-                    r *= lightLevel;
-                    g *= lightLevel;
-                    b *= lightLevel;
+                    // Atlas tile, darkened by an overlay queued after it
+                    tileCommands.DrawSpriteRegion(tileAtlasId, regionId, screenX, screenY, size, size, 0.0f);
+                    if (lightLevel < 1.0f)
+                    {
+                        QueueTileRect(screenX, screenY, size, size, 0, 0, 0, 1.0f - lightLevel);
+                    }
+                }
+                else
+                {
+                    var (r, g, b) = GetTileColor(tile);
+                    QueueTileRect(screenX, screenY, size, size, r * lightLevel, g * lightLevel, b * lightLevel);
                 }
-                
-                // Draw tile
-                EngineInterop.Renderer_DrawRect(screenX, screenY, size, size, r, g, b, 1.0f);
                 
                 // Draw biome-specific decorations (grass, flowers) on surface blocks
                 if (worldY <= 10 && (tile == TileType.Grass || tile == TileType.Dirt))
@@ -172,6 +187,71 @@ public class TerrainRenderingSystem : ISystem
                 }
             }
         }
+        
+        // Atlas tiles first so light overlays and decorations land on top
+        tileCommands.Submit();
+        FlushTileBatch();
+    }
+    
+    /// <summary>
+    /// Draw tiles from a tileset atlas (see TilesetManager.Atlas). Each TileType uses the
+    /// tile of the same name in tilesetName, in snake_case (WoodPlank -> "wood_plank");
+    /// types the tileset lacks keep their solid color. Pass null to draw only colors.
+    /// </summary>
+    public void SetTileAtlas(TilesetAtlas? atlas, string tilesetName)
+    {
+        tileAtlasId = atlas?.AtlasId ?? -1;
+        if (atlas == null || tileAtlasId <= 0)
+        {
+            tileRegions = Array.Empty<int>();
+            return;
+        }
+        
+        var types = Enum.GetValues<TileType>();
+        tileRegions = new int[types.Max(t => (int)t) + 1];
+        Array.Fill(tileRegions, -1);
+        foreach (var type in types)
+        {
+            if (type != TileType.Air)
+            {
+                tileRegions[(int)type] = atlas.GetRegion(tilesetName, ToTileName(type));
+            }
+        }
+    }
+    
+    private static string ToTileName(TileType type)
+    {
+        var name = new System.Text.StringBuilder();
+        foreach (char c in type.ToString())
+        {
+            if (char.IsUpper(c) && name.Length > 0)
+            {
+                name.Append('_');
+            }
+            name.Append(char.ToLowerInvariant(c));
+        }
+        return name.ToString();
+    }
+    
+    private void QueueTileRect(float x, float y, float width, float height, float r, float g, float b, float a = 1.0f)
+    {
+        if (tileBatchCount == tileBatch.Length)
+        {
+            Array.Resize(ref tileBatch, tileBatch.Length * 2);
+        }
+        
+        tileBatch[tileBatchCount++] = new RectInstance(x, y, width, height, r, g, b, a);
+    }
+    
+    private void FlushTileBatch()
+    {
+        if (tileBatchCount == 0)
+        {
+            return;
+        }
+        
+        EngineInterop.Renderer_DrawRects(tileBatch, tileBatchCount);
+        tileBatchCount = 0;
     }
     
     private void DrawSurfaceDecoration(int worldX, int worldY, float screenX, float screenY, float size, Chunk chunk)
@@ -188,12 +268,12 @@ public class TerrainRenderingSystem : ISystem
             float offsetX = size * 0.2f;
             float offsetY = size * 0.2f;
             
-            EngineInterop.Renderer_DrawRect(
+            QueueTileRect(
                 screenX + offsetX, 
                 screenY + offsetY, 
                 vegSize, 
                 vegSize, 
-                r, g, b, 1.0f);
+                r, g, b);
         }
     }
     
@@ -221,20 +301,15 @@ public class TerrainRenderingSystem : ISystem
                 var (r, g, b) = GetEntityColor(world, entity);
                 
                 // Draw entity (for now, as colored rectangle)
-                EngineInterop.Renderer_DrawRect(screenX, screenY, width, height, r, g, b, 1.0f);
+                entityCommands.DrawRect(screenX, screenY, width, height, r, g, b, 1.0f);
                 
                 // Draw black outline (Zelda style)
                 float outlineThickness = 2.0f * camera.Zoom;
-                EngineInterop.Renderer_DrawRect(screenX - outlineThickness, screenY - outlineThickness, 
-                    width + 2 * outlineThickness, outlineThickness, 0, 0, 0, 1.0f); // Top
-                EngineInterop.Renderer_DrawRect(screenX - outlineThickness, screenY + height, 
-                    width + 2 * outlineThickness, outlineThickness, 0, 0, 0, 1.0f); // Bottom
-                EngineInterop.Renderer_DrawRect(screenX - outlineThickness, screenY, 
-                    outlineThickness, height, 0, 0, 0, 1.0f); // Left
-                EngineInterop.Renderer_DrawRect(screenX + width, screenY, 
-                    outlineThickness, height, 0, 0, 0, 1.0f); // Right
+                entityCommands.DrawOutlineRect(screenX, screenY, width, height, outlineThickness, 0, 0, 0, 1.0f);
             }
         }
+        
+        entityCommands.Submit();
     }
     
     private (float r, float g, float b) GetTileColor(TileType tile)
@@ -22,10 +22,10 @@ public class UISystem : ISystem
     {
         // Get mouse position
         float mouseX = 0, mouseY = 0;
-        EngineInterop.Input_GetMousePosition(out mouseX, out mouseY);
+        FrameInput.GetMousePosition(out mouseX, out mouseY);
         
         // Check for mouse button press
-        bool mousePressed = EngineInterop.Input_IsMouseButtonPressed(0); // Left mouse button
+        bool mousePressed = FrameInput.IsMouseButtonPressed(0); // Left mouse button
         
         // Update all UI components
         foreach (var entity in world.GetEntitiesWithComponent<UIComponent>())
@@ -1,3 +1,5 @@
+using ChroniclesOfADrifter.Engine;
+
 namespace ChroniclesOfADrifter.ECS;
 
 /// <summary>
@@ -132,6 +134,18 @@ public class World
     /// </summary>
     public void Update(float deltaTime)
     {
+        if (ProfilerInterop.Enabled)
+        {
+            foreach (var system in _systems)
+            {
+                using (ProfilerInterop.Scope(system.GetType().Name))
+                {
+                    system.Update(this, deltaTime);
+                }
+            }
+            return;
+        }
+        
         foreach (var system in _systems)
         {
             system.Update(this, deltaTime);
@@ -95,13 +95,13 @@ public class EditorController
 
     private void HandleTileSelection()
     {
-        if (EngineInterop.Input_IsKeyPressed(KEY_LEFT_BRACKET))
+        if (FrameInput.IsKeyPressed(KEY_LEFT_BRACKET))
         {
             _tileIndex = (_tileIndex - 1 + _paintableTiles.Count) % _paintableTiles.Count;
             _paintTool.SelectedTile = _paintableTiles[_tileIndex];
             Console.WriteLine($"[Editor] Selected tile: {_paintTool.SelectedTile}");
         }
-        if (EngineInterop.Input_IsKeyPressed(KEY_RIGHT_BRACKET))
+        if (FrameInput.IsKeyPressed(KEY_RIGHT_BRACKET))
         {
             _tileIndex = (_tileIndex + 1) % _paintableTiles.Count;
             _paintTool.SelectedTile = _paintableTiles[_tileIndex];
@@ -111,12 +111,12 @@ public class EditorController
 
     private void HandleUndoRedo()
     {
-        if (EngineInterop.Input_IsKeyPressed(KEY_Z))
+        if (FrameInput.IsKeyPressed(KEY_Z))
         {
             if (_commandStack.Undo())
                 Console.WriteLine($"[Editor] Undo  (stack: {_commandStack.UndoCount})");
         }
-        if (EngineInterop.Input_IsKeyPressed(KEY_Y))
+        if (FrameInput.IsKeyPressed(KEY_Y))
         {
             if (_commandStack.Redo())
                 Console.WriteLine($"[Editor] Redo  (stack: {_commandStack.UndoCount})");
@@ -125,12 +125,12 @@ public class EditorController
 
     private void HandleSaveLoad()
     {
-        if (EngineInterop.Input_IsKeyPressed(KEY_S))
+        if (FrameInput.IsKeyPressed(KEY_S))
         {
             string path = Path.Combine(_saveDirectory, $"world_{DateTime.Now:yyyyMMdd_HHmmss_fff}.json");
             _fileService.Save(path);
         }
-        if (EngineInterop.Input_IsKeyPressed(KEY_L))
+        if (FrameInput.IsKeyPressed(KEY_L))
         {
             var files = Directory.GetFiles(_saveDirectory, "*.json");
             if (files.Length > 0)
@@ -147,7 +147,7 @@ public class EditorController
 
     private void HandleEraseToggle()
     {
-        if (EngineInterop.Input_IsKeyPressed(KEY_E))
+        if (FrameInput.IsKeyPressed(KEY_E))
         {
             _paintTool.EraseMode = !_paintTool.EraseMode;
             Console.WriteLine($"[Editor] Erase mode: {_paintTool.EraseMode}");
@@ -198,7 +198,7 @@ public class EditorController
 
         public void OnUpdate(float deltaTime)
         {
-            if (!EngineInterop.Input_IsKeyDown(KEY_SPACE)) return;
+            if (!FrameInput.IsKeyDown(KEY_SPACE)) return;
 
             var pos = _world.GetComponent<PositionComponent>(_camera);
             if (pos == null) return;
@@ -0,0 +1,55 @@
+using System.Runtime.InteropServices;
+
+namespace ChroniclesOfADrifter.Engine;
+
+/// <summary>
+/// P/Invoke wrapper for the native chunk tile store (ChunkStore.h)
+/// </summary>
+public static unsafe class ChunkStoreInterop
+{
+    private const string DllName = "ChroniclesEngine";
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool World_InitChunkStore(int capacity);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool World_ShutdownChunkStore();
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern byte* World_AllocateChunk(int chunkX);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void World_ReleaseChunk(int chunkX);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern byte* World_GetChunkTiles(int chunkX);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern byte* World_GetChunkVegetation(int chunkX);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int World_GetTile(int worldX, int worldY);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool World_SetTile(int worldX, int worldY, int tile);
+    
+    /// <summary>
+    /// Initialize the native store, returning false when the engine library is unavailable
+    /// (e.g. headless test runs)
+    /// </summary>
+    public static bool TryInitialize(int capacity)
+    {
+        try
+        {
+            return World_InitChunkStore(capacity);
+        }
+        catch (Exception ex) when (ex is DllNotFoundException || ex is EntryPointNotFoundException)
+        {
+            Console.WriteLine($"[ChunkStore] Native chunk store unavailable: {ex.Message}");
+            return false;
+        }
+    }
+}
@@ -12,6 +12,13 @@ public static class EngineInterop
     
     // ===== Engine Initialization =====
     
+    /// <summary>
+    /// Choose the renderer backend for the next Engine_Initialize (same names as
+    /// CHRONICLES_RENDERER, which it overrides); null goes back to the environment
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Engine_SetRendererBackend([MarshalAs(UnmanagedType.LPStr)] string? backend);
+    
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     [return: MarshalAs(UnmanagedType.I1)]
     public static extern bool Engine_Initialize(
@@ -49,6 +56,20 @@ public static class EngineInterop
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     public static extern void Renderer_UnloadTexture(int textureId);
     
+    /// <summary>
+    /// Start decoding a PNG/BMP texture in the background. The returned ID can be drawn
+    /// immediately; draws are skipped until Renderer_GetTextureState reports Ready.
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Renderer_LoadTextureAsync(
+        [MarshalAs(UnmanagedType.LPStr)] string filePath);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern TextureState Renderer_GetTextureState(int textureId);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Renderer_SetTextureUploadBudget(int bytesPerFrame);
+    
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     public static extern void Renderer_DrawSprite(
         int textureId, 
@@ -72,11 +93,55 @@ public static class EngineInterop
         float b,
         float a);
     
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Renderer_DrawRects(
+        [In] RectInstance[] rects,
+        int count);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Renderer_LoadAtlas(
+        [In] AtlasSpriteSource[] sprites,
+        int count,
+        int pageSize);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Renderer_UnloadAtlas(int atlasId);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Renderer_DrawSpriteRegion(
+        int atlasId,
+        int regionId,
+        float x,
+        float y,
+        float width,
+        float height,
+        float rotation);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Renderer_SubmitCommands(
+        [In] byte[] buffer,
+        int byteLength);
+    
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     public static extern void Renderer_Present();
     
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Renderer_GetStats(out RendererStats stats);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Renderer_ReadPixels([Out] byte[] rgba, int bufferSize);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Renderer_SaveFramebuffer([MarshalAs(UnmanagedType.LPStr)] string filePath);
+    
     // ===== Input =====
     
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Input_GetSnapshot(out InputSnapshot snapshot);
+    
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     [return: MarshalAs(UnmanagedType.I1)]
     public static extern bool Input_IsKeyPressed(int keyCode);
@@ -96,6 +161,25 @@ public static class EngineInterop
     [return: MarshalAs(UnmanagedType.I1)]
     public static extern bool Input_IsMouseButtonPressed(int button);
     
+    /// <summary>
+    /// Start or stop recording timestamped input events; off until a reader turns it on
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Input_SetEventRecording([MarshalAs(UnmanagedType.I1)] bool enabled);
+    
+    /// <summary>
+    /// Drain up to maxEvents timestamped input events, oldest first.
+    /// Call from one thread only; it need not be the thread running Engine_BeginFrame.
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Input_ReadEvents([Out] InputEvent[] events, int maxEvents);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern ulong Input_GetTimestampUs();
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern uint Input_GetDroppedEventCount();
+    
     // ===== Audio =====
     
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
@@ -119,6 +203,33 @@ public static class EngineInterop
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     public static extern void Physics_SetGravity(float x, float y);
     
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Physics_CreateBody(int entityId, float x, float y, float width, float height,
+        PhysicsBodyFlags flags, int layer, int collidesWith);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Physics_DestroyBody(int entityId);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Physics_ClearBodies();
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Physics_GetBodyCount();
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Physics_SetBodyState(int entityId, float x, float y, float vx, float vy);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Physics_GetBodyState(int entityId, out float x, out float y, out float vx, out float vy);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Physics_SetCellSize(float cellSize);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Physics_Step(float deltaTime);
+    
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     [return: MarshalAs(UnmanagedType.I1)]
     public static extern bool Physics_CheckCollision(
@@ -150,3 +261,193 @@ public static class EngineInterop
     [return: MarshalAs(UnmanagedType.LPStr)]
     public static extern string Engine_GetErrorMessage();
 }
+
+/// <summary>
+/// Loading state of a texture requested with Renderer_LoadTextureAsync (matches native TextureState)
+/// </summary>
+public enum TextureState
+{
+    Invalid = 0,
+    Pending = 1,
+    Ready = 2,
+    Failed = 3
+}
+
+/// <summary>
+/// Per-instance rectangle data for Renderer_DrawRects (matches native RectInstance)
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct RectInstance
+{
+    public float X;
+    public float Y;
+    public float Width;
+    public float Height;
+    public float R;
+    public float G;
+    public float B;
+    public float A;
+    
+    public RectInstance(float x, float y, float width, float height, float r, float g, float b, float a)
+    {
+        X = x;
+        Y = y;
+        Width = width;
+        Height = height;
+        R = r;
+        G = g;
+        B = b;
+        A = a;
+    }
+}
+
+/// <summary>
+/// Whole-frame input state from Input_GetSnapshot (matches native InputSnapshot).
+/// Keys are stored as bitsets indexed by key slot; see KeySlot.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public unsafe struct InputSnapshot
+{
+    public const int KeySlots = 1024;
+    public const int KeyWords = KeySlots / 32;
+    private const int SdlScancodeMask = 1 << 30;
+    
+    public fixed uint KeysDown[KeyWords];
+    public fixed uint KeysPressed[KeyWords];
+    public fixed uint KeysReleased[KeyWords];
+    public float MouseX;
+    public float MouseY;
+    public uint MouseButtonsDown;
+    public uint MouseButtonsPressed;
+    public uint MouseButtonsReleased;
+    public uint FrameIndex;
+    
+    /// <summary>
+    /// Maps a key code to its bit index: codes 0-511 map to themselves and SDL scancode
+    /// keycodes (1 &lt;&lt; 30 | scancode) map to 512 + scancode. Returns -1 for other codes.
+    /// </summary>
+    public static int KeySlot(int keyCode)
+    {
+        if (keyCode >= 0 && keyCode < KeySlots / 2)
+        {
+            return keyCode;
+        }
+        if ((keyCode & SdlScancodeMask) != 0)
+        {
+            int scancode = keyCode & ~SdlScancodeMask;
+            if (scancode >= 0 && scancode < KeySlots / 2)
+            {
+                return KeySlots / 2 + scancode;
+            }
+        }
+        return -1;
+    }
+    
+    public bool IsKeyDown(int keyCode)
+    {
+        int slot = KeySlot(keyCode);
+        return slot >= 0 && (KeysDown[slot >> 5] & (1u << (slot & 31))) != 0;
+    }
+    
+    public bool IsKeyPressed(int keyCode)
+    {
+        int slot = KeySlot(keyCode);
+        return slot >= 0 && (KeysPressed[slot >> 5] & (1u << (slot & 31))) != 0;
+    }
+    
+    public bool IsKeyReleased(int keyCode)
+    {
+        int slot = KeySlot(keyCode);
+        return slot >= 0 && (KeysReleased[slot >> 5] & (1u << (slot & 31))) != 0;
+    }
+    
+    public bool IsMouseButtonDown(int button)
+    {
+        return button >= 0 && button < 32 && (MouseButtonsDown & (1u << button)) != 0;
+    }
+    
+    public bool IsMouseButtonPressed(int button)
+    {
+        return button >= 0 && button < 32 && (MouseButtonsPressed & (1u << button)) != 0;
+    }
+}
+
+/// <summary>
+/// Input event types (matches native InputEventType)
+/// </summary>
+public enum InputEventType : uint
+{
+    KeyDown = 1,
+    KeyUp = 2,
+    MouseButtonDown = 3,
+    MouseButtonUp = 4,
+    MouseMotion = 5,
+    MouseWheel = 6
+}
+
+/// <summary>
+/// Timestamped input event from Input_ReadEvents (matches native InputEvent).
+/// Code is the key code or mouse button; X/Y are the mouse position, or the
+/// scroll amount for wheel events.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct InputEvent
+{
+    public InputEventType Type;
+    public int Code;
+    public float X;
+    public float Y;
+    public ulong TimestampUs;
+}
+
+/// <summary>
+/// One region to pack with Renderer_LoadAtlas (matches native AtlasSpriteSource).
+/// A null TexturePath packs a solid block of the given color.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct AtlasSpriteSource
+{
+    [MarshalAs(UnmanagedType.LPStr)]
+    public string? TexturePath;
+    public int SrcX;
+    public int SrcY;
+    public int Width;
+    public int Height;
+    public float R;
+    public float G;
+    public float B;
+    public float A;
+}
+
+/// <summary>
+/// Renderer work counters from Renderer_GetStats (matches native RendererStats).
+/// Per-frame fields describe the last presented frame.
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct RendererStats
+{
+    public ulong FramesPresented;
+    public uint DrawCalls;
+    public uint Quads;
+    public uint Vertices;
+    public uint StateChanges;
+    public uint Clears;
+    public uint TextureUploads;
+    public ulong TotalDrawCalls;
+    public ulong TotalQuads;
+    public ulong TotalVertices;
+    public ulong TotalStateChanges;
+}
+
+/// <summary>
+/// Body flags for Physics_CreateBody (matches native PhysicsBodyFlags)
+/// </summary>
+[Flags]
+public enum PhysicsBodyFlags
+{
+    None = 0,
+    Static = 1,      // Never moves
+    Sensor = 2,      // Reports contacts but never blocks or is blocked
+    NoGravity = 4,
+    NoSlide = 8      // When blocked, stays where it was instead of sliding
+}
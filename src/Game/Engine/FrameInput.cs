@@ -0,0 +1,37 @@
+namespace ChroniclesOfADrifter.Engine;
+
+/// <summary>
+/// Per-frame cache of the native input state. Refresh() fetches the whole frame's
+/// keyboard and mouse state in one native call right after Engine_BeginFrame, so
+/// systems polling many keys read managed memory instead of crossing into native code.
+/// </summary>
+public static class FrameInput
+{
+    private static InputSnapshot snapshot;
+    
+    /// <summary>
+    /// Fetch this frame's input state (call once per frame, after Engine_BeginFrame)
+    /// </summary>
+    public static void Refresh()
+    {
+        EngineInterop.Input_GetSnapshot(out snapshot);
+    }
+    
+    public static uint FrameIndex => snapshot.FrameIndex;
+    
+    public static bool IsKeyDown(int keyCode) => snapshot.IsKeyDown(keyCode);
+    
+    public static bool IsKeyPressed(int keyCode) => snapshot.IsKeyPressed(keyCode);
+    
+    public static bool IsKeyReleased(int keyCode) => snapshot.IsKeyReleased(keyCode);
+    
+    public static bool IsMouseButtonDown(int button) => snapshot.IsMouseButtonDown(button);
+    
+    public static bool IsMouseButtonPressed(int button) => snapshot.IsMouseButtonPressed(button);
+    
+    public static void GetMousePosition(out float x, out float y)
+    {
+        x = snapshot.MouseX;
+        y = snapshot.MouseY;
+    }
+}
@@ -1,3 +1,4 @@
+using System.Runtime.ExceptionServices;
 using System.Runtime.InteropServices;
 
 namespace ChroniclesOfADrifter.Engine.IPC;
@@ -27,9 +28,21 @@ public enum MessageType
     // Events
     ObjectSelected = 11,
     ObjectModified = 12,
-    SceneChanged = 13
+    SceneChanged = 13,
+    
+    // Transport control
+    OpenSharedChannel = 14,
+    
+    // Scene streaming (SceneDelta payloads are binary; format in SceneDelta.h)
+    SubscribeScene = 15,
+    SceneDelta = 16
 }
 
+/// <summary>
+/// Receives one event from IPCClient.ReadEvents; payload is only valid during the call
+/// </summary>
+public delegate void IPCEventHandler(MessageType type, ReadOnlySpan<byte> payload);
+
 /// <summary>
 /// P/Invoke wrapper for IPC API
 /// </summary>
@@ -80,6 +93,76 @@ public static class IPCInterop
         [MarshalAs(UnmanagedType.LPStr)] string payload,
         [MarshalAs(UnmanagedType.LPStr)] System.Text.StringBuilder response,
         int responseSize);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int IPC_ClientSendRequest(IntPtr client, int commandType,
+        [MarshalAs(UnmanagedType.LPStr)] string payload);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool IPC_ClientWaitResponse(IntPtr client, int requestId,
+        [MarshalAs(UnmanagedType.LPStr)] System.Text.StringBuilder response,
+        int responseSize);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int IPC_ClientSendCommandBatch(IntPtr client, int count, int[] commandTypes,
+        [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPStr)] string[] payloads,
+        byte[] responses, int responsesSize, int[] responseLengths);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool IPC_ClientOpenSharedChannel(IntPtr client, int ringBytes);
+    
+    [UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+    public delegate void EventCallbackDelegate(int eventType, IntPtr payload, int size, IntPtr userData);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int IPC_ClientReadEvents(IntPtr client, EventCallbackDelegate callback, IntPtr userData);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool IPC_ServerTrackObject(IntPtr server, int objectId,
+        [MarshalAs(UnmanagedType.LPStr)] string typeName, IntPtr instance);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void IPC_ServerUntrackObject(IntPtr server, int objectId);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void IPC_ServerPublishScene(IntPtr server);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool IPC_ClientSubscribeScene(IntPtr client, uint lastSequence);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr IPC_CreateSceneMirror();
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void IPC_DestroySceneMirror(IntPtr mirror);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern unsafe int IPC_SceneMirrorApply(IntPtr mirror, byte* payload, int size);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern uint IPC_SceneMirrorGetSequence(IntPtr mirror);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int IPC_SceneMirrorGetObjectCount(IntPtr mirror);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int IPC_SceneMirrorGetField(IntPtr mirror, uint objectId, int fieldIndex,
+        byte[]? buffer, int bufferSize);
+}
+
+/// <summary>
+/// Result of SceneMirror.Apply (matches native SceneMirror::ApplyResult)
+/// </summary>
+public enum SceneApplyResult
+{
+    Applied = 0,
+    Ignored = 1,      // Stale delta while waiting for a resync
+    NeedsResync = 2,  // Out of step: SubscribeScene(Sequence) again
+    Malformed = 3     // Also needs a resync
 }
 
 /// <summary>
@@ -115,6 +198,28 @@ public class IPCServer : IDisposable
         IPCInterop.IPC_ServerSendEvent(_handle, (int)type, payload);
     }
     
+    /// <summary>
+    /// Stream an object's reflected fields to scene subscribers. instance must point to
+    /// unmanaged memory laid out as the native type and stay valid until UntrackObject.
+    /// </summary>
+    public bool TrackObject(int objectId, string typeName, IntPtr instance)
+    {
+        return IPCInterop.IPC_ServerTrackObject(_handle, objectId, typeName, instance);
+    }
+    
+    public void UntrackObject(int objectId)
+    {
+        IPCInterop.IPC_ServerUntrackObject(_handle, objectId);
+    }
+    
+    /// <summary>
+    /// Send scene subscribers the fields changed since their last delta (once per frame)
+    /// </summary>
+    public void PublishScene()
+    {
+        IPCInterop.IPC_ServerPublishScene(_handle);
+    }
+    
     public void Dispose()
     {
         if (!_disposed && _handle != IntPtr.Zero)
@@ -157,6 +262,105 @@ public class IPCClient : IDisposable
         return success ? response.ToString() : null;
     }
     
+    /// <summary>
+    /// Send a command without waiting; returns its request ID for WaitResponse, or 0 if
+    /// not connected
+    /// </summary>
+    public int SendRequest(MessageType type, string payload)
+    {
+        return IPCInterop.IPC_ClientSendRequest(_handle, (int)type, payload);
+    }
+    
+    /// <summary>
+    /// Block until the response to a request from SendRequest arrives
+    /// </summary>
+    public string? WaitResponse(int requestId)
+    {
+        var response = new System.Text.StringBuilder(4096);
+        bool success = IPCInterop.IPC_ClientWaitResponse(_handle, requestId, response, response.Capacity);
+        
+        return success ? response.ToString() : null;
+    }
+    
+    /// <summary>
+    /// Send several commands in one write and wait for all responses, so a bulk fetch
+    /// costs one round trip instead of one per command. A response is null if the command
+    /// failed or its response exceeded 4096 bytes.
+    /// </summary>
+    public string?[] SendCommandBatch(IReadOnlyList<(MessageType Type, string Payload)> commands)
+    {
+        var results = new string?[commands.Count];
+        if (commands.Count == 0) return results;
+        
+        var types = new int[commands.Count];
+        var payloads = new string[commands.Count];
+        for (int i = 0; i < commands.Count; i++)
+        {
+            types[i] = (int)commands[i].Type;
+            payloads[i] = commands[i].Payload;
+        }
+        
+        var buffer = new byte[commands.Count * 4096];
+        var lengths = new int[commands.Count];
+        int received = IPCInterop.IPC_ClientSendCommandBatch(_handle, commands.Count, types, payloads,
+                                                             buffer, buffer.Length, lengths);
+        
+        // Responses are packed back to back, each null-terminated
+        int offset = 0;
+        for (int i = 0; i < received; i++)
+        {
+            if (lengths[i] < 0) continue;
+            results[i] = System.Text.Encoding.UTF8.GetString(buffer, offset, lengths[i]);
+            offset += lengths[i] + 1;
+        }
+        return results;
+    }
+    
+    /// <summary>
+    /// Move onto a shared-memory channel so high-frequency events arrive without system
+    /// calls. Returns false (staying on the socket) if the engine cannot provide one.
+    /// </summary>
+    public bool OpenSharedChannel(int ringBytes = 4 * 1024 * 1024)
+    {
+        return IPCInterop.IPC_ClientOpenSharedChannel(_handle, ringBytes);
+    }
+    
+    /// <summary>
+    /// Deliver every pending event to handler without blocking; returns how many.
+    /// Events from the shared channel are read in place, without copying.
+    /// If handler throws, the rest of this batch is dropped and the exception is rethrown
+    /// once the native call returns (it must not unwind through native frames).
+    /// </summary>
+    public unsafe int ReadEvents(IPCEventHandler handler)
+    {
+        ExceptionDispatchInfo? failure = null;
+        IPCInterop.EventCallbackDelegate callback = (type, payload, size, _) =>
+        {
+            if (failure != null) return;
+            try
+            {
+                handler((MessageType)type, new ReadOnlySpan<byte>((void*)payload, size));
+            }
+            catch (Exception ex)
+            {
+                failure = ExceptionDispatchInfo.Capture(ex);
+            }
+        };
+        int count = IPCInterop.IPC_ClientReadEvents(_handle, callback, IntPtr.Zero);
+        GC.KeepAlive(callback);
+        failure?.Throw();
+        return count;
+    }
+    
+    /// <summary>
+    /// Ask for SceneDelta events. Pass the sequence of the last delta applied (0 for none);
+    /// the engine sends a full resync unless it matches what it last sent.
+    /// </summary>
+    public bool SubscribeScene(uint lastSequence = 0)
+    {
+        return IPCInterop.IPC_ClientSubscribeScene(_handle, lastSequence);
+    }
+    
     public void Dispose()
     {
         if (!_disposed && _handle != IntPtr.Zero)
@@ -167,3 +371,62 @@ public class IPCClient : IDisposable
         }
     }
 }
+
+/// <summary>
+/// Editor-side copy of the engine's streamed scene, rebuilt from SceneDelta events
+/// </summary>
+public class SceneMirror : IDisposable
+{
+    private IntPtr _handle;
+    private bool _disposed;
+    
+    public SceneMirror()
+    {
+        _handle = IPCInterop.IPC_CreateSceneMirror();
+    }
+    
+    /// <summary>
+    /// Sequence of the last delta applied; pass it to IPCClient.SubscribeScene to resync
+    /// </summary>
+    public uint Sequence => IPCInterop.IPC_SceneMirrorGetSequence(_handle);
+    
+    public int ObjectCount => IPCInterop.IPC_SceneMirrorGetObjectCount(_handle);
+    
+    /// <summary>
+    /// Apply a SceneDelta event payload
+    /// </summary>
+    public unsafe SceneApplyResult Apply(ReadOnlySpan<byte> payload)
+    {
+        fixed (byte* data = payload)
+        {
+            return (SceneApplyResult)IPCInterop.IPC_SceneMirrorApply(_handle, data, payload.Length);
+        }
+    }
+    
+    /// <summary>
+    /// One field of a mirrored object, encoded as in a SceneDelta record (see SceneDelta.h),
+    /// or null if the object or field is unknown
+    /// </summary>
+    public byte[]? GetField(uint objectId, int fieldIndex)
+    {
+        int length = IPCInterop.IPC_SceneMirrorGetField(_handle, objectId, fieldIndex, null, 0);
+        if (length < 0)
+        {
+            return null;
+        }
+        
+        var value = new byte[length];
+        IPCInterop.IPC_SceneMirrorGetField(_handle, objectId, fieldIndex, value, length);
+        return value;
+    }
+    
+    public void Dispose()
+    {
+        if (!_disposed && _handle != IntPtr.Zero)
+        {
+            IPCInterop.IPC_DestroySceneMirror(_handle);
+            _handle = IntPtr.Zero;
+            _disposed = true;
+        }
+    }
+}
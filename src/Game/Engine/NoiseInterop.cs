@@ -0,0 +1,28 @@
+using System.Runtime.InteropServices;
+
+namespace ChroniclesOfADrifter.Engine;
+
+/// <summary>
+/// P/Invoke wrapper for the native batch noise functions (SimplexNoise.h).
+/// Results match SimplexNoise.Noise.CalcPixel1D/CalcPixel2D for the same seed.
+/// </summary>
+public static class NoiseInterop
+{
+    private const string DllName = "ChroniclesEngine";
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Noise_SetSeed(int seed);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Noise_CalcPixel1DBatch(int startX, int step, int count, float scale, [Out] float[] output);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Noise_CalcPixel2DBatch(int startX, int startY, int step, int width, int height,
+        float scale, [Out] float[] output);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Noise_GetSimdLevel();
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Noise_SetSimdLevel(int level);
+}
@@ -0,0 +1,112 @@
+using System.Runtime.InteropServices;
+
+namespace ChroniclesOfADrifter.Engine;
+
+/// <summary>
+/// P/Invoke wrapper for the native frame profiler (Profiler.h).
+/// Managed scopes land in the same per-thread buffers as the engine's own scopes,
+/// so a single Chrome trace shows C# systems alongside rendering.
+/// </summary>
+public static class ProfilerInterop
+{
+    private const string DllName = "ChroniclesEngine";
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Profiler_SetEnabled([MarshalAs(UnmanagedType.I1)] bool enabled);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Profiler_IsEnabled();
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Profiler_RegisterScope([MarshalAs(UnmanagedType.LPStr)] string name);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Profiler_BeginScope(int scopeId);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Profiler_EndScope();
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Profiler_DumpChromeTrace([MarshalAs(UnmanagedType.LPStr)] string filePath);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern ulong Profiler_GetDroppedScopeCount();
+    
+    private static readonly Dictionary<string, int> ScopeIds = new();
+    
+    /// <summary>
+    /// True while a native capture is running. Checked before every P/Invoke so
+    /// scopes cost nothing when profiling is off or the engine library is missing.
+    /// </summary>
+    public static bool Enabled { get; private set; }
+    
+    /// <summary>
+    /// Start or stop a capture, returning false when the engine library is unavailable
+    /// (e.g. headless test runs)
+    /// </summary>
+    public static bool TrySetEnabled(bool enabled)
+    {
+        try
+        {
+            Profiler_SetEnabled(enabled);
+            Enabled = enabled;
+            return true;
+        }
+        catch (Exception ex) when (ex is DllNotFoundException || ex is EntryPointNotFoundException)
+        {
+            Console.WriteLine($"[Profiler] Native profiler unavailable: {ex.Message}");
+            Enabled = false;
+            return false;
+        }
+    }
+    
+    /// <summary>
+    /// Time a block: <c>using (ProfilerInterop.Scope("Physics")) { ... }</c>
+    /// </summary>
+    public static ProfilerScope Scope(string name)
+    {
+        if (!Enabled)
+        {
+            return default;
+        }
+        
+        int scopeId;
+        lock (ScopeIds)
+        {
+            if (!ScopeIds.TryGetValue(name, out scopeId))
+            {
+                scopeId = Profiler_RegisterScope(name);
+                ScopeIds[name] = scopeId;
+            }
+        }
+        if (scopeId < 0)
+        {
+            return default;
+        }
+        
+        Profiler_BeginScope(scopeId);
+        return new ProfilerScope(true);
+    }
+}
+
+/// <summary>
+/// Closes a profiler scope when disposed
+/// </summary>
+public readonly struct ProfilerScope : IDisposable
+{
+    private readonly bool _active;
+    
+    internal ProfilerScope(bool active)
+    {
+        _active = active;
+    }
+    
+    public void Dispose()
+    {
+        if (_active)
+        {
+            ProfilerInterop.Profiler_EndScope();
+        }
+    }
+}
@@ -43,6 +43,22 @@ public static class ReflectionInterop
     public static extern int Reflection_GetFieldCount(
         [MarshalAs(UnmanagedType.LPStr)] string typeName);
     
+    // ===== Runtime Types =====
+    
+    /// <summary>
+    /// Describe a blittable struct to the engine so tools and the IPC server can read it;
+    /// only fixed-size field types (not String or Custom)
+    /// </summary>
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Reflection_RegisterType(
+        [MarshalAs(UnmanagedType.LPStr)] string typeName,
+        int size,
+        int fieldCount,
+        [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPStr)] string[] fieldNames,
+        int[] fieldTypes,
+        int[] fieldOffsets);
+    
     // ===== Field Query Functions =====
     
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
@@ -118,6 +134,96 @@ public static class ReflectionInterop
         [MarshalAs(UnmanagedType.LPStr)] string fieldName,
         IntPtr instance,
         [MarshalAs(UnmanagedType.LPStr)] string value);
+    
+    // ===== Field Handles =====
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_ResolveField(
+        [MarshalAs(UnmanagedType.LPStr)] string typeName,
+        [MarshalAs(UnmanagedType.LPStr)] string fieldName);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_GetHandleType(int handle);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern float Reflection_GetFloatByHandle(int handle, IntPtr instance);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Reflection_SetFloatByHandle(int handle, IntPtr instance, float value);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_GetIntByHandle(int handle, IntPtr instance);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Reflection_SetIntByHandle(int handle, IntPtr instance, int value);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Reflection_GetBoolByHandle(int handle, IntPtr instance);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Reflection_SetBoolByHandle(int handle, IntPtr instance,
+        [MarshalAs(UnmanagedType.I1)] bool value);
+    
+    // ===== Batch Access =====
+    // One call reads or writes a field on `count` instances `stride` bytes apart.
+    // Vector2/Vector3/Color arrays hold 2/3/4 floats per instance; bools are one byte each.
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_GatherBool(int handle, IntPtr baseAddress, int stride, int count,
+        [Out] byte[] output);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_ScatterBool(int handle, IntPtr baseAddress, int stride, int count,
+        byte[] values);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_GatherInt(int handle, IntPtr baseAddress, int stride, int count,
+        [Out] int[] output);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_ScatterInt(int handle, IntPtr baseAddress, int stride, int count,
+        int[] values);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_GatherFloat(int handle, IntPtr baseAddress, int stride, int count,
+        [Out] float[] output);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_ScatterFloat(int handle, IntPtr baseAddress, int stride, int count,
+        float[] values);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_GatherDouble(int handle, IntPtr baseAddress, int stride, int count,
+        [Out] double[] output);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_ScatterDouble(int handle, IntPtr baseAddress, int stride, int count,
+        double[] values);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_GatherVector2(int handle, IntPtr baseAddress, int stride, int count,
+        [Out] float[] output);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_ScatterVector2(int handle, IntPtr baseAddress, int stride, int count,
+        float[] values);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_GatherVector3(int handle, IntPtr baseAddress, int stride, int count,
+        [Out] float[] output);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_ScatterVector3(int handle, IntPtr baseAddress, int stride, int count,
+        float[] values);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_GatherColor(int handle, IntPtr baseAddress, int stride, int count,
+        [Out] float[] output);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Reflection_ScatterColor(int handle, IntPtr baseAddress, int stride, int count,
+        float[] values);
 }
 
 /// <summary>
@@ -167,7 +273,8 @@ public class ReflectionSystem
             {
                 Name = fieldName,
                 Type = (PropertyType)typeValue,
-                Offset = offset
+                Offset = offset,
+                Handle = ReflectionInterop.Reflection_ResolveField(typeName, fieldName)
             });
         }
         
@@ -224,6 +331,40 @@ public class ReflectionSystem
         }
     }
     
+    /// <summary>
+    /// Get field value through its resolved handle, without any name lookups.
+    /// Prefer this over the string overload when the same fields are read repeatedly.
+    /// </summary>
+    public static object? GetValue(FieldInfo field, IntPtr instance)
+    {
+        return field.Type switch
+        {
+            PropertyType.Bool => ReflectionInterop.Reflection_GetBoolByHandle(field.Handle, instance),
+            PropertyType.Int => ReflectionInterop.Reflection_GetIntByHandle(field.Handle, instance),
+            PropertyType.Float => ReflectionInterop.Reflection_GetFloatByHandle(field.Handle, instance),
+            _ => null
+        };
+    }
+    
+    /// <summary>
+    /// Set field value through its resolved handle
+    /// </summary>
+    public static void SetValue(FieldInfo field, IntPtr instance, object value)
+    {
+        switch (field.Type)
+        {
+            case PropertyType.Bool when value is bool boolVal:
+                ReflectionInterop.Reflection_SetBoolByHandle(field.Handle, instance, boolVal);
+                break;
+            case PropertyType.Int when value is int intVal:
+                ReflectionInterop.Reflection_SetIntByHandle(field.Handle, instance, intVal);
+                break;
+            case PropertyType.Float when value is float floatVal:
+                ReflectionInterop.Reflection_SetFloatByHandle(field.Handle, instance, floatVal);
+                break;
+        }
+    }
+    
     private static string GetStringValue(string typeName, string fieldName, IntPtr instance)
     {
         var buffer = new StringBuilder(1024);
@@ -250,4 +391,9 @@ public class FieldInfo
     public string Name { get; set; } = "";
     public PropertyType Type { get; set; }
     public int Offset { get; set; }
+    
+    /// <summary>
+    /// Native field handle for the *ByHandle accessors (-1 if unresolved)
+    /// </summary>
+    public int Handle { get; set; } = -1;
 }
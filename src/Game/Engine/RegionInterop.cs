@@ -0,0 +1,55 @@
+using System.Runtime.InteropServices;
+
+namespace ChroniclesOfADrifter.Engine;
+
+/// <summary>
+/// P/Invoke wrapper for native region files (RegionFile.h), which persist chunks in
+/// compressed groups of 32 so explored terrain can be paged out and back in
+/// </summary>
+public static unsafe class RegionInterop
+{
+    private const string DllName = "ChroniclesEngine";
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Region_SetDirectory([MarshalAs(UnmanagedType.LPStr)] string directory);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Region_SaveChunk(int chunkX, byte* tiles, byte* vegetation);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Region_SaveResidentChunk(int chunkX);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Region_LoadChunk(int chunkX, byte* tiles, byte* vegetation);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Region_HasChunk(int chunkX);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Region_Compact(int chunkX);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Region_CloseAll();
+    
+    /// <summary>
+    /// Point region files at a directory, returning false when the engine library is
+    /// unavailable (e.g. headless test runs)
+    /// </summary>
+    public static bool TrySetDirectory(string directory)
+    {
+        try
+        {
+            return Region_SetDirectory(directory);
+        }
+        catch (Exception ex) when (ex is DllNotFoundException || ex is EntryPointNotFoundException)
+        {
+            Console.WriteLine($"[Region] Native region files unavailable: {ex.Message}");
+            return false;
+        }
+    }
+}
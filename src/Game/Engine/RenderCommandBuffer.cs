@@ -0,0 +1,150 @@
+using System.Buffers.Binary;
+
+namespace ChroniclesOfADrifter.Engine;
+
+/// <summary>
+/// Builds a packed render command stream for Renderer_SubmitCommands.
+/// Layout must match the RenderCommand* structs in ChroniclesEngine.h.
+/// </summary>
+public class RenderCommandBuffer
+{
+    private const uint StreamVersion = 1;
+    private const int HeaderSize = 8;
+    
+    private const uint CommandClear = 1;
+    private const uint CommandRect = 2;
+    private const uint CommandSprite = 3;
+    private const uint CommandOutlineRect = 4;
+    private const uint CommandSpriteRegion = 5;
+    
+    private byte[] buffer;
+    private int length;
+    private uint commandCount;
+    
+    public RenderCommandBuffer(int initialCapacity = 16 * 1024)
+    {
+        buffer = new byte[Math.Max(initialCapacity, HeaderSize)];
+        Reset();
+    }
+    
+    /// <summary>
+    /// Number of commands recorded since the last submit
+    /// </summary>
+    public int CommandCount => (int)commandCount;
+    
+    public void Reset()
+    {
+        length = HeaderSize;
+        commandCount = 0;
+    }
+    
+    public void Clear(float r, float g, float b, float a)
+    {
+        BeginCommand(CommandClear, 4);
+        WriteFloat(r);
+        WriteFloat(g);
+        WriteFloat(b);
+        WriteFloat(a);
+    }
+    
+    public void DrawRect(float x, float y, float width, float height, float r, float g, float b, float a)
+    {
+        BeginCommand(CommandRect, 8);
+        WriteFloat(x);
+        WriteFloat(y);
+        WriteFloat(width);
+        WriteFloat(height);
+        WriteFloat(r);
+        WriteFloat(g);
+        WriteFloat(b);
+        WriteFloat(a);
+    }
+    
+    public void DrawSprite(int textureId, float x, float y, float width, float height, float rotation)
+    {
+        BeginCommand(CommandSprite, 6);
+        WriteInt(textureId);
+        WriteFloat(x);
+        WriteFloat(y);
+        WriteFloat(width);
+        WriteFloat(height);
+        WriteFloat(rotation);
+    }
+    
+    /// <summary>
+    /// Draw a border of the given thickness just outside the rectangle
+    /// </summary>
+    public void DrawOutlineRect(float x, float y, float width, float height, float thickness,
+                                float r, float g, float b, float a)
+    {
+        BeginCommand(CommandOutlineRect, 9);
+        WriteFloat(x);
+        WriteFloat(y);
+        WriteFloat(width);
+        WriteFloat(height);
+        WriteFloat(thickness);
+        WriteFloat(r);
+        WriteFloat(g);
+        WriteFloat(b);
+        WriteFloat(a);
+    }
+    
+    /// <summary>
+    /// Draw one region of an atlas created with Renderer_LoadAtlas
+    /// </summary>
+    public void DrawSpriteRegion(int atlasId, int regionId, float x, float y, float width, float height, float rotation)
+    {
+        BeginCommand(CommandSpriteRegion, 7);
+        WriteInt(atlasId);
+        WriteInt(regionId);
+        WriteFloat(x);
+        WriteFloat(y);
+        WriteFloat(width);
+        WriteFloat(height);
+        WriteFloat(rotation);
+    }
+    
+    /// <summary>
+    /// Submit all recorded commands in one native call and reset the buffer
+    /// </summary>
+    /// <returns>Number of commands executed, or -1 if the engine rejected the stream</returns>
+    public int Submit()
+    {
+        if (commandCount == 0)
+        {
+            return 0;
+        }
+        
+        BinaryPrimitives.WriteUInt32LittleEndian(buffer.AsSpan(0), StreamVersion);
+        BinaryPrimitives.WriteUInt32LittleEndian(buffer.AsSpan(4), commandCount);
+        
+        int executed = EngineInterop.Renderer_SubmitCommands(buffer, length);
+        Reset();
+        return executed;
+    }
+    
+    private void BeginCommand(uint type, int fieldCount)
+    {
+        int required = length + 4 + fieldCount * 4;
+        if (required > buffer.Length)
+        {
+            Array.Resize(ref buffer, Math.Max(required, buffer.Length * 2));
+        }
+        
+        BinaryPrimitives.WriteUInt32LittleEndian(buffer.AsSpan(length), type);
+        length += 4;
+        commandCount++;
+    }
+    
+    private void WriteFloat(float value)
+    {
+        BinaryPrimitives.WriteSingleLittleEndian(buffer.AsSpan(length), value);
+        length += 4;
+    }
+    
+    private void WriteInt(int value)
+    {
+        BinaryPrimitives.WriteInt32LittleEndian(buffer.AsSpan(length), value);
+        length += 4;
+    }
+}
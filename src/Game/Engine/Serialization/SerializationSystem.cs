@@ -17,6 +17,13 @@ public static class SerializationInterop
         [MarshalAs(UnmanagedType.LPStr)] StringBuilder buffer,
         int bufferSize);
     
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Serialization_ToJsonCompact(
+        [MarshalAs(UnmanagedType.LPStr)] string typeName,
+        IntPtr instance,
+        [MarshalAs(UnmanagedType.LPStr)] StringBuilder buffer,
+        int bufferSize);
+    
     [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
     [return: MarshalAs(UnmanagedType.I1)]
     public static extern bool Serialization_FromJson(
@@ -37,6 +44,64 @@ public static class SerializationInterop
         [MarshalAs(UnmanagedType.LPStr)] string typeName,
         IntPtr instance,
         [MarshalAs(UnmanagedType.LPStr)] string filePath);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Serialization_ToBinary(
+        [MarshalAs(UnmanagedType.LPStr)] string typeName,
+        IntPtr instance,
+        byte[]? buffer,
+        int bufferSize);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Serialization_ToBinaryArray(
+        [MarshalAs(UnmanagedType.LPStr)] string typeName,
+        IntPtr instances,
+        int stride,
+        int count,
+        byte[]? buffer,
+        int bufferSize);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Serialization_FromBinary(
+        [MarshalAs(UnmanagedType.LPStr)] string typeName,
+        IntPtr instance,
+        byte[] data,
+        int size);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Serialization_FromBinaryArray(
+        [MarshalAs(UnmanagedType.LPStr)] string typeName,
+        IntPtr instances,
+        int stride,
+        int capacity,
+        byte[] data,
+        int size);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Serialization_SaveBinaryFile(
+        [MarshalAs(UnmanagedType.LPStr)] string typeName,
+        IntPtr instance,
+        [MarshalAs(UnmanagedType.LPStr)] string filePath);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Serialization_LoadBinaryFile(
+        [MarshalAs(UnmanagedType.LPStr)] string typeName,
+        IntPtr instance,
+        [MarshalAs(UnmanagedType.LPStr)] string filePath);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern uint Serialization_GetSchemaHash([MarshalAs(UnmanagedType.LPStr)] string typeName);
+    
+    // Returns a pointer to a native thread-local buffer; read it with Marshal.PtrToStringAnsi
+    // (marshalling it as a string return would make the runtime free it)
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr Serialization_GetLastError();
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Serialization_GetLastErrorOffset();
 }
 
 /// <summary>
@@ -47,18 +112,80 @@ public class SerializationSystem
     /// <summary>
     /// Serialize an object to JSON string
     /// </summary>
-    public static string? ToJson(string typeName, IntPtr instance)
+    public static string? ToJson(string typeName, IntPtr instance, bool compact = false)
     {
         if (instance == IntPtr.Zero) return null;
         
         var buffer = new StringBuilder(4096);
-        int length = SerializationInterop.Serialization_ToJson(typeName, instance, buffer, buffer.Capacity);
+        int length = Write(typeName, instance, buffer, compact);
+        if (length >= buffer.Capacity)
+        {
+            // The native side reports the full size when the buffer is too small
+            buffer = new StringBuilder(length + 1);
+            length = Write(typeName, instance, buffer, compact);
+        }
         
         return length > 0 ? buffer.ToString() : null;
     }
     
+    private static int Write(string typeName, IntPtr instance, StringBuilder buffer, bool compact)
+    {
+        return compact
+            ? SerializationInterop.Serialization_ToJsonCompact(typeName, instance, buffer, buffer.Capacity)
+            : SerializationInterop.Serialization_ToJson(typeName, instance, buffer, buffer.Capacity);
+    }
+    
+    /// <summary>
+    /// Serialize an object to the native binary format (schema-checked, little-endian)
+    /// </summary>
+    public static byte[]? ToBinary(string typeName, IntPtr instance)
+    {
+        if (instance == IntPtr.Zero) return null;
+        
+        return ToBinaryArray(typeName, instance, 0, 1);
+    }
+    
+    /// <summary>
+    /// Serialize count native objects, stride bytes apart (0 = the type's size), as one blob
+    /// </summary>
+    public static byte[]? ToBinaryArray(string typeName, IntPtr instances, int stride, int count)
+    {
+        int size = SerializationInterop.Serialization_ToBinaryArray(typeName, instances, stride, count, null, 0);
+        if (size < 0) return null;
+        
+        var buffer = new byte[size];
+        int written = SerializationInterop.Serialization_ToBinaryArray(typeName, instances, stride, count, buffer, size);
+        return written == size ? buffer : null;
+    }
+    
     /// <summary>
-    /// Deserialize an object from JSON string
+    /// Deserialize an object written by ToBinary; fails on a schema mismatch (see LastError)
+    /// </summary>
+    public static bool FromBinary(string typeName, IntPtr instance, byte[] data)
+    {
+        if (instance == IntPtr.Zero || data == null || data.Length == 0) return false;
+        
+        return SerializationInterop.Serialization_FromBinary(typeName, instance, data, data.Length);
+    }
+    
+    /// <summary>
+    /// Deserialize an array written by ToBinaryArray, returning the object count or -1
+    /// </summary>
+    public static int FromBinaryArray(string typeName, IntPtr instances, int stride, int capacity, byte[] data)
+    {
+        if (data == null || data.Length == 0) return -1;
+        
+        return SerializationInterop.Serialization_FromBinaryArray(typeName, instances, stride, capacity, data, data.Length);
+    }
+    
+    /// <summary>
+    /// Why the last FromJson/LoadFromFile/FromBinary/LoadBinaryFile on this thread failed, including the byte offset
+    /// </summary>
+    public static string LastError =>
+        Marshal.PtrToStringAnsi(SerializationInterop.Serialization_GetLastError()) ?? "";
+    
+    /// <summary>
+    /// Deserialize an object from JSON string (see LastError on failure)
     /// </summary>
     public static bool FromJson(string typeName, IntPtr instance, string json)
     {
@@ -86,4 +213,24 @@ public class SerializationSystem
         
         return SerializationInterop.Serialization_LoadFromFile(typeName, instance, filePath);
     }
+    
+    /// <summary>
+    /// Save object to a binary file (same format as ToBinary)
+    /// </summary>
+    public static bool SaveBinaryFile(string typeName, IntPtr instance, string filePath)
+    {
+        if (instance == IntPtr.Zero || string.IsNullOrEmpty(filePath)) return false;
+        
+        return SerializationInterop.Serialization_SaveBinaryFile(typeName, instance, filePath);
+    }
+    
+    /// <summary>
+    /// Load object from a binary file; the engine reads it in place from a memory mapping
+    /// </summary>
+    public static bool LoadBinaryFile(string typeName, IntPtr instance, string filePath)
+    {
+        if (instance == IntPtr.Zero || string.IsNullOrEmpty(filePath)) return false;
+        
+        return SerializationInterop.Serialization_LoadBinaryFile(typeName, instance, filePath);
+    }
 }
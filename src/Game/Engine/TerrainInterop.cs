@@ -0,0 +1,52 @@
+using System.Runtime.InteropServices;
+
+namespace ChroniclesOfADrifter.Engine;
+
+/// <summary>
+/// P/Invoke wrapper for the native terrain generator (TerrainGenerator.h)
+/// </summary>
+public static unsafe class TerrainInterop
+{
+    private const string DllName = "ChroniclesEngine";
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern IntPtr Terrain_CreatePipeline(int seed, int workerCount);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Terrain_DestroyPipeline(IntPtr pipeline);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Terrain_RequestChunk(IntPtr pipeline, int chunkX);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern void Terrain_SetFocusChunk(IntPtr pipeline, int chunkX);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Terrain_PollCompleted(IntPtr pipeline, int* outChunkX, byte* outTiles, byte* outVegetation);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    [return: MarshalAs(UnmanagedType.I1)]
+    public static extern bool Terrain_GenerateChunk(IntPtr pipeline, int chunkX, byte* outTiles, byte* outVegetation);
+    
+    [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+    public static extern int Terrain_GetPendingCount(IntPtr pipeline);
+    
+    /// <summary>
+    /// Start a native worker pool, returning IntPtr.Zero when the engine library is
+    /// unavailable (e.g. headless test runs)
+    /// </summary>
+    public static IntPtr TryCreatePipeline(int seed, int workerCount)
+    {
+        try
+        {
+            return Terrain_CreatePipeline(seed, workerCount);
+        }
+        catch (Exception ex) when (ex is DllNotFoundException || ex is EntryPointNotFoundException)
+        {
+            Console.WriteLine($"[Terrain] Native terrain generator unavailable: {ex.Message}");
+            return IntPtr.Zero;
+        }
+    }
+}
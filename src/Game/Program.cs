@@ -114,6 +114,41 @@ class Program
             return;
         }
         
+        // Check for native terrain parity test mode
+        if (args.Length > 0 && args[0].ToLower() == "native-terrain-test")
+        {
+            Tests.NativeTerrainParityTest.Run();
+            return;
+        }
+        
+        // Check for region file persistence test mode
+        if (args.Length > 0 && args[0].ToLower() == "region-test")
+        {
+            Tests.RegionPersistenceTest.Run();
+            return;
+        }
+        
+        // Check for IPC loopback test mode
+        if (args.Length > 0 && args[0].ToLower() == "ipc-test")
+        {
+            Tests.IPCLoopbackTest.Run();
+            return;
+        }
+        
+        // Check for headless renderer benchmark mode
+        if (args.Length > 0 && args[0].ToLower() == "headless-benchmark")
+        {
+            Tests.HeadlessRendererBenchmark.Run();
+            return;
+        }
+        
+        // Check for software renderer test mode
+        if (args.Length > 0 && args[0].ToLower() == "software-render-test")
+        {
+            Tests.SoftwareRendererTest.Run();
+            return;
+        }
+        
         // Check for time system test mode
         if (args.Length > 0 && args[0].ToLower() == "time-test")
         {
@@ -444,6 +479,7 @@ class Program
             }
             
             EngineInterop.Engine_BeginFrame();
+            FrameInput.Refresh();
             
             float deltaTime = EngineInterop.Engine_GetDeltaTime();
             
@@ -530,6 +566,7 @@ class Program
             }
             
             EngineInterop.Engine_BeginFrame();
+            FrameInput.Refresh();
             
             float deltaTime = EngineInterop.Engine_GetDeltaTime();
             
@@ -613,6 +650,7 @@ class Program
             }
             
             EngineInterop.Engine_BeginFrame();
+            FrameInput.Refresh();
             
             float deltaTime = EngineInterop.Engine_GetDeltaTime();
             
@@ -688,6 +726,7 @@ class Program
         while (EngineInterop.Engine_IsRunning())
         {
             EngineInterop.Engine_BeginFrame();
+            FrameInput.Refresh();
             
             float deltaTime = EngineInterop.Engine_GetDeltaTime();
             
@@ -774,6 +813,7 @@ class Program
             }
             
             EngineInterop.Engine_BeginFrame();
+            FrameInput.Refresh();
             
             float deltaTime = EngineInterop.Engine_GetDeltaTime();
             
@@ -913,6 +953,7 @@ class Program
         while (EngineInterop.Engine_IsRunning())
         {
             EngineInterop.Engine_BeginFrame();
+            FrameInput.Refresh();
 
             float deltaTime = EngineInterop.Engine_GetDeltaTime();
             scene.Update(deltaTime);
@@ -986,6 +1027,7 @@ class Program
         while (EngineInterop.Engine_IsRunning())
         {
             EngineInterop.Engine_BeginFrame();
+            FrameInput.Refresh();
             
             float deltaTime = EngineInterop.Engine_GetDeltaTime();
             
@@ -1076,6 +1118,7 @@ class Program
             }
             
             EngineInterop.Engine_BeginFrame();
+            FrameInput.Refresh();
             
             float deltaTime = EngineInterop.Engine_GetDeltaTime();
             
@@ -19,8 +19,8 @@ public class Tileset
     {
         try
         {
-            string json = File.ReadAllText(filePath);
-            return JsonSerializer.Deserialize<Tileset>(json);
+            using var stream = File.OpenRead(filePath);
+            return JsonSerializer.Deserialize<Tileset>(stream);
         }
         catch (Exception ex)
         {
@@ -0,0 +1,103 @@
+using ChroniclesOfADrifter.Engine;
+
+namespace ChroniclesOfADrifter.Rendering;
+
+/// <summary>
+/// Every tile of a group of tilesets packed into one native texture atlas.
+/// Tiles that land on the same atlas page are drawn in a single batch.
+/// A tile with a TexturePath uses the TileSize x TileSize block at pixel
+/// (TextureX, TextureY) of that image; other tiles become solid blocks of their Color.
+/// </summary>
+public class TilesetAtlas : IDisposable
+{
+    private readonly Dictionary<(string Tileset, string Tile), int> regions = new();
+    
+    public int AtlasId { get; private set; } = -1;
+    
+    public int RegionCount => regions.Count;
+    
+    private TilesetAtlas()
+    {
+    }
+    
+    /// <summary>
+    /// Pack the given tilesets into a native atlas
+    /// </summary>
+    /// <param name="pageSize">Atlas page size in pixels, or 0 for the engine default</param>
+    /// <returns>The atlas, or null if the engine could not create it</returns>
+    public static TilesetAtlas? Build(IEnumerable<Tileset> tilesets, int pageSize = 0)
+    {
+        var atlas = new TilesetAtlas();
+        var sprites = new List<AtlasSpriteSource>();
+        
+        foreach (var tileset in tilesets.OrderBy(t => t.Name, StringComparer.Ordinal))
+        {
+            foreach (var (tileName, tile) in tileset.Tiles)
+            {
+                var (r, g, b) = tile.GetColor();
+                atlas.regions[(tileset.Name, tileName)] = sprites.Count;
+                sprites.Add(new AtlasSpriteSource
+                {
+                    TexturePath = string.IsNullOrEmpty(tile.TexturePath) ? null : tile.TexturePath,
+                    SrcX = tile.TextureX,
+                    SrcY = tile.TextureY,
+                    Width = tileset.TileSize,
+                    Height = tileset.TileSize,
+                    R = r,
+                    G = g,
+                    B = b,
+                    A = 1.0f
+                });
+            }
+        }
+        
+        if (sprites.Count == 0)
+        {
+            return null;
+        }
+        
+        try
+        {
+            atlas.AtlasId = EngineInterop.Renderer_LoadAtlas(sprites.ToArray(), sprites.Count, pageSize);
+        }
+        catch (Exception ex) when (ex is DllNotFoundException || ex is EntryPointNotFoundException)
+        {
+            Console.WriteLine($"[TilesetAtlas] Native atlas support unavailable: {ex.Message}");
+            return null;
+        }
+        
+        if (atlas.AtlasId <= 0)
+        {
+            Console.WriteLine("[TilesetAtlas] Failed to build atlas");
+            return null;
+        }
+        
+        Console.WriteLine($"[TilesetAtlas] Packed {sprites.Count} tiles into atlas {atlas.AtlasId}");
+        return atlas;
+    }
+    
+    /// <summary>
+    /// Region ID of a tile, or -1 if the tile is not in this atlas
+    /// </summary>
+    public int GetRegion(string tilesetName, string tileName)
+    {
+        return regions.TryGetValue((tilesetName, tileName), out int regionId) ? regionId : -1;
+    }
+    
+    public void Draw(int regionId, float x, float y, float width, float height, float rotation = 0.0f)
+    {
+        if (AtlasId > 0 && regionId >= 0)
+        {
+            EngineInterop.Renderer_DrawSpriteRegion(AtlasId, regionId, x, y, width, height, rotation);
+        }
+    }
+    
+    public void Dispose()
+    {
+        if (AtlasId > 0)
+        {
+            EngineInterop.Renderer_UnloadAtlas(AtlasId);
+            AtlasId = -1;
+        }
+    }
+}
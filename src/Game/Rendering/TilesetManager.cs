@@ -7,6 +7,12 @@ public class TilesetManager
 {
     private Dictionary<string, Tileset> tilesets = new();
     private string activeTilesetName = string.Empty;
+    private TilesetAtlas? atlas;
+    
+    /// <summary>
+    /// Atlas of every registered tile, built by LoadTilesetsFromDirectory or BuildAtlas
+    /// </summary>
+    public TilesetAtlas? Atlas => atlas;
     
     /// <summary>
     /// Load a tileset from file and register it
@@ -96,9 +102,31 @@ public class TilesetManager
             }
             Console.WriteLine($"[TilesetManager] Loaded {count} tilesets from {directoryPath}");
         }
+        
+        BuildAtlas();
         return count;
     }
     
+    /// <summary>
+    /// Pack all registered tilesets into one native texture atlas, replacing the previous one
+    /// </summary>
+    /// <returns>The atlas, or null if there are no tiles or the engine could not build it</returns>
+    public TilesetAtlas? BuildAtlas(int pageSize = 0)
+    {
+        ReleaseAtlas();
+        atlas = TilesetAtlas.Build(tilesets.Values, pageSize);
+        return atlas;
+    }
+    
+    /// <summary>
+    /// Unload the native atlas, if one was built
+    /// </summary>
+    public void ReleaseAtlas()
+    {
+        atlas?.Dispose();
+        atlas = null;
+    }
+    
     /// <summary>
     /// Create a default tileset if none are loaded
     /// </summary>
@@ -96,6 +96,11 @@ public class CompleteGameLoopScene : Scene
         terrainGenerator = new TerrainGenerator(seed: worldSeed);
         chunkManager = new ChunkManager();
         chunkManager.SetTerrainGenerator(terrainGenerator);
+        chunkManager.EnableNativeTileStore();
+        
+        // Edited chunks are written here when they unload and read back instead of regenerated
+        string regionDirectory = Path.Combine(Directory.GetCurrentDirectory(), "saves", $"world_{worldSeed}", "regions");
+        bool regionFiles = chunkManager.EnableRegionFiles(regionDirectory);
         
         // Create structure generator
         structureGenerator = new StructureGenerator(worldSeed);
@@ -107,6 +112,10 @@ public class CompleteGameLoopScene : Scene
         Console.WriteLine($"  ✓ Chunk size: 32x30 blocks (surface + 20 underground layers)");
         Console.WriteLine($"  ✓ 8 biomes available");
         Console.WriteLine($"  ✓ Structure generator initialized");
+        if (regionFiles)
+        {
+            Console.WriteLine($"  ✓ Chunk persistence: {regionDirectory}");
+        }
     }
     
     private void InitializeWorldSystems()
@@ -747,6 +756,17 @@ public class CompleteGameLoopScene : Scene
     public override void OnUnload()
     {
         Console.WriteLine("\n[GameLoop] Unloading complete game loop demo...");
+        
+        // Chunks still loaded have not been through unload, so save their edits now;
+        // disposing also hands the native tile store back for the next manager
+        int savedChunks = chunkManager?.SaveModifiedChunks() ?? 0;
+        if (savedChunks > 0)
+        {
+            Console.WriteLine($"Saved {savedChunks} modified chunks");
+        }
+        chunkManager?.Dispose();
+        chunkManager = null;
+        
         Console.WriteLine($"Total game time: {gameTime:F1} seconds");
         Console.WriteLine($"Enemies defeated: {enemiesDefeated}");
         Console.WriteLine($"Resources gathered: {resourcesGathered}");
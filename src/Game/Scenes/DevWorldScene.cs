@@ -106,7 +106,7 @@ public class DevWorldScene : Scene
             _editorController?.Update(deltaTime);
 
         // Toggle editor overlay.
-        if (EngineInterop.Input_IsKeyPressed(KEY_F1))
+        if (FrameInput.IsKeyPressed(KEY_F1))
         {
             _editorVisible = !_editorVisible;
             Console.WriteLine($"[DevWorld] Editor: {(_editorVisible ? "ON" : "OFF")}");
@@ -129,10 +129,10 @@ public class DevWorldScene : Scene
 
         float d = _cameraMoveSpeed * deltaTime;
 
-        if (EngineInterop.Input_IsKeyDown(KEY_W) || EngineInterop.Input_IsKeyDown(KEY_UP))    pos.Y -= d;
-        if (EngineInterop.Input_IsKeyDown(KEY_S) || EngineInterop.Input_IsKeyDown(KEY_DOWN))  pos.Y += d;
-        if (EngineInterop.Input_IsKeyDown(KEY_A) || EngineInterop.Input_IsKeyDown(KEY_LEFT))  pos.X -= d;
-        if (EngineInterop.Input_IsKeyDown(KEY_D) || EngineInterop.Input_IsKeyDown(KEY_RIGHT)) pos.X += d;
+        if (FrameInput.IsKeyDown(KEY_W) || FrameInput.IsKeyDown(KEY_UP))    pos.Y -= d;
+        if (FrameInput.IsKeyDown(KEY_S) || FrameInput.IsKeyDown(KEY_DOWN))  pos.Y += d;
+        if (FrameInput.IsKeyDown(KEY_A) || FrameInput.IsKeyDown(KEY_LEFT))  pos.X -= d;
+        if (FrameInput.IsKeyDown(KEY_D) || FrameInput.IsKeyDown(KEY_RIGHT)) pos.X += d;
     }
 
     private void UpdateChunks()
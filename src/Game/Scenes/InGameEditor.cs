@@ -62,7 +62,7 @@ public class InGameEditor
     
     private void HandleEditorToggle()
     {
-        if (EngineInterop.Input_IsKeyPressed(KEY_F1) || EngineInterop.Input_IsKeyPressed(KEY_TILDE))
+        if (FrameInput.IsKeyPressed(KEY_F1) || FrameInput.IsKeyPressed(KEY_TILDE))
         {
             editorEnabled = !editorEnabled;
             string status = editorEnabled ? "ENABLED" : "DISABLED";
@@ -82,25 +82,25 @@ public class InGameEditor
     private void HandleEditorInput()
     {
         // Tile selection
-        if (EngineInterop.Input_IsKeyPressed(KEY_LEFT_BRACKET))
+        if (FrameInput.IsKeyPressed(KEY_LEFT_BRACKET))
         {
             selectedTileIndex = (selectedTileIndex - 1 + availableTiles.Count) % availableTiles.Count;
             Console.WriteLine($"[InGameEditor] Selected: {availableTiles[selectedTileIndex]}");
         }
-        if (EngineInterop.Input_IsKeyPressed(KEY_RIGHT_BRACKET))
+        if (FrameInput.IsKeyPressed(KEY_RIGHT_BRACKET))
         {
             selectedTileIndex = (selectedTileIndex + 1) % availableTiles.Count;
             Console.WriteLine($"[InGameEditor] Selected: {availableTiles[selectedTileIndex]}");
         }
         
         // Tile placement
-        if (EngineInterop.Input_IsKeyPressed(KEY_SPACE))
+        if (FrameInput.IsKeyPressed(KEY_SPACE))
         {
             PlaceTileAtCamera();
         }
         
         // Tile removal
-        if (EngineInterop.Input_IsKeyPressed(KEY_DELETE))
+        if (FrameInput.IsKeyPressed(KEY_DELETE))
         {
             RemoveTileAtCamera();
         }
@@ -71,12 +71,16 @@ public class MapEditorScene : Scene
         // Initialize tileset manager
         tilesetManager.CreateDefaultTileset();
         
-        // Try to load additional tilesets
+        // Try to load additional tilesets (this also packs the tile atlas)
         string tilesetDir = "assets/tilesets";
         if (Directory.Exists(tilesetDir))
         {
             tilesetManager.LoadTilesetsFromDirectory(tilesetDir);
         }
+        else
+        {
+            tilesetManager.BuildAtlas();
+        }
         
         // Initialize terrain generation (optional)
         terrainGenerator = new TerrainGenerator(seed: 12345);
@@ -89,7 +93,13 @@ public class MapEditorScene : Scene
         // Add systems
         World.AddSystem(new CameraInputSystem());
         World.AddSystem(new CameraSystem());
-        World.AddSystem(new TerrainRenderingSystem());
+        var terrainRendering = new TerrainRenderingSystem();
+        var activeTileset = tilesetManager.GetActiveTileset();
+        if (activeTileset != null)
+        {
+            terrainRendering.SetTileAtlas(tilesetManager.Atlas, activeTileset.Name);
+        }
+        World.AddSystem(terrainRendering);
         
         // Create camera entity
         _cameraEntity = World.CreateEntity();
@@ -174,7 +184,7 @@ public class MapEditorScene : Scene
     private void HandleEditorInput()
     {
         // Toggle editor
-        if (EngineInterop.Input_IsKeyPressed(KEY_F1) || EngineInterop.Input_IsKeyPressed(KEY_TILDE))
+        if (FrameInput.IsKeyPressed(KEY_F1) || FrameInput.IsKeyPressed(KEY_TILDE))
         {
             editorEnabled = !editorEnabled;
             Console.WriteLine($"[MapEditor] Editor UI: {(editorEnabled ? "Enabled" : "Disabled")}");
@@ -183,12 +193,12 @@ public class MapEditorScene : Scene
         if (!editorEnabled) return;
         
         // Tile selection with [ and ]
-        if (EngineInterop.Input_IsKeyPressed(KEY_LEFT_BRACKET))
+        if (FrameInput.IsKeyPressed(KEY_LEFT_BRACKET))
         {
             selectedTileIndex = (selectedTileIndex - 1 + availableTiles.Count) % availableTiles.Count;
             UpdateSelectedTile();
         }
-        if (EngineInterop.Input_IsKeyPressed(KEY_RIGHT_BRACKET))
+        if (FrameInput.IsKeyPressed(KEY_RIGHT_BRACKET))
         {
             selectedTileIndex = (selectedTileIndex + 1) % availableTiles.Count;
             UpdateSelectedTile();
@@ -198,25 +208,25 @@ public class MapEditorScene : Scene
         HandleQuickSelect();
         
         // Tile placement/removal
-        if (EngineInterop.Input_IsKeyDown(KEY_SPACE))
+        if (FrameInput.IsKeyDown(KEY_SPACE))
         {
             PlaceTileAtCursor();
         }
         
         // Map management
-        if (EngineInterop.Input_IsKeyPressed(KEY_S))
+        if (FrameInput.IsKeyPressed(KEY_S))
         {
             SaveCurrentMap();
         }
-        if (EngineInterop.Input_IsKeyPressed(KEY_L))
+        if (FrameInput.IsKeyPressed(KEY_L))
         {
             LoadMap();
         }
-        if (EngineInterop.Input_IsKeyPressed(KEY_N))
+        if (FrameInput.IsKeyPressed(KEY_N))
         {
             ClearMap();
         }
-        if (EngineInterop.Input_IsKeyPressed(KEY_G))
+        if (FrameInput.IsKeyPressed(KEY_G))
         {
             GenerateNewTerrain();
         }
@@ -227,7 +237,7 @@ public class MapEditorScene : Scene
         int[] numberKeys = { KEY_0, KEY_1, KEY_2, KEY_3, KEY_4, KEY_5, KEY_6, KEY_7, KEY_8, KEY_9 };
         for (int i = 0; i < numberKeys.Length; i++)
         {
-            if (EngineInterop.Input_IsKeyPressed(numberKeys[i]))
+            if (FrameInput.IsKeyPressed(numberKeys[i]))
             {
                 int index = i;
                 if (index < availableTiles.Count)
@@ -256,19 +266,19 @@ public class MapEditorScene : Scene
         
         float moveAmount = cameraMoveSpeed * deltaTime;
         
-        if (EngineInterop.Input_IsKeyDown(KEY_W) || EngineInterop.Input_IsKeyDown(KEY_UP))
+        if (FrameInput.IsKeyDown(KEY_W) || FrameInput.IsKeyDown(KEY_UP))
         {
             cameraPos.Y -= moveAmount;
         }
-        if (EngineInterop.Input_IsKeyDown(KEY_S) || EngineInterop.Input_IsKeyDown(KEY_DOWN))
+        if (FrameInput.IsKeyDown(KEY_S) || FrameInput.IsKeyDown(KEY_DOWN))
         {
             cameraPos.Y += moveAmount;
         }
-        if (EngineInterop.Input_IsKeyDown(KEY_A) || EngineInterop.Input_IsKeyDown(KEY_LEFT))
+        if (FrameInput.IsKeyDown(KEY_A) || FrameInput.IsKeyDown(KEY_LEFT))
         {
             cameraPos.X -= moveAmount;
         }
-        if (EngineInterop.Input_IsKeyDown(KEY_D) || EngineInterop.Input_IsKeyDown(KEY_RIGHT))
+        if (FrameInput.IsKeyDown(KEY_D) || FrameInput.IsKeyDown(KEY_RIGHT))
         {
             cameraPos.X += moveAmount;
         }
@@ -502,6 +512,7 @@ public class MapEditorScene : Scene
     public override void OnUnload()
     {
         Console.WriteLine("\n[MapEditor] Exiting map editor...");
+        tilesetManager.ReleaseAtlas();
     }
 }
 
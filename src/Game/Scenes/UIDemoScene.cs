@@ -88,7 +88,7 @@ public class UIDemoScene : Scene
         base.Update(deltaTime);
         
         // Toggle inventory with 'I' key
-        if (EngineInterop.Input_IsKeyPressed(73)) // 'I' key
+        if (FrameInput.IsKeyPressed(73)) // 'I' key
         {
             _inventoryOpen = !_inventoryOpen;
             if (_inventoryUI != null)
@@ -99,7 +99,7 @@ public class UIDemoScene : Scene
         }
         
         // Toggle crafting with 'C' key
-        if (EngineInterop.Input_IsKeyPressed(67)) // 'C' key
+        if (FrameInput.IsKeyPressed(67)) // 'C' key
         {
             _craftingOpen = !_craftingOpen;
             if (_craftingUI != null)
@@ -110,7 +110,7 @@ public class UIDemoScene : Scene
         }
         
         // ESC to close all UI
-        if (EngineInterop.Input_IsKeyPressed(27)) // ESC key
+        if (FrameInput.IsKeyPressed(27)) // ESC key
         {
             _inventoryOpen = false;
             _craftingOpen = false;
@@ -61,6 +61,7 @@ class TerrainDemoProgram
             }
             
             EngineInterop.Engine_BeginFrame();
+            FrameInput.Refresh();
             
             float deltaTime = EngineInterop.Engine_GetDeltaTime();
             
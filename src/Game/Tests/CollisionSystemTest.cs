@@ -1,12 +1,16 @@
+using System.Diagnostics;
 using ChroniclesOfADrifter.ECS;
 using ChroniclesOfADrifter.ECS.Components;
 using ChroniclesOfADrifter.ECS.Systems;
+using ChroniclesOfADrifter.Engine;
 using ChroniclesOfADrifter.Terrain;
 
 namespace ChroniclesOfADrifter.Tests;
 
 /// <summary>
-/// Tests for the collision detection system
+/// Tests for the collision detection system.
+/// The crowded scene, contact and gravity tests exercise the native physics world and
+/// fail without the engine library.
 /// </summary>
 public static class CollisionSystemTest
 {
@@ -21,6 +25,9 @@ public static class CollisionSystemTest
         TestTerrainCollision();
         TestCollisionLayers();
         TestSlidingCollision();
+        TestCrowdedScene();
+        TestContactCallback();
+        TestGravity();
         
         Console.WriteLine("\n===========================================");
         Console.WriteLine("  All Collision Tests Passed! ✓");
@@ -304,4 +311,189 @@ public static class CollisionSystemTest
         Console.WriteLine($"  Successfully slid along wall: Y changed by {pos.Y - startY:F1}, X blocked at wall");
         Console.WriteLine("✓ Sliding collision working\n");
     }
+    
+    private static void TestCrowdedScene()
+    {
+        Console.WriteLine("[Test 6] Testing crowded scene (many movers among obstacles)...");
+        
+        // The managed fallback would pass too, leaving the native path untested
+        if (!CollisionSystem.IsNativePhysicsAvailable)
+        {
+            throw new Exception("Native physics not available - is the engine library loaded?");
+        }
+        
+        var world = new World();
+        var collisionSystem = new CollisionSystem();
+        world.AddSystem(collisionSystem);
+        
+        // A grid of static pillars with creatures wandering between them
+        const int Pillars = 400;
+        const int Creatures = 2000;
+        var random = new Random(1234);
+        var pillars = new List<(float x, float y)>();
+        for (int i = 0; i < Pillars; i++)
+        {
+            float x = (i % 20) * 100.0f;
+            float y = (i / 20) * 100.0f;
+            var pillar = world.CreateEntity();
+            world.AddComponent(pillar, new PositionComponent(x, y));
+            world.AddComponent(pillar, new CollisionComponent(32, 32, isStatic: true, checkTerrain: false));
+            pillars.Add((x, y));
+        }
+        
+        var creatures = new List<Entity>();
+        for (int i = 0; i < Creatures; i++)
+        {
+            // Start in the columns between pillars
+            float x = (i % 40) * 50.0f + 25.0f;
+            float y = (i / 40) * 40.0f + 50.0f;
+            var creature = world.CreateEntity();
+            world.AddComponent(creature, new PositionComponent(x, y));
+            world.AddComponent(creature, new VelocityComponent(random.Next(-200, 200), random.Next(-200, 200)));
+            world.AddComponent(creature, new CollisionComponent(12, 12, checkTerrain: false,
+                layer: CollisionLayer.Enemy, collidesWith: CollisionLayer.Default));
+            creatures.Add(creature);
+        }
+        
+        var timer = Stopwatch.StartNew();
+        const int Frames = 10;
+        for (int frame = 0; frame < Frames; frame++)
+        {
+            collisionSystem.Update(world, 1.0f / 60.0f);
+        }
+        timer.Stop();
+        
+        // No creature may end up inside a pillar
+        foreach (var creature in creatures)
+        {
+            var pos = world.GetComponent<PositionComponent>(creature)!;
+            foreach (var (x, y) in pillars)
+            {
+                if (Math.Abs(pos.X - x) < 22.0f && Math.Abs(pos.Y - y) < 22.0f)
+                {
+                    throw new Exception($"Crowded scene failed - {creature} moved into the pillar at ({x}, {y})");
+                }
+            }
+        }
+        
+        Console.WriteLine($"  {Creatures} creatures, {Pillars} pillars: {timer.Elapsed.TotalMilliseconds / Frames:F2} ms per update");
+        Console.WriteLine("✓ Crowded scene collision working\n");
+    }
+    
+    private static void TestContactCallback()
+    {
+        Console.WriteLine("[Test 7] Testing collision callback against brute force...");
+        
+        // Overlapping boxes of mixed sizes on whole-unit coordinates, so the overlap test
+        // gives the same answer here as in the engine; nothing moves, so the contacts are
+        // exactly the overlapping pairs
+        const int Bodies = 1500;
+        var random = new Random(4321);
+        var boxes = new (float x, float y, float w, float h, bool isStatic)[Bodies];
+        EngineInterop.Physics_ClearBodies();
+        for (int id = 0; id < Bodies; id++)
+        {
+            boxes[id] = (random.Next(0, 1200), random.Next(0, 1200), random.Next(4, 48), random.Next(4, 48), id % 5 == 0);
+            var flags = PhysicsBodyFlags.NoGravity | (boxes[id].isStatic ? PhysicsBodyFlags.Static : PhysicsBodyFlags.None);
+            EngineInterop.Physics_CreateBody(id, boxes[id].x, boxes[id].y, boxes[id].w, boxes[id].h, flags, 1, 1);
+        }
+        
+        var expected = new HashSet<(int, int)>();
+        for (int a = 0; a < Bodies; a++)
+        {
+            for (int b = a + 1; b < Bodies; b++)
+            {
+                // Two static bodies never report each other
+                if (boxes[a].isStatic && boxes[b].isStatic)
+                    continue;
+                if (Math.Abs(boxes[a].x - boxes[b].x) < (boxes[a].w + boxes[b].w) / 2 &&
+                    Math.Abs(boxes[a].y - boxes[b].y) < (boxes[a].h + boxes[b].h) / 2)
+                {
+                    expected.Add((a, b));
+                }
+            }
+        }
+        
+        var reported = new List<(int, int)>();
+        EngineInterop.CollisionCallbackDelegate callback = (first, second) => reported.Add((first, second));
+        EngineInterop.Engine_RegisterCollisionCallback(callback);
+        try
+        {
+            EngineInterop.Physics_Step(1.0f / 60.0f);
+        }
+        finally
+        {
+            EngineInterop.Engine_RegisterCollisionCallback(null!);
+            GC.KeepAlive(callback);
+            EngineInterop.Physics_ClearBodies();
+        }
+        
+        var unique = new HashSet<(int, int)>(reported);
+        if (unique.Count != reported.Count)
+        {
+            throw new Exception($"Collision callback reported {reported.Count - unique.Count} pairs more than once");
+        }
+        if (reported.Any(pair => pair.Item1 >= pair.Item2))
+        {
+            throw new Exception("Collision callback must report the smaller entity id first");
+        }
+        if (!unique.SetEquals(expected))
+        {
+            int missing = expected.Count(pair => !unique.Contains(pair));
+            int extra = unique.Count(pair => !expected.Contains(pair));
+            throw new Exception($"Collision callback disagrees with brute force: {missing} pairs missing, {extra} extra");
+        }
+        
+        Console.WriteLine($"  {Bodies} bodies: {expected.Count} touching pairs, each reported once");
+        Console.WriteLine("✓ Collision callback working\n");
+    }
+    
+    private static void TestGravity()
+    {
+        Console.WriteLine("[Test 8] Testing gravity integration...");
+        
+        EngineInterop.Physics_ClearBodies();
+        EngineInterop.Physics_SetGravity(0, 100);
+        try
+        {
+            // Velocity picks up gravity before moving the body: after two half-second steps
+            // vy is 50 then 100 and y is 25 then 75
+            EngineInterop.Physics_CreateBody(1, 0, 0, 10, 10, PhysicsBodyFlags.None, 1, 1);
+            EngineInterop.Physics_CreateBody(2, 500, 0, 10, 10, PhysicsBodyFlags.NoGravity, 1, 1);
+            EngineInterop.Physics_Step(0.5f);
+            EngineInterop.Physics_Step(0.5f);
+            EngineInterop.Physics_GetBodyState(1, out float x, out float y, out float vx, out float vy);
+            if (x != 0 || y != 75 || vx != 0 || vy != 100)
+            {
+                throw new Exception($"Falling body at ({x}, {y}) with velocity ({vx}, {vy}), expected (0, 75) and (0, 100)");
+            }
+            EngineInterop.Physics_GetBodyState(2, out _, out y, out _, out vy);
+            if (y != 0 || vy != 0)
+            {
+                throw new Exception("A NoGravity body fell");
+            }
+            
+            // A body dropped onto a static floor (top at y = 90) comes to rest on it, its
+            // velocity cleared each step instead of building up against the floor
+            EngineInterop.Physics_ClearBodies();
+            EngineInterop.Physics_CreateBody(1, 0, 0, 10, 10, PhysicsBodyFlags.None, 1, 1);
+            EngineInterop.Physics_CreateBody(2, 0, 100, 200, 20, PhysicsBodyFlags.Static, 1, 1);
+            for (int step = 0; step < 120; step++)
+            {
+                EngineInterop.Physics_Step(1.0f / 60.0f);
+            }
+            EngineInterop.Physics_GetBodyState(1, out _, out y, out _, out vy);
+            if (y > 85 || y < 84 || vy != 0)
+            {
+                throw new Exception($"Body dropped on the floor ended at y={y} with vy={vy}");
+            }
+        }
+        finally
+        {
+            EngineInterop.Physics_SetGravity(0, 0);
+            EngineInterop.Physics_ClearBodies();
+        }
+        
+        Console.WriteLine("✓ Gravity integration working\n");
+    }
 }
@@ -0,0 +1,221 @@
+using ChroniclesOfADrifter.Engine;
+using System.Diagnostics;
+using System.Text.Json;
+
+namespace ChroniclesOfADrifter.Tests;
+
+/// <summary>
+/// Frame-time benchmark for the native frame loop on the null renderer backend.
+/// Needs no display: selects the null backend itself, whatever CHRONICLES_RENDERER says.
+/// Fails (rather than skipping) when the native engine library cannot be loaded.
+/// Set CHRONICLES_FRAME_BUDGET_MS to fail when the median frame exceeds a budget.
+/// A short profiler capture is written to CHRONICLES_TRACE_PATH (default: the system
+/// temp directory) and can be opened in chrome://tracing.
+/// </summary>
+public class HeadlessRendererBenchmark
+{
+    private const int ScreenWidth = 1280;
+    private const int ScreenHeight = 720;
+    private const int TileSize = 32;
+    private const int SpriteCount = 200;
+    private const int WarmupFrames = 60;
+    private const int MeasuredFrames = 600;
+    
+    private static RectInstance[]? tileRects;
+    
+    public static void Run()
+    {
+        Console.WriteLine("=== Headless Renderer Benchmark ===\n");
+        
+        EngineInterop.Engine_SetRendererBackend("null");
+        if (!EngineInterop.Engine_Initialize(ScreenWidth, ScreenHeight, "Headless Benchmark"))
+        {
+            EngineInterop.Engine_SetRendererBackend(null);
+            throw new Exception($"Engine initialization failed: {EngineInterop.Engine_GetErrorMessage()}");
+        }
+        
+        try
+        {
+            TestDrawCallCounting();
+            TestFrameTime();
+            TestProfilerCapture();
+        }
+        finally
+        {
+            EngineInterop.Engine_Shutdown();
+            EngineInterop.Engine_SetRendererBackend(null);
+        }
+        
+        Console.WriteLine("\n=== Headless Renderer Benchmark Complete ===");
+    }
+    
+    private static void TestDrawCallCounting()
+    {
+        Console.WriteLine("Test: Draw Call Counting");
+        Console.WriteLine("------------------------");
+        
+        RenderFrame(0);
+        if (!EngineInterop.Renderer_GetStats(out var stats))
+        {
+            throw new Exception("Renderer_GetStats unsupported - is the null backend active?");
+        }
+        
+        // Tile rects and sprite rects are all untextured, so the whole frame is one batch
+        int expectedQuads = TileRects().Length + SpriteCount;
+        if (stats.DrawCalls != 1 || stats.Quads != expectedQuads || stats.Vertices != expectedQuads * 4)
+        {
+            throw new Exception($"Unexpected counters: {stats.DrawCalls} draw calls, {stats.Quads} quads, " +
+                $"{stats.Vertices} vertices (expected 1, {expectedQuads}, {expectedQuads * 4})");
+        }
+        
+        Console.WriteLine($"✓ {stats.Quads} quads submitted in {stats.DrawCalls} draw call(s)\n");
+    }
+    
+    private static void TestFrameTime()
+    {
+        Console.WriteLine("Test: Frame Time");
+        Console.WriteLine("----------------");
+        
+        for (int frame = 0; frame < WarmupFrames; frame++)
+        {
+            RenderFrame(frame);
+        }
+        
+        var frameTimes = new double[MeasuredFrames];
+        var stopwatch = new Stopwatch();
+        for (int frame = 0; frame < MeasuredFrames; frame++)
+        {
+            stopwatch.Restart();
+            RenderFrame(frame);
+            frameTimes[frame] = stopwatch.Elapsed.TotalMilliseconds;
+        }
+        
+        Array.Sort(frameTimes);
+        double median = frameTimes[MeasuredFrames / 2];
+        double p99 = frameTimes[MeasuredFrames * 99 / 100];
+        EngineInterop.Renderer_GetStats(out var stats);
+        
+        Console.WriteLine($"  Frames:       {stats.FramesPresented}");
+        Console.WriteLine($"  Median frame: {median:F3} ms");
+        Console.WriteLine($"  99th pct:     {p99:F3} ms");
+        Console.WriteLine($"  Draw calls:   {stats.TotalDrawCalls} total, {stats.DrawCalls} last frame");
+        Console.WriteLine($"  Vertices:     {stats.TotalVertices} total, {stats.Vertices} last frame");
+        
+        string? budgetEnv = Environment.GetEnvironmentVariable("CHRONICLES_FRAME_BUDGET_MS");
+        if (budgetEnv != null && double.TryParse(budgetEnv, System.Globalization.NumberStyles.Float,
+                System.Globalization.CultureInfo.InvariantCulture, out double budget))
+        {
+            if (median > budget)
+            {
+                throw new Exception($"Median frame time {median:F3} ms exceeds budget of {budget:F3} ms");
+            }
+            Console.WriteLine($"✓ Median frame time within {budget:F3} ms budget");
+        }
+    }
+    
+    private static void TestProfilerCapture()
+    {
+        Console.WriteLine("Test: Profiler Capture");
+        Console.WriteLine("----------------------");
+        
+        if (!ProfilerInterop.TrySetEnabled(true))
+        {
+            throw new Exception("Native profiler not available");
+        }
+        
+        const int capturedFrames = 10;
+        try
+        {
+            for (int frame = 0; frame < capturedFrames; frame++)
+            {
+                using (ProfilerInterop.Scope("BenchmarkFrame"))
+                {
+                    RenderFrame(frame);
+                }
+            }
+        }
+        finally
+        {
+            ProfilerInterop.TrySetEnabled(false);
+        }
+        
+        string path = Environment.GetEnvironmentVariable("CHRONICLES_TRACE_PATH") ??
+            Path.Combine(Path.GetTempPath(), "headless_benchmark_trace.json");
+        int written = ProfilerInterop.Profiler_DumpChromeTrace(path);
+        if (written < 0)
+        {
+            throw new Exception($"Failed to write trace to {path}");
+        }
+        
+        var names = new Dictionary<string, int>();
+        using (var document = JsonDocument.Parse(File.ReadAllText(path)))
+        {
+            foreach (var traceEvent in document.RootElement.GetProperty("traceEvents").EnumerateArray())
+            {
+                string name = traceEvent.GetProperty("name").GetString() ?? "";
+                names[name] = names.GetValueOrDefault(name) + 1;
+            }
+        }
+        
+        foreach (var expected in new[] { "BenchmarkFrame", "Engine_BeginFrame", "Renderer_Present" })
+        {
+            if (names.GetValueOrDefault(expected) != capturedFrames)
+            {
+                throw new Exception($"Expected {capturedFrames} '{expected}' scopes in the trace, " +
+                    $"found {names.GetValueOrDefault(expected)}");
+            }
+        }
+        
+        Console.WriteLine($"✓ {written} scopes written to {path}\n");
+    }
+    
+    private static RectInstance[] TileRects()
+    {
+        if (tileRects != null)
+        {
+            return tileRects;
+        }
+        
+        int columns = ScreenWidth / TileSize;
+        int rows = ScreenHeight / TileSize;
+        tileRects = new RectInstance[columns * rows];
+        for (int y = 0; y < rows; y++)
+        {
+            for (int x = 0; x < columns; x++)
+            {
+                float shade = 0.3f + 0.4f * ((x ^ y) & 1);
+                tileRects[y * columns + x] = new RectInstance
+                {
+                    X = x * TileSize,
+                    Y = y * TileSize,
+                    Width = TileSize,
+                    Height = TileSize,
+                    R = 0.2f,
+                    G = shade,
+                    B = 0.2f,
+                    A = 1.0f
+                };
+            }
+        }
+        return tileRects;
+    }
+    
+    private static void RenderFrame(int frame)
+    {
+        EngineInterop.Engine_BeginFrame();
+        EngineInterop.Renderer_Clear(0.1f, 0.1f, 0.15f, 1.0f);
+        
+        var tiles = TileRects();
+        EngineInterop.Renderer_DrawRects(tiles, tiles.Length);
+        
+        for (int i = 0; i < SpriteCount; i++)
+        {
+            float x = (i * 37 + frame * 3) % ScreenWidth;
+            float y = (i * 91 + frame) % ScreenHeight;
+            EngineInterop.Renderer_DrawRect(x, y, 16, 16, 1.0f, 0.8f, 0.2f, 0.9f);
+        }
+        
+        EngineInterop.Renderer_Present();
+        EngineInterop.Engine_EndFrame();
+    }
+}
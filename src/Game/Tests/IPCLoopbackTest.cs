@@ -0,0 +1,501 @@
+using System.Buffers.Binary;
+using System.Collections.Concurrent;
+using System.Diagnostics;
+using System.Runtime.InteropServices;
+using System.Text.Json;
+using ChroniclesOfADrifter.Engine.IPC;
+using ChroniclesOfADrifter.Engine.Reflection;
+
+namespace ChroniclesOfADrifter.Tests;
+
+/// <summary>
+/// Runs the native IPC server and several clients in one process over the socket
+/// transport, checking responses and measuring round-trip throughput and latency.
+/// Fails when the engine library or the socket transport is unavailable.
+/// </summary>
+public class IPCLoopbackTest
+{
+    private const int ClientCount = 3;
+    private const int RoundTrips = 6000;
+    private const int StreamedEvents = 200000;
+    private const int BulkFetchSize = 500;
+    private const int SceneObjects = 5000;
+    
+    // Events the server thread still has to send; set by the test, drained by the server
+    private static int _eventsToSend;
+    
+    // Calls the server thread makes on the test's behalf (tracking and publishing)
+    private static readonly ConcurrentQueue<Action<IPCServer>> _serverWork = new();
+    
+    // Reflected type the server tracks; the engine library registers none of its own
+    private const string SceneTypeName = "IPCTestObject";
+    
+    [StructLayout(LayoutKind.Sequential)]
+    private struct SceneObject
+    {
+        public int Id;
+        public float X;
+        public float Y;
+        public int Flags;
+    }
+    
+    public static void Run()
+    {
+        Console.WriteLine("=== IPC Loopback Test Suite ===\n");
+        
+        string socketPath = Path.Combine(Path.GetTempPath(), $"chronicles_ipc_{Environment.ProcessId}.sock");
+        using (var server = new IPCServer())
+        {
+            RegisterSceneType();
+            
+            if (!server.Start(socketPath))
+            {
+                throw new Exception($"IPC server could not listen on {socketPath}");
+            }
+            
+            // The server is only touched from its own thread, like the engine's main loop
+            using var stop = new CancellationTokenSource();
+            var serverThread = new Thread(() =>
+            {
+                while (!stop.IsCancellationRequested)
+                {
+                    server.Update();
+                    
+                    // A burst of per-entity updates, as the editor sees while objects move
+                    int count = Interlocked.Exchange(ref _eventsToSend, 0);
+                    for (int i = 0; i < count; i++)
+                    {
+                        server.SendEvent(MessageType.ObjectModified, i.ToString());
+                    }
+                    while (_serverWork.TryDequeue(out var work))
+                    {
+                        work(server);
+                    }
+                }
+            }) { IsBackground = true };
+            serverThread.Start();
+            
+            var clients = new List<IPCClient>();
+            try
+            {
+                for (int i = 0; i < ClientCount; i++)
+                {
+                    var client = new IPCClient();
+                    clients.Add(client);
+                    if (!client.Connect(socketPath))
+                    {
+                        throw new Exception($"Client {i} could not connect");
+                    }
+                }
+                
+                TestResponses(clients);
+                TestSecondServerRefused(socketPath);
+                TestRoundTripLatency(clients);
+                TestBatchedFetch(clients[1]);
+                TestSyncRequestAcrossAsync(socketPath);
+                TestSharedEventStream(clients[0]);
+                TestSceneDeltas(clients[2]);
+            }
+            finally
+            {
+                foreach (var client in clients)
+                {
+                    client.Dispose();
+                }
+                stop.Cancel();
+                serverThread.Join();
+                server.Stop();
+            }
+        }
+        
+        Console.WriteLine("\n=== All IPC Loopback Tests Passed ===");
+    }
+    
+    private static void TestResponses(List<IPCClient> clients)
+    {
+        Console.WriteLine("Test: Responses Reach Each Client");
+        Console.WriteLine("---------------------------------");
+        
+        foreach (var client in clients)
+        {
+            string? types = client.SendCommand(MessageType.GetTypes, "");
+            if (types == null || !types.StartsWith("["))
+            {
+                throw new Exception($"GetTypes returned '{types}'");
+            }
+        }
+        
+        string? error = clients[0].SendCommand(MessageType.SaveScene, "");
+        if (error == null || !error.Contains("Unknown message type"))
+        {
+            throw new Exception($"Unhandled message type returned '{error}'");
+        }
+        
+        Console.WriteLine($"✓ {clients.Count} clients answered; unhandled types get an error\n");
+    }
+    
+    private static void TestSecondServerRefused(string socketPath)
+    {
+        Console.WriteLine("Test: Second Server Refused");
+        Console.WriteLine("---------------------------");
+        
+        using (var rival = new IPCServer())
+        {
+            if (rival.Start(socketPath))
+            {
+                throw new Exception("A second server took over a socket that is still being served");
+            }
+        }
+        
+        // The running server's socket file must still be there for new clients
+        using var client = new IPCClient();
+        if (!client.Connect(socketPath) || client.SendCommand(MessageType.GetTypes, "") == null)
+        {
+            throw new Exception("The running server became unreachable after the second start");
+        }
+        
+        Console.WriteLine("✓ Start fails while another server answers on the path\n");
+    }
+    
+    private static void TestRoundTripLatency(List<IPCClient> clients)
+    {
+        Console.WriteLine("Test: Round-Trip Latency");
+        Console.WriteLine("------------------------");
+        
+        var latencies = new double[RoundTrips];
+        var total = Stopwatch.StartNew();
+        for (int i = 0; i < RoundTrips; i++)
+        {
+            long start = Stopwatch.GetTimestamp();
+            string? response = clients[i % clients.Count].SendCommand(MessageType.GetTypes, "");
+            latencies[i] = (Stopwatch.GetTimestamp() - start) * 1_000_000.0 / Stopwatch.Frequency;
+            if (response == null)
+            {
+                throw new Exception($"Round trip {i} failed");
+            }
+        }
+        total.Stop();
+        
+        Array.Sort(latencies);
+        double p50 = latencies[RoundTrips / 2];
+        double p99 = latencies[RoundTrips * 99 / 100];
+        double perSecond = RoundTrips / total.Elapsed.TotalSeconds;
+        
+        Console.WriteLine($"✓ {RoundTrips} round trips: {perSecond:F0} msg/s, p50 {p50:F1} us, p99 {p99:F1} us\n");
+    }
+    
+    private static void TestBatchedFetch(IPCClient client)
+    {
+        Console.WriteLine("Test: Batched Bulk Fetch");
+        Console.WriteLine("------------------------");
+        
+        string request = $"{{\"typeName\":\"{SceneTypeName}\"}}";
+        var commands = Enumerable.Repeat((MessageType.GetTypeInfo, request), BulkFetchSize).ToList();
+        
+        var serial = Stopwatch.StartNew();
+        string? expected = null;
+        foreach (var (type, payload) in commands)
+        {
+            expected = client.SendCommand(type, payload);
+        }
+        serial.Stop();
+        
+        var batched = Stopwatch.StartNew();
+        string?[] responses = client.SendCommandBatch(commands);
+        batched.Stop();
+        
+        if (expected == null || !expected.Contains("\"fields\"") || responses.Any(response => response != expected))
+        {
+            throw new Exception("Batched responses differ from serial ones");
+        }
+        
+        Console.WriteLine($"✓ {BulkFetchSize} GetTypeInfo requests: serial {serial.Elapsed.TotalMilliseconds:F2} ms, " +
+                          $"one batch {batched.Elapsed.TotalMilliseconds:F2} ms\n");
+    }
+    
+    private static void TestSyncRequestAcrossAsync(string socketPath)
+    {
+        Console.WriteLine("Test: Synchronous Request Across the Switch to Async");
+        Console.WriteLine("---------------------------------------------------");
+        
+        using var client = new IPCClient();
+        if (!client.Connect(socketPath))
+        {
+            throw new Exception("Client could not connect");
+        }
+        
+        // Hold the server so the request below is still unanswered when the batch starts
+        // the client's reader thread
+        using var held = new ManualResetEventSlim();
+        using var release = new ManualResetEventSlim();
+        _serverWork.Enqueue(_ =>
+        {
+            held.Set();
+            release.Wait(TimeSpan.FromSeconds(10));
+        });
+        if (!held.Wait(TimeSpan.FromSeconds(10)))
+        {
+            throw new Exception("Server thread did not run queued work");
+        }
+        
+        int requestId = client.SendRequest(MessageType.GetTypes, "");
+        var batch = Task.Run(() => client.SendCommandBatch(new[] { (MessageType.GetTypes, "") }));
+        Thread.Sleep(100);
+        Task.Delay(150).ContinueWith(_ => release.Set());
+        
+        string? response = client.WaitResponse(requestId);
+        if (response == null || !response.StartsWith("["))
+        {
+            throw new Exception($"WaitResponse after the switch to async returned '{response}'");
+        }
+        if (!batch.Wait(TimeSpan.FromSeconds(10)) || batch.Result[0]?.StartsWith("[") != true)
+        {
+            throw new Exception("Batched request after a pending synchronous one failed");
+        }
+        
+        Console.WriteLine("✓ Request sent before the first async call answered after it\n");
+    }
+    
+    private static void TestSharedEventStream(IPCClient client)
+    {
+        Console.WriteLine("Test: Shared-Memory Event Stream");
+        Console.WriteLine("--------------------------------");
+        
+        if (!client.OpenSharedChannel())
+        {
+            throw new Exception("Could not open the shared-memory channel");
+        }
+        if (client.SendCommand(MessageType.GetTypes, "") == null)
+        {
+            throw new Exception("Request over the shared channel failed");
+        }
+        
+        var timer = Stopwatch.StartNew();
+        Interlocked.Exchange(ref _eventsToSend, StreamedEvents);
+        int received = 0;
+        while (received < StreamedEvents)
+        {
+            client.ReadEvents((type, payload) =>
+            {
+                if (type != MessageType.ObjectModified ||
+                    System.Text.Encoding.ASCII.GetString(payload) != received.ToString())
+                {
+                    throw new Exception($"Event {received} arrived out of order or corrupted");
+                }
+                received++;
+            });
+            if (timer.Elapsed.TotalSeconds > 30)
+            {
+                throw new Exception($"Only {received} of {StreamedEvents} events arrived");
+            }
+        }
+        timer.Stop();
+        
+        Console.WriteLine($"✓ {StreamedEvents} events in order: {StreamedEvents / timer.Elapsed.TotalSeconds:F0} events/s\n");
+    }
+    
+    private static void TestSceneDeltas(IPCClient client)
+    {
+        Console.WriteLine("Test: Scene Delta Streaming");
+        Console.WriteLine("---------------------------");
+        
+        string typeName = SceneTypeName;
+        int typeSize = Marshal.SizeOf<SceneObject>();
+        using (var info = JsonDocument.Parse(client.SendCommand(MessageType.GetTypeInfo, $"{{\"typeName\":\"{typeName}\"}}") ?? "{}"))
+        {
+            if (!info.RootElement.TryGetProperty("size", out var size) || size.GetInt32() != typeSize)
+            {
+                throw new Exception($"The server does not see {typeName} as registered");
+            }
+        }
+        
+        IntPtr objects = Marshal.AllocHGlobal(typeSize * SceneObjects);
+        try
+        {
+            unsafe
+            {
+                new Span<byte>((void*)objects, typeSize * SceneObjects).Clear();
+            }
+            RunOnServer(server =>
+            {
+                for (int i = 0; i < SceneObjects; i++)
+                {
+                    server.TrackObject(i, typeName, objects + i * typeSize);
+                }
+            });
+            if (!client.SubscribeScene())
+            {
+                throw new Exception("SubscribeScene failed");
+            }
+            
+            using var mirror = new SceneMirror();
+            RunOnServer(server => server.PublishScene());
+            byte[] full = WaitForSceneDelta(client);
+            CheckDeltaHeader(full, fullSync: true, 0, SceneObjects);
+            uint sequence = BinaryPrimitives.ReadUInt32LittleEndian(full.AsSpan(12));
+            ExpectApply(mirror, full, SceneApplyResult.Applied, "full sync");
+            if (mirror.ObjectCount != SceneObjects || mirror.Sequence != sequence)
+            {
+                throw new Exception($"Mirror holds {mirror.ObjectCount} objects at sequence {mirror.Sequence} after the full sync");
+            }
+            
+            // Change the first field (Id) of 1% of the objects
+            int changed = SceneObjects / 100;
+            ChangeIds(objects, typeSize, changed);
+            RunOnServer(server => server.PublishScene());
+            byte[] delta = WaitForSceneDelta(client);
+            CheckDeltaHeader(delta, fullSync: false, sequence, changed);
+            uint updated = CheckFirstUpdate(delta, fieldIndex: 0, value: 1);
+            if (updated % 100 != 0 || updated >= changed * 100)
+            {
+                throw new Exception($"Delta updates object {updated}, which did not change");
+            }
+            ExpectApply(mirror, delta, SceneApplyResult.Applied, "delta");
+            CheckMirroredId(mirror, updated, 1);
+            
+            // Replaying the delta finds the mirror past its base, so the mirror stops taking
+            // deltas until a resync
+            ExpectApply(mirror, delta, SceneApplyResult.NeedsResync, "stale-base delta");
+            ChangeIds(objects, typeSize, changed);
+            RunOnServer(server => server.PublishScene());
+            ExpectApply(mirror, WaitForSceneDelta(client), SceneApplyResult.Ignored, "delta while awaiting resync");
+            
+            // The mirror's sequence is behind the server's, so resubscribing brings a full resync
+            if (!client.SubscribeScene(mirror.Sequence))
+            {
+                throw new Exception("Resubscribing failed");
+            }
+            RunOnServer(server => server.PublishScene());
+            byte[] resync = WaitForSceneDelta(client);
+            CheckDeltaHeader(resync, fullSync: true, 0, SceneObjects);
+            ExpectApply(mirror, resync, SceneApplyResult.Applied, "resync");
+            CheckMirroredId(mirror, 0, 2);
+            CheckMirroredId(mirror, 1, 0);
+            
+            Console.WriteLine($"✓ {SceneObjects} '{typeName}' objects: full sync {full.Length} bytes, " +
+                              $"1% changed {delta.Length} bytes; mirror resyncs after a stale delta\n");
+        }
+        finally
+        {
+            // The server reads tracked objects in place, so untrack before freeing them
+            RunOnServer(server =>
+            {
+                for (int i = 0; i < SceneObjects; i++)
+                {
+                    server.UntrackObject(i);
+                }
+            });
+            Marshal.FreeHGlobal(objects);
+        }
+    }
+    
+    private static void ChangeIds(IntPtr objects, int typeSize, int count)
+    {
+        // Every 100th object, so the changes are spread over the scene
+        for (int i = 0; i < count; i++)
+        {
+            IntPtr id = objects + i * 100 * typeSize;
+            Marshal.WriteInt32(id, Marshal.ReadInt32(id) + 1);
+        }
+    }
+    
+    /// <summary>
+    /// Decode the delta's first record, which must update one field, and return its object
+    /// </summary>
+    private static uint CheckFirstUpdate(byte[] payload, int fieldIndex, int value)
+    {
+        // u32 objectId | u8 op (1 = Update) | u16 changed field count | u16 field index | value
+        var record = payload.AsSpan(20);
+        if (record.Length < 13 ||
+            record[4] != 1 ||
+            BinaryPrimitives.ReadUInt16LittleEndian(record.Slice(5)) != 1 ||
+            BinaryPrimitives.ReadUInt16LittleEndian(record.Slice(7)) != fieldIndex ||
+            BinaryPrimitives.ReadInt32LittleEndian(record.Slice(9)) != value)
+        {
+            throw new Exception($"First record is not an update of field {fieldIndex} to {value}");
+        }
+        return BinaryPrimitives.ReadUInt32LittleEndian(record);
+    }
+    
+    private static void ExpectApply(SceneMirror mirror, byte[] payload, SceneApplyResult expected, string what)
+    {
+        var result = mirror.Apply(payload);
+        if (result != expected)
+        {
+            throw new Exception($"Mirror returned {result} for the {what}, expected {expected}");
+        }
+    }
+    
+    private static void CheckMirroredId(SceneMirror mirror, uint objectId, int id)
+    {
+        byte[]? field = mirror.GetField(objectId, 0);
+        if (field == null || field.Length != 4 || BinaryPrimitives.ReadInt32LittleEndian(field) != id)
+        {
+            throw new Exception($"Mirrored object {objectId} does not have Id {id}");
+        }
+    }
+    
+    private static void RegisterSceneType()
+    {
+        string[] names = { nameof(SceneObject.Id), nameof(SceneObject.X), nameof(SceneObject.Y), nameof(SceneObject.Flags) };
+        int[] types = { (int)PropertyType.Int, (int)PropertyType.Float, (int)PropertyType.Float, (int)PropertyType.Int };
+        int[] offsets = names.Select(name => (int)Marshal.OffsetOf<SceneObject>(name)).ToArray();
+        if (!ReflectionInterop.Reflection_RegisterType(SceneTypeName, Marshal.SizeOf<SceneObject>(),
+                names.Length, names, types, offsets))
+        {
+            throw new Exception($"Could not register {SceneTypeName}");
+        }
+    }
+    
+    private static void RunOnServer(Action<IPCServer> work)
+    {
+        using var done = new ManualResetEventSlim();
+        _serverWork.Enqueue(server =>
+        {
+            work(server);
+            done.Set();
+        });
+        if (!done.Wait(TimeSpan.FromSeconds(10)))
+        {
+            throw new Exception("Server thread did not run queued work");
+        }
+    }
+    
+    private static byte[] WaitForSceneDelta(IPCClient client)
+    {
+        var timer = Stopwatch.StartNew();
+        byte[]? payload = null;
+        while (payload == null)
+        {
+            client.ReadEvents((type, data) =>
+            {
+                if (type == MessageType.SceneDelta)
+                {
+                    payload = data.ToArray();
+                }
+            });
+            if (timer.Elapsed.TotalSeconds > 10)
+            {
+                throw new Exception("No SceneDelta event arrived");
+            }
+        }
+        return payload;
+    }
+    
+    private static void CheckDeltaHeader(byte[] payload, bool fullSync, uint baseSequence, int records)
+    {
+        // "CHRD" | u16 version | u16 flags | u32 base sequence | u32 sequence | u32 record count
+        if (payload.Length < 20 || BinaryPrimitives.ReadUInt32LittleEndian(payload) != 0x44524843)
+        {
+            throw new Exception("SceneDelta payload has no valid header");
+        }
+        bool isFull = (BinaryPrimitives.ReadUInt16LittleEndian(payload.AsSpan(6)) & 1) != 0;
+        uint actualBase = BinaryPrimitives.ReadUInt32LittleEndian(payload.AsSpan(8));
+        uint actualRecords = BinaryPrimitives.ReadUInt32LittleEndian(payload.AsSpan(16));
+        if (isFull != fullSync || actualBase != baseSequence || actualRecords != records)
+        {
+            throw new Exception($"SceneDelta header: full {isFull}, base {actualBase}, {actualRecords} records; " +
+                                $"expected full {fullSync}, base {baseSequence}, {records} records");
+        }
+    }
+}
@@ -0,0 +1,187 @@
+using ChroniclesOfADrifter.Terrain;
+using System.Diagnostics;
+
+namespace ChroniclesOfADrifter.Tests;
+
+/// <summary>
+/// Verifies the native terrain generator matches the managed TerrainGenerator.
+/// Needs the native engine library; fails without it.
+/// </summary>
+public class NativeTerrainParityTest
+{
+    public static void Run()
+    {
+        Console.WriteLine("=== Native Terrain Parity Test Suite ===\n");
+
+        foreach (int seed in new[] { 0, 12345, 42069, -987 })
+        {
+            TestParity(seed);
+        }
+        TestBatchNoise();
+        TestThroughput();
+
+        Console.WriteLine("\n=== All Native Terrain Parity Tests Passed ===");
+    }
+
+    private static void TestParity(int seed)
+    {
+        Console.WriteLine($"Test: Parity (seed {seed})");
+        Console.WriteLine("-----------------------------");
+
+        var generator = new TerrainGenerator(seed);
+        var native = NativeChunkGenerator.TryCreate(generator, 1);
+        if (native == null)
+        {
+            throw new Exception("Native terrain generator not available - is the engine library loaded?");
+        }
+
+        try
+        {
+            int mismatches = 0;
+            for (int chunkX = -50; chunkX <= 50; chunkX++)
+            {
+                var expected = new Chunk(chunkX);
+                generator.GenerateChunk(expected);
+                var actual = native.GenerateChunkSync(chunkX);
+
+                for (int x = 0; x < Chunk.CHUNK_WIDTH; x++)
+                {
+                    for (int y = 0; y < Chunk.CHUNK_HEIGHT; y++)
+                    {
+                        if (expected.GetTile(x, y) != actual.GetTile(x, y))
+                        {
+                            if (mismatches++ < 5)
+                            {
+                                Console.WriteLine($"  Tile mismatch at chunk {chunkX} ({x}, {y}): " +
+                                    $"{expected.GetTile(x, y)} vs {actual.GetTile(x, y)}");
+                            }
+                        }
+                    }
+
+                    if (expected.GetVegetation(x) != actual.GetVegetation(x))
+                    {
+                        if (mismatches++ < 5)
+                        {
+                            Console.WriteLine($"  Vegetation mismatch at chunk {chunkX} column {x}: " +
+                                $"{expected.GetVegetation(x)} vs {actual.GetVegetation(x)}");
+                        }
+                    }
+                }
+            }
+
+            if (mismatches > 0)
+            {
+                throw new Exception($"Native terrain differs from managed terrain in {mismatches} places");
+            }
+
+            Console.WriteLine("✓ 101 chunks identical to managed generation\n");
+        }
+        finally
+        {
+            native.Dispose();
+        }
+    }
+
+    private static void TestBatchNoise()
+    {
+        Console.WriteLine("Test: Batch Noise Across SIMD Levels");
+        Console.WriteLine("------------------------------------");
+
+        int seed = 42069;
+        SimplexNoise.Noise.Seed = seed;
+        ChroniclesOfADrifter.Engine.NoiseInterop.Noise_SetSeed(seed);
+
+        int width = 37;
+        int height = 30;
+        var row = new float[width];
+        var grid = new float[width * height];
+        int detected = ChroniclesOfADrifter.Engine.NoiseInterop.Noise_GetSimdLevel();
+
+        for (int level = 0; level <= detected; level++)
+        {
+            ChroniclesOfADrifter.Engine.NoiseInterop.Noise_SetSimdLevel(level);
+            foreach (float scale in new[] { 0.005f, 0.03f, 0.08f, 0.15f })
+            {
+                ChroniclesOfADrifter.Engine.NoiseInterop.Noise_CalcPixel1DBatch(-500, 1, width, scale, row);
+                for (int i = 0; i < width; i++)
+                {
+                    if (row[i] != SimplexNoise.Noise.CalcPixel1D(-500 + i, scale))
+                    {
+                        throw new Exception($"1D batch mismatch at level {level}, x={-500 + i}, scale={scale}");
+                    }
+                }
+
+                ChroniclesOfADrifter.Engine.NoiseInterop.Noise_CalcPixel2DBatch(-1000, 0, 2, width, height, scale, grid);
+                for (int y = 0; y < height; y++)
+                {
+                    for (int x = 0; x < width; x++)
+                    {
+                        if (grid[y * width + x] != SimplexNoise.Noise.CalcPixel2D(-1000 + x * 2, y * 2, scale))
+                        {
+                            throw new Exception($"2D batch mismatch at level {level}, ({x}, {y}), scale={scale}");
+                        }
+                    }
+                }
+            }
+            Console.WriteLine($"✓ SIMD level {level} matches managed noise");
+        }
+        ChroniclesOfADrifter.Engine.NoiseInterop.Noise_SetSimdLevel(detected);
+        Console.WriteLine();
+    }
+
+    private static void TestThroughput()
+    {
+        Console.WriteLine("Test: Async Throughput (Managed vs Native)");
+        Console.WriteLine("------------------------------------------");
+
+        var generator = new TerrainGenerator(99999);
+        int chunkCount = 200;
+
+        var managed = new AsyncChunkGenerator(generator);
+        double managedMs;
+        try
+        {
+            managedMs = TimeGeneration(managed, chunkCount);
+        }
+        finally
+        {
+            managed.Dispose();
+        }
+
+        var native = NativeChunkGenerator.TryCreate(generator)!;
+        double nativeMs;
+        try
+        {
+            nativeMs = TimeGeneration(native, chunkCount);
+        }
+        finally
+        {
+            native.Dispose();
+        }
+
+        Console.WriteLine($"Managed: {chunkCount} chunks in {managedMs:F1}ms");
+        Console.WriteLine($"Native:  {chunkCount} chunks in {nativeMs:F1}ms");
+        Console.WriteLine($"Speedup: {managedMs / nativeMs:F2}x\n");
+    }
+
+    private static double TimeGeneration(IAsyncChunkGenerator asyncGen, int chunkCount)
+    {
+        var stopwatch = Stopwatch.StartNew();
+        for (int i = 0; i < chunkCount; i++)
+        {
+            asyncGen.RequestChunkGeneration(i, 0);
+        }
+
+        while (asyncGen.GetCompletedChunkCount() < chunkCount)
+        {
+            if (stopwatch.ElapsedMilliseconds > 30000)
+            {
+                throw new Exception("Timed out waiting for chunk generation");
+            }
+            Thread.Sleep(1);
+        }
+
+        stopwatch.Stop();
+        return stopwatch.Elapsed.TotalMilliseconds;
+    }
+}
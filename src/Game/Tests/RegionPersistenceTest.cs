@@ -0,0 +1,99 @@
+using ChroniclesOfADrifter.ECS.Components;
+using ChroniclesOfADrifter.Terrain;
+
+namespace ChroniclesOfADrifter.Tests;
+
+/// <summary>
+/// Checks that modified chunks survive being paged out to native region files and back.
+/// Needs the native engine library; fails without it.
+/// </summary>
+public class RegionPersistenceTest
+{
+    public static void Run()
+    {
+        Console.WriteLine("=== Region Persistence Test Suite ===\n");
+        
+        string directory = Path.Combine(Path.GetTempPath(), $"chronicles_regions_{Environment.ProcessId}");
+        try
+        {
+            TestUnloadAndReload(directory);
+            TestSaveModifiedChunks(directory);
+        }
+        finally
+        {
+            if (Directory.Exists(directory))
+            {
+                Directory.Delete(directory, true);
+            }
+        }
+        
+        Console.WriteLine("\n=== All Region Persistence Tests Passed ===");
+    }
+    
+    private static void TestUnloadAndReload(string directory)
+    {
+        Console.WriteLine("Test: Unload and Reload");
+        Console.WriteLine("-----------------------");
+        
+        using var manager = new ChunkManager();
+        manager.SetTerrainGenerator(new TerrainGenerator(4242));
+        if (!manager.EnableRegionFiles(directory))
+        {
+            throw new Exception("Could not enable region files - is the native engine library available?");
+        }
+        
+        // Dig a marker into chunk 0, then walk far enough away for it to unload
+        manager.UpdateChunks(0);
+        manager.SetTile(5, 20, TileType.Brick);
+        manager.SetVegetation(6, TileType.Flower);
+        manager.UpdateChunks(Chunk.CHUNK_WIDTH * 20);
+        if (manager.GetLoadedChunks().Any(chunk => chunk.ChunkX == 0))
+        {
+            throw new Exception("Chunk 0 should have been unloaded");
+        }
+        
+        manager.UpdateChunks(0);
+        if (manager.GetTile(5, 20) != TileType.Brick || manager.GetVegetation(6) != TileType.Flower)
+        {
+            throw new Exception("Edits to chunk 0 were lost after paging it out");
+        }
+        
+        long bytes = Directory.GetFiles(directory).Sum(file => new FileInfo(file).Length);
+        Console.WriteLine($"✓ Edited chunk reloaded from region files ({bytes} bytes on disk)\n");
+    }
+    
+    private static void TestSaveModifiedChunks(string directory)
+    {
+        Console.WriteLine("Test: Save Modified Chunks");
+        Console.WriteLine("--------------------------");
+        
+        using (var manager = new ChunkManager())
+        {
+            manager.SetTerrainGenerator(new TerrainGenerator(4242));
+            if (!manager.EnableRegionFiles(directory))
+            {
+                throw new Exception("Could not enable region files");
+            }
+            manager.SetTile(-40, 25, TileType.Torch);
+            
+            int saved = manager.SaveModifiedChunks();
+            if (saved != 1 || manager.SaveModifiedChunks() != 0)
+            {
+                throw new Exception($"Expected exactly one modified chunk to save, saved {saved}");
+            }
+        }
+        
+        // A fresh manager (new session) sees the edit without regenerating over it
+        using (var manager = new ChunkManager())
+        {
+            manager.SetTerrainGenerator(new TerrainGenerator(4242));
+            manager.EnableRegionFiles(directory);
+            if (manager.GetTile(-40, 25) != TileType.Torch)
+            {
+                throw new Exception("Saved chunk was regenerated instead of loaded");
+            }
+        }
+        
+        Console.WriteLine("✓ Only dirty chunks are written, and a new session loads them\n");
+    }
+}
@@ -0,0 +1,125 @@
+using ChroniclesOfADrifter.Engine;
+
+namespace ChroniclesOfADrifter.Tests;
+
+/// <summary>
+/// Checks the pixels produced by the software (CPU) renderer backend.
+/// Selects the software backend itself, whatever CHRONICLES_RENDERER says; frames are
+/// written as PNG to CHRONICLES_FRAME_DUMP_DIR (default: the system temp directory) for
+/// image diffing. Fails (rather than skipping) when the engine library or PNG support is missing.
+/// </summary>
+public class SoftwareRendererTest
+{
+    private const int ScreenWidth = 64;
+    private const int ScreenHeight = 48;
+    
+    public static void Run()
+    {
+        Console.WriteLine("=== Software Renderer Test Suite ===\n");
+        
+        EngineInterop.Engine_SetRendererBackend("software");
+        if (!EngineInterop.Engine_Initialize(ScreenWidth, ScreenHeight, "Software Renderer Test"))
+        {
+            EngineInterop.Engine_SetRendererBackend(null);
+            throw new Exception($"Engine initialization failed: {EngineInterop.Engine_GetErrorMessage()}");
+        }
+        
+        try
+        {
+            TestSolidFill();
+            TestAlphaBlending();
+            TestFrameDump();
+        }
+        finally
+        {
+            EngineInterop.Engine_Shutdown();
+            EngineInterop.Engine_SetRendererBackend(null);
+        }
+        
+        Console.WriteLine("\n=== All Software Renderer Tests Passed ===");
+    }
+    
+    private static void TestSolidFill()
+    {
+        Console.WriteLine("Test: Solid Fill");
+        Console.WriteLine("----------------");
+        
+        EngineInterop.Engine_BeginFrame();
+        EngineInterop.Renderer_Clear(0.0f, 0.0f, 1.0f, 1.0f);
+        EngineInterop.Renderer_DrawRect(8, 8, 16, 8, 1.0f, 0.0f, 0.0f, 1.0f);
+        EngineInterop.Renderer_Present();
+        EngineInterop.Engine_EndFrame();
+        
+        var pixels = ReadFrame();
+        ExpectPixel(pixels, 8, 8, 255, 0, 0, 255);
+        ExpectPixel(pixels, 23, 15, 255, 0, 0, 255);
+        ExpectPixel(pixels, 24, 8, 0, 0, 255, 255);
+        ExpectPixel(pixels, 8, 16, 0, 0, 255, 255);
+        
+        Console.WriteLine("✓ Rect covers exactly its pixels over the clear color\n");
+    }
+    
+    private static void TestAlphaBlending()
+    {
+        Console.WriteLine("Test: Alpha Blending");
+        Console.WriteLine("--------------------");
+        
+        EngineInterop.Engine_BeginFrame();
+        EngineInterop.Renderer_Clear(0.0f, 0.0f, 0.0f, 1.0f);
+        EngineInterop.Renderer_DrawRect(0, 0, ScreenWidth, ScreenHeight, 1.0f, 1.0f, 1.0f, 0.5f);
+        EngineInterop.Renderer_Present();
+        EngineInterop.Engine_EndFrame();
+        
+        // 0.5 alpha rounds to 128: 255 * 128 / 255 = 128
+        var pixels = ReadFrame();
+        ExpectPixel(pixels, 0, 0, 128, 128, 128, 255);
+        ExpectPixel(pixels, ScreenWidth - 1, ScreenHeight - 1, 128, 128, 128, 255);
+        
+        Console.WriteLine("✓ Half-transparent white over black gives mid grey\n");
+    }
+    
+    private static void TestFrameDump()
+    {
+        Console.WriteLine("Test: Frame Dump");
+        Console.WriteLine("----------------");
+        
+        string directory = Environment.GetEnvironmentVariable("CHRONICLES_FRAME_DUMP_DIR") ?? Path.GetTempPath();
+        string path = Path.Combine(directory, "software_renderer_test.png");
+        if (!EngineInterop.Renderer_SaveFramebuffer(path))
+        {
+            throw new Exception($"Frame dump failed: {EngineInterop.Engine_GetErrorMessage()}");
+        }
+        
+        var header = new byte[8];
+        using (var file = File.OpenRead(path))
+        {
+            file.ReadExactly(header);
+        }
+        if (header[0] != 0x89 || header[1] != (byte)'P' || header[2] != (byte)'N' || header[3] != (byte)'G')
+        {
+            throw new Exception($"{path} is not a PNG file");
+        }
+        
+        Console.WriteLine($"✓ Frame written to {path}\n");
+    }
+    
+    private static byte[] ReadFrame()
+    {
+        var pixels = new byte[ScreenWidth * ScreenHeight * 4];
+        if (!EngineInterop.Renderer_ReadPixels(pixels, pixels.Length))
+        {
+            throw new Exception("Renderer_ReadPixels failed - is the software backend active?");
+        }
+        return pixels;
+    }
+    
+    private static void ExpectPixel(byte[] pixels, int x, int y, byte r, byte g, byte b, byte a)
+    {
+        int index = (y * ScreenWidth + x) * 4;
+        if (pixels[index] != r || pixels[index + 1] != g || pixels[index + 2] != b || pixels[index + 3] != a)
+        {
+            throw new Exception($"Pixel ({x}, {y}) is ({pixels[index]}, {pixels[index + 1]}, {pixels[index + 2]}, {pixels[index + 3]}), " +
+                $"expected ({r}, {g}, {b}, {a})");
+        }
+    }
+}
@@ -7,7 +7,7 @@ namespace ChroniclesOfADrifter.Terrain;
 /// Handles asynchronous chunk generation using background worker threads.
 /// Provides thread-safe chunk generation with priority based on player proximity.
 /// </summary>
-public class AsyncChunkGenerator : IDisposable
+public class AsyncChunkGenerator : IAsyncChunkGenerator
 {
     private readonly TerrainGenerator terrainGenerator;
     private readonly ConcurrentQueue<ChunkGenerationRequest> generationQueue;
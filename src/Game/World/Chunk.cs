@@ -1,3 +1,5 @@
+using ChroniclesOfADrifter.Engine;
+
 namespace ChroniclesOfADrifter.Terrain;
 
 /// <summary>
@@ -28,6 +30,17 @@ public class Chunk
     /// </summary>
     private ECS.Components.TileType?[] vegetation;
     
+    /// <summary>
+    /// Tile storage in the native chunk store (row-major: y * CHUNK_WIDTH + x), or null
+    /// while tiles live in the managed arrays above
+    /// </summary>
+    private unsafe byte* nativeTiles;
+    
+    /// <summary>
+    /// Native vegetation storage (0 = none), valid while nativeTiles is set
+    /// </summary>
+    private unsafe byte* nativeVegetation;
+    
     /// <summary>
     /// Whether this chunk has been generated
     /// </summary>
@@ -52,27 +65,39 @@ public class Chunk
     /// </summary>
     /// <param name="localX">X coordinate within chunk (0-31)</param>
     /// <param name="localY">Y coordinate within chunk (0-29)</param>
-    public ECS.Components.TileType GetTile(int localX, int localY)
+    public unsafe ECS.Components.TileType GetTile(int localX, int localY)
     {
         if (localX < 0 || localX >= CHUNK_WIDTH || localY < 0 || localY >= CHUNK_HEIGHT)
         {
             return ECS.Components.TileType.Air;
         }
         
+        if (nativeTiles != null)
+        {
+            return (ECS.Components.TileType)nativeTiles[localY * CHUNK_WIDTH + localX];
+        }
+        
         return tiles[localX, localY];
     }
     
     /// <summary>
     /// Sets the tile type at local chunk coordinates
     /// </summary>
-    public void SetTile(int localX, int localY, ECS.Components.TileType type)
+    public unsafe void SetTile(int localX, int localY, ECS.Components.TileType type)
     {
         if (localX < 0 || localX >= CHUNK_WIDTH || localY < 0 || localY >= CHUNK_HEIGHT)
         {
             return;
         }
         
-        tiles[localX, localY] = type;
+        if (nativeTiles != null)
+        {
+            nativeTiles[localY * CHUNK_WIDTH + localX] = (byte)type;
+        }
+        else
+        {
+            tiles[localX, localY] = type;
+        }
         IsModified = true;
     }
     
@@ -113,13 +138,19 @@ public class Chunk
     /// Gets the vegetation at local chunk X coordinate
     /// </summary>
     /// <param name="localX">X coordinate within chunk (0-31)</param>
-    public ECS.Components.TileType? GetVegetation(int localX)
+    public unsafe ECS.Components.TileType? GetVegetation(int localX)
     {
         if (localX < 0 || localX >= CHUNK_WIDTH)
         {
             return null;
         }
         
+        if (nativeVegetation != null)
+        {
+            byte value = nativeVegetation[localX];
+            return value == 0 ? null : (ECS.Components.TileType)value;
+        }
+        
         return vegetation[localX];
     }
     
@@ -128,22 +159,36 @@ public class Chunk
     /// </summary>
     /// <param name="localX">X coordinate within chunk (0-31)</param>
     /// <param name="type">Vegetation type (or null to clear)</param>
-    public void SetVegetation(int localX, ECS.Components.TileType? type)
+    public unsafe void SetVegetation(int localX, ECS.Components.TileType? type)
     {
         if (localX < 0 || localX >= CHUNK_WIDTH)
         {
             return;
         }
         
-        vegetation[localX] = type;
+        if (nativeVegetation != null)
+        {
+            nativeVegetation[localX] = (byte)(type ?? ECS.Components.TileType.Air);
+        }
+        else
+        {
+            vegetation[localX] = type;
+        }
         IsModified = true;
     }
     
     /// <summary>
     /// Fills the entire chunk with a specific tile type (for testing)
     /// </summary>
-    public void Fill(ECS.Components.TileType type)
+    public unsafe void Fill(ECS.Components.TileType type)
     {
+        if (nativeTiles != null)
+        {
+            new Span<byte>(nativeTiles, CHUNK_WIDTH * CHUNK_HEIGHT).Fill((byte)type);
+            IsGenerated = true;
+            return;
+        }
+        
         for (int x = 0; x < CHUNK_WIDTH; x++)
         {
             for (int y = 0; y < CHUNK_HEIGHT; y++)
@@ -153,4 +198,161 @@ public class Chunk
         }
         IsGenerated = true;
     }
+    
+    /// <summary>
+    /// Whether tiles are stored in the native chunk store
+    /// </summary>
+    public unsafe bool IsNative => nativeTiles != null;
+    
+    /// <summary>
+    /// Direct view of the native tile array (row-major: y * CHUNK_WIDTH + x).
+    /// Empty when the chunk is not in native storage.
+    /// </summary>
+    public unsafe Span<byte> GetNativeTiles()
+    {
+        return nativeTiles != null ? new Span<byte>(nativeTiles, CHUNK_WIDTH * CHUNK_HEIGHT) : Span<byte>.Empty;
+    }
+    
+    /// <summary>
+    /// Copies tiles into the native chunk store and switches reads/writes to it.
+    /// Returns false if the store has no free slot for this chunk.
+    /// </summary>
+    public unsafe bool MoveToNativeStorage()
+    {
+        if (nativeTiles != null)
+        {
+            return true;
+        }
+        
+        byte* native = ChunkStoreInterop.World_AllocateChunk(ChunkX);
+        if (native == null)
+        {
+            return false;
+        }
+        
+        byte* nativeVeg = ChunkStoreInterop.World_GetChunkVegetation(ChunkX);
+        
+        for (int y = 0; y < CHUNK_HEIGHT; y++)
+        {
+            for (int x = 0; x < CHUNK_WIDTH; x++)
+            {
+                native[y * CHUNK_WIDTH + x] = (byte)tiles[x, y];
+            }
+        }
+        
+        for (int x = 0; x < CHUNK_WIDTH; x++)
+        {
+            nativeVeg[x] = (byte)(vegetation[x] ?? ECS.Components.TileType.Air);
+        }
+        
+        nativeTiles = native;
+        nativeVegetation = nativeVeg;
+        return true;
+    }
+    
+    /// <summary>
+    /// Persists the chunk to its region file and clears IsModified.
+    /// Native chunks are written straight from the chunk store.
+    /// </summary>
+    public unsafe bool SaveToRegion()
+    {
+        bool saved;
+        if (nativeTiles != null)
+        {
+            saved = RegionInterop.Region_SaveResidentChunk(ChunkX);
+        }
+        else
+        {
+            byte* tileBytes = stackalloc byte[CHUNK_WIDTH * CHUNK_HEIGHT];
+            byte* vegetationBytes = stackalloc byte[CHUNK_WIDTH];
+            for (int y = 0; y < CHUNK_HEIGHT; y++)
+            {
+                for (int x = 0; x < CHUNK_WIDTH; x++)
+                {
+                    tileBytes[y * CHUNK_WIDTH + x] = (byte)tiles[x, y];
+                }
+            }
+            for (int x = 0; x < CHUNK_WIDTH; x++)
+            {
+                vegetationBytes[x] = (byte)(vegetation[x] ?? ECS.Components.TileType.Air);
+            }
+            saved = RegionInterop.Region_SaveChunk(ChunkX, tileBytes, vegetationBytes);
+        }
+        
+        if (saved)
+        {
+            IsModified = false;
+        }
+        return saved;
+    }
+    
+    /// <summary>
+    /// Replaces the chunk's contents with its persisted copy.
+    /// Returns false if the chunk was never saved or the region file is unreadable.
+    /// </summary>
+    public unsafe bool LoadFromRegion()
+    {
+        if (nativeTiles != null)
+        {
+            if (RegionInterop.Region_LoadChunk(ChunkX, nativeTiles, nativeVegetation) != 1)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            byte* tileBytes = stackalloc byte[CHUNK_WIDTH * CHUNK_HEIGHT];
+            byte* vegetationBytes = stackalloc byte[CHUNK_WIDTH];
+            if (RegionInterop.Region_LoadChunk(ChunkX, tileBytes, vegetationBytes) != 1)
+            {
+                return false;
+            }
+            
+            for (int y = 0; y < CHUNK_HEIGHT; y++)
+            {
+                for (int x = 0; x < CHUNK_WIDTH; x++)
+                {
+                    tiles[x, y] = (ECS.Components.TileType)tileBytes[y * CHUNK_WIDTH + x];
+                }
+            }
+            for (int x = 0; x < CHUNK_WIDTH; x++)
+            {
+                byte value = vegetationBytes[x];
+                vegetation[x] = value == 0 ? null : (ECS.Components.TileType)value;
+            }
+        }
+        
+        IsGenerated = true;
+        IsModified = false;
+        return true;
+    }
+    
+    /// <summary>
+    /// Copies tiles back into managed arrays and releases the native slot
+    /// </summary>
+    public unsafe void ReleaseNativeStorage()
+    {
+        if (nativeTiles == null)
+        {
+            return;
+        }
+        
+        for (int y = 0; y < CHUNK_HEIGHT; y++)
+        {
+            for (int x = 0; x < CHUNK_WIDTH; x++)
+            {
+                tiles[x, y] = (ECS.Components.TileType)nativeTiles[y * CHUNK_WIDTH + x];
+            }
+        }
+        
+        for (int x = 0; x < CHUNK_WIDTH; x++)
+        {
+            byte value = nativeVegetation[x];
+            vegetation[x] = value == 0 ? null : (ECS.Components.TileType)value;
+        }
+        
+        nativeTiles = null;
+        nativeVegetation = null;
+        ChunkStoreInterop.World_ReleaseChunk(ChunkX);
+    }
 }
@@ -10,10 +10,15 @@ public class ChunkManager : IDisposable
     private int renderDistance = 2; // Load chunks within 2 chunks of player
     private int unloadDistance = 4; // Unload chunks beyond this distance
     private TerrainGenerator? terrainGenerator;
-    private AsyncChunkGenerator? asyncGenerator;
+    private IAsyncChunkGenerator? asyncGenerator;
     private bool useAsyncGeneration;
+    private bool useNativeStore;
+    private bool useRegionFiles;
     private bool isDisposed;
     
+    // Last chunk returned by a tile lookup; neighbouring lookups skip the dictionary
+    private Chunk? lastTileChunk;
+    
     public ChunkManager(bool useAsyncGeneration = false)
     {
         loadedChunks = new Dictionary<int, Chunk>();
@@ -30,10 +35,20 @@ public class ChunkManager : IDisposable
         // Initialize async generator if needed
         if (useAsyncGeneration && asyncGenerator == null && terrainGenerator != null)
         {
-            asyncGenerator = new AsyncChunkGenerator(terrainGenerator);
+            asyncGenerator = CreateAsyncGenerator(terrainGenerator);
         }
     }
     
+    /// <summary>
+    /// Creates the background generator, preferring the native worker pool
+    /// and falling back to managed threads when the engine library is unavailable
+    /// </summary>
+    private static IAsyncChunkGenerator CreateAsyncGenerator(TerrainGenerator generator)
+    {
+        return (IAsyncChunkGenerator?)NativeChunkGenerator.TryCreate(generator)
+            ?? new AsyncChunkGenerator(generator);
+    }
+    
     /// <summary>
     /// Enables or disables async chunk generation
     /// </summary>
@@ -48,7 +63,7 @@ public class ChunkManager : IDisposable
         
         if (enabled && asyncGenerator == null && terrainGenerator != null)
         {
-            asyncGenerator = new AsyncChunkGenerator(terrainGenerator);
+            asyncGenerator = CreateAsyncGenerator(terrainGenerator);
         }
         else if (!enabled && asyncGenerator != null)
         {
@@ -57,6 +72,108 @@ public class ChunkManager : IDisposable
         }
     }
     
+    /// <summary>
+    /// Moves loaded chunks into the native chunk store so tile reads become direct
+    /// memory reads. The store is process-wide, so only one manager can hold it at a time;
+    /// Dispose gives it back. Returns false if the engine library is unavailable or
+    /// another manager holds the store.
+    /// </summary>
+    public bool EnableNativeTileStore()
+    {
+        if (useNativeStore)
+        {
+            return true;
+        }
+        
+        // Enough ring slots for every chunk within unload distance plus headroom
+        if (!ChroniclesOfADrifter.Engine.ChunkStoreInterop.TryInitialize(2 * unloadDistance + 8))
+        {
+            return false;
+        }
+        
+        useNativeStore = true;
+        foreach (var chunk in loadedChunks.Values)
+        {
+            chunk.MoveToNativeStorage();
+        }
+        
+        return true;
+    }
+    
+    /// <summary>
+    /// Persists chunks to native region files under <paramref name="directory"/>: modified
+    /// chunks are saved when they unload, and saved chunks are loaded back instead of being
+    /// regenerated. Returns false if the engine library is unavailable.
+    /// </summary>
+    public bool EnableRegionFiles(string directory)
+    {
+        if (!ChroniclesOfADrifter.Engine.RegionInterop.TrySetDirectory(directory))
+        {
+            return false;
+        }
+        
+        useRegionFiles = true;
+        return true;
+    }
+    
+    /// <summary>
+    /// Writes every loaded chunk with unsaved changes to its region file.
+    /// Returns the number of chunks saved.
+    /// </summary>
+    public int SaveModifiedChunks()
+    {
+        if (!useRegionFiles)
+        {
+            return 0;
+        }
+        
+        int saved = 0;
+        foreach (var chunk in loadedChunks.Values)
+        {
+            if (chunk.IsModified && chunk.SaveToRegion())
+            {
+                saved++;
+            }
+        }
+        return saved;
+    }
+    
+    /// <summary>
+    /// Loads a chunk from its region file if it was saved before
+    /// </summary>
+    private Chunk? TryLoadFromRegion(int chunkX)
+    {
+        // Probed for every missing chunk each update and usually a miss, so check the
+        // region table before allocating a chunk to load into
+        if (!useRegionFiles || !ChroniclesOfADrifter.Engine.RegionInterop.Region_HasChunk(chunkX))
+        {
+            return null;
+        }
+        
+        var chunk = new Chunk(chunkX);
+        if (!chunk.LoadFromRegion())
+        {
+            return null;
+        }
+        
+        AddLoadedChunk(chunk);
+        return chunk;
+    }
+    
+    /// <summary>
+    /// Registers a newly generated chunk as loaded
+    /// </summary>
+    private void AddLoadedChunk(Chunk chunk)
+    {
+        if (useNativeStore)
+        {
+            // Falls back to managed storage if the ring slot is still taken
+            chunk.MoveToNativeStorage();
+        }
+        
+        loadedChunks[chunk.ChunkX] = chunk;
+    }
+    
     /// <summary>
     /// Gets a chunk at the given chunk coordinate, loading it if necessary.
     /// Returns null if using async generation and chunk is not ready yet.
@@ -68,13 +185,19 @@ public class ChunkManager : IDisposable
             return chunk;
         }
         
+        chunk = TryLoadFromRegion(chunkX);
+        if (chunk != null)
+        {
+            return chunk;
+        }
+        
         // Check if async generator has completed this chunk
         if (useAsyncGeneration && asyncGenerator != null)
         {
             var generatedChunk = asyncGenerator.TryGetGeneratedChunk(chunkX);
             if (generatedChunk != null)
             {
-                loadedChunks[chunkX] = generatedChunk;
+                AddLoadedChunk(generatedChunk);
                 return generatedChunk;
             }
             
@@ -95,7 +218,7 @@ public class ChunkManager : IDisposable
             chunk.Fill(ECS.Components.TileType.Air);
         }
         
-        loadedChunks[chunkX] = chunk;
+        AddLoadedChunk(chunk);
         return chunk;
     }
     
@@ -110,7 +233,20 @@ public class ChunkManager : IDisposable
             return chunk;
         }
         
+        chunk = TryLoadFromRegion(chunkX);
+        if (chunk != null)
+        {
+            return chunk;
+        }
+        
         // Generate synchronously regardless of async setting
+        if (asyncGenerator is NativeChunkGenerator nativeGenerator)
+        {
+            chunk = nativeGenerator.GenerateChunkSync(chunkX);
+            AddLoadedChunk(chunk);
+            return chunk;
+        }
+        
         chunk = new Chunk(chunkX);
         
         if (terrainGenerator != null)
@@ -122,7 +258,7 @@ public class ChunkManager : IDisposable
             chunk.Fill(ECS.Components.TileType.Air);
         }
         
-        loadedChunks[chunkX] = chunk;
+        AddLoadedChunk(chunk);
         return chunk;
     }
     
@@ -139,10 +275,15 @@ public class ChunkManager : IDisposable
         int chunkX = Chunk.WorldToChunkCoord(worldX);
         int localX = Chunk.WorldToLocalCoord(worldX);
         
-        var chunk = GetChunk(chunkX);
-        if (chunk == null)
+        var chunk = lastTileChunk;
+        if (chunk == null || chunk.ChunkX != chunkX)
         {
-            return ECS.Components.TileType.Air;  // Chunk not loaded yet
+            chunk = GetChunk(chunkX);
+            if (chunk == null)
+            {
+                return ECS.Components.TileType.Air;  // Chunk not loaded yet
+            }
+            lastTileChunk = chunk;
         }
         
         return chunk.GetTile(localX, worldY);
@@ -179,6 +320,10 @@ public class ChunkManager : IDisposable
             for (int offsetX = -renderDistance; offsetX <= renderDistance; offsetX++)
             {
                 int chunkX = playerChunkX + offsetX;
+                if (!loadedChunks.ContainsKey(chunkX) && TryLoadFromRegion(chunkX) != null)
+                {
+                    continue;  // Saved earlier, nothing to generate
+                }
                 asyncGenerator.RequestChunkGeneration(chunkX, playerWorldX);
                 
                 // Check if chunk is ready and load it
@@ -217,7 +362,18 @@ public class ChunkManager : IDisposable
         
         foreach (var chunkX in chunksToUnload)
         {
-            loadedChunks.Remove(chunkX);
+            if (loadedChunks.Remove(chunkX, out var chunk))
+            {
+                if (useRegionFiles && chunk.IsModified)
+                {
+                    chunk.SaveToRegion();
+                }
+                chunk.ReleaseNativeStorage();
+                if (ReferenceEquals(chunk, lastTileChunk))
+                {
+                    lastTileChunk = null;
+                }
+            }
         }
     }
     
@@ -296,10 +452,30 @@ public class ChunkManager : IDisposable
         
         isDisposed = true;
         
+        if (useRegionFiles)
+        {
+            SaveModifiedChunks();
+            ChroniclesOfADrifter.Engine.RegionInterop.Region_CloseAll();
+            useRegionFiles = false;
+        }
+        
         if (asyncGenerator != null)
         {
             asyncGenerator.Dispose();
             asyncGenerator = null;
         }
+        
+        if (useNativeStore)
+        {
+            foreach (var chunk in loadedChunks.Values)
+            {
+                chunk.ReleaseNativeStorage();
+            }
+            if (!ChroniclesOfADrifter.Engine.ChunkStoreInterop.World_ShutdownChunkStore())
+            {
+                Console.WriteLine("[ChunkManager] WARNING: Native chunk store still has resident chunks; left it running");
+            }
+            useNativeStore = false;
+        }
     }
 }
@@ -0,0 +1,29 @@
+namespace ChroniclesOfADrifter.Terrain;
+
+/// <summary>
+/// Background chunk generator used by ChunkManager in async mode.
+/// Implemented by the managed AsyncChunkGenerator and the native NativeChunkGenerator.
+/// </summary>
+public interface IAsyncChunkGenerator : IDisposable
+{
+    /// <summary>
+    /// Requests chunk generation. Returns immediately if chunk is already generated or in progress.
+    /// </summary>
+    void RequestChunkGeneration(int chunkX, float playerWorldX);
+    
+    /// <summary>
+    /// Tries to get a generated chunk. Returns null if chunk hasn't been generated yet.
+    /// </summary>
+    Chunk? TryGetGeneratedChunk(int chunkX);
+    
+    bool IsChunkGenerated(int chunkX);
+    bool IsChunkInProgress(int chunkX);
+    int GetQueuedChunkCount();
+    int GetInProgressChunkCount();
+    int GetCompletedChunkCount();
+    
+    /// <summary>
+    /// Clears all cached chunks (useful when changing world seed)
+    /// </summary>
+    void ClearCache();
+}
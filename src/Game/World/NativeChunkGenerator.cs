@@ -0,0 +1,181 @@
+using ChroniclesOfADrifter.Engine;
+
+namespace ChroniclesOfADrifter.Terrain;
+
+/// <summary>
+/// Async chunk generator backed by the native terrain worker pool.
+/// Produces the same chunks as TerrainGenerator for the same seed.
+/// Must be used from a single (main) thread. Each instance owns its own native pool.
+/// </summary>
+public class NativeChunkGenerator : IAsyncChunkGenerator
+{
+    private readonly int seed;
+    private readonly int threadCount;
+    private readonly Dictionary<int, Chunk> generatedChunks;
+    private readonly HashSet<int> chunksInProgress;
+    private readonly byte[] tileBuffer;
+    private readonly byte[] vegetationBuffer;
+    private IntPtr pipeline;
+    private bool isDisposed;
+    
+    private NativeChunkGenerator(IntPtr pipeline, int seed, int threadCount)
+    {
+        this.pipeline = pipeline;
+        this.seed = seed;
+        this.threadCount = threadCount;
+        generatedChunks = new Dictionary<int, Chunk>();
+        chunksInProgress = new HashSet<int>();
+        tileBuffer = new byte[Chunk.CHUNK_WIDTH * Chunk.CHUNK_HEIGHT];
+        vegetationBuffer = new byte[Chunk.CHUNK_WIDTH];
+    }
+    
+    /// <summary>
+    /// Starts the native generator for the terrain generator's seed.
+    /// Returns null if the engine library is unavailable.
+    /// </summary>
+    /// <param name="threadCount">Number of worker threads (defaults to CPU core count - 1)</param>
+    public static NativeChunkGenerator? TryCreate(TerrainGenerator terrainGenerator, int? threadCount = null)
+    {
+        int workers = threadCount ?? 0;
+        IntPtr pipeline = TerrainInterop.TryCreatePipeline(terrainGenerator.Seed, workers);
+        if (pipeline == IntPtr.Zero)
+        {
+            return null;
+        }
+        
+        return new NativeChunkGenerator(pipeline, terrainGenerator.Seed, workers);
+    }
+    
+    public void RequestChunkGeneration(int chunkX, float playerWorldX)
+    {
+        if (generatedChunks.ContainsKey(chunkX) || chunksInProgress.Contains(chunkX))
+        {
+            return;
+        }
+        
+        TerrainInterop.Terrain_SetFocusChunk(pipeline, Chunk.WorldToChunkCoord((int)playerWorldX));
+        if (TerrainInterop.Terrain_RequestChunk(pipeline, chunkX))
+        {
+            chunksInProgress.Add(chunkX);
+        }
+    }
+    
+    public Chunk? TryGetGeneratedChunk(int chunkX)
+    {
+        DrainCompleted();
+        generatedChunks.TryGetValue(chunkX, out var chunk);
+        return chunk;
+    }
+    
+    public bool IsChunkGenerated(int chunkX)
+    {
+        DrainCompleted();
+        return generatedChunks.ContainsKey(chunkX);
+    }
+    
+    public bool IsChunkInProgress(int chunkX)
+    {
+        DrainCompleted();
+        return chunksInProgress.Contains(chunkX);
+    }
+    
+    /// <summary>
+    /// The native pool does not distinguish queued from running chunks; all
+    /// outstanding requests are reported as in progress
+    /// </summary>
+    public int GetQueuedChunkCount()
+    {
+        return 0;
+    }
+    
+    public int GetInProgressChunkCount()
+    {
+        DrainCompleted();
+        return chunksInProgress.Count;
+    }
+    
+    public int GetCompletedChunkCount()
+    {
+        DrainCompleted();
+        return generatedChunks.Count;
+    }
+    
+    /// <summary>
+    /// Generates a chunk immediately on the calling thread
+    /// </summary>
+    public unsafe Chunk GenerateChunkSync(int chunkX)
+    {
+        var chunk = new Chunk(chunkX);
+        fixed (byte* tiles = tileBuffer)
+        fixed (byte* veg = vegetationBuffer)
+        {
+            TerrainInterop.Terrain_GenerateChunk(pipeline, chunkX, tiles, veg);
+        }
+        CopyToChunk(chunk);
+        return chunk;
+    }
+    
+    /// <summary>
+    /// Moves every chunk finished by the native workers into the generated set
+    /// </summary>
+    private unsafe void DrainCompleted()
+    {
+        int chunkX;
+        fixed (byte* tiles = tileBuffer)
+        fixed (byte* veg = vegetationBuffer)
+        {
+            while (TerrainInterop.Terrain_PollCompleted(pipeline, &chunkX, tiles, veg))
+            {
+                var chunk = new Chunk(chunkX);
+                CopyToChunk(chunk);
+                chunksInProgress.Remove(chunkX);
+                generatedChunks[chunkX] = chunk;
+            }
+        }
+    }
+    
+    private void CopyToChunk(Chunk chunk)
+    {
+        for (int y = 0; y < Chunk.CHUNK_HEIGHT; y++)
+        {
+            for (int x = 0; x < Chunk.CHUNK_WIDTH; x++)
+            {
+                chunk.SetTile(x, y, (ECS.Components.TileType)tileBuffer[y * Chunk.CHUNK_WIDTH + x]);
+            }
+        }
+        
+        for (int x = 0; x < Chunk.CHUNK_WIDTH; x++)
+        {
+            byte value = vegetationBuffer[x];
+            if (value != 0)
+            {
+                chunk.SetVegetation(x, (ECS.Components.TileType)value);
+            }
+        }
+        
+        chunk.SetGenerated();
+    }
+    
+    /// <summary>
+    /// Clears all cached chunks and restarts the worker pool so in-flight chunks are dropped
+    /// </summary>
+    public void ClearCache()
+    {
+        generatedChunks.Clear();
+        chunksInProgress.Clear();
+        TerrainInterop.Terrain_DestroyPipeline(pipeline);
+        pipeline = TerrainInterop.Terrain_CreatePipeline(seed, threadCount);
+    }
+    
+    public void Dispose()
+    {
+        if (isDisposed)
+        {
+            return;
+        }
+        
+        isDisposed = true;
+        TerrainInterop.Terrain_DestroyPipeline(pipeline);
+        pipeline = IntPtr.Zero;
+    }
+}
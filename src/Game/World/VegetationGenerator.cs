@@ -7,12 +7,31 @@ namespace ChroniclesOfADrifter.Terrain;
 /// </summary>
 public class VegetationGenerator
 {
-    private Random random;
+    private readonly int varietySeed;
     private const float VEGETATION_FREQUENCY = 0.15f;
     
     public VegetationGenerator(int seed)
     {
-        this.random = new Random(seed + 12345); // Offset seed for vegetation
+        this.varietySeed = seed + 12345; // Offset seed for vegetation
+    }
+    
+    /// <summary>
+    /// Deterministic per-column roll in [0, 100) used to pick between vegetation variants.
+    /// Depends only on seed and position, so chunks come out the same regardless of
+    /// generation order or thread. Must match VegetationRoll in the native TerrainGenerator.h.
+    /// </summary>
+    public static int VegetationRoll(int seed, int worldX)
+    {
+        unchecked
+        {
+            uint h = (uint)seed * 0x9E3779B1u ^ (uint)worldX * 0x85EBCA77u;
+            h ^= h >> 15;
+            h *= 0x2C1B3C6Du;
+            h ^= h >> 12;
+            h *= 0x297A2D39u;
+            h ^= h >> 15;
+            return (int)(h % 100u);
+        }
     }
     
     /// <summary>
@@ -50,7 +69,7 @@ public class VegetationGenerator
             float probability = vegetationNoise / 255.0f;
             
             // Determine vegetation type and density based on biome
-            var vegetation = DetermineVegetation(biome, probability);
+            var vegetation = DetermineVegetation(biome, probability, worldX);
             
             if (vegetation.HasValue)
             {
@@ -97,11 +116,11 @@ public class VegetationGenerator
     /// <summary>
     /// Determines what vegetation (if any) to place based on biome and probability
     /// </summary>
-    private ECS.Components.TileType? DetermineVegetation(BiomeType biome, float probability)
+    private ECS.Components.TileType? DetermineVegetation(BiomeType biome, float probability, int worldX)
     {
         return biome switch
         {
-            BiomeType.Forest => DetermineForestVegetation(probability),
+            BiomeType.Forest => DetermineForestVegetation(probability, worldX),
             BiomeType.Plains => DeterminePlainsVegetation(probability),
             BiomeType.Desert => DetermineDesertVegetation(probability),
             BiomeType.Snow => DetermineSnowVegetation(probability),
@@ -116,7 +135,7 @@ public class VegetationGenerator
     /// <summary>
     /// Determines vegetation for Forest biome (dense trees and bushes)
     /// </summary>
-    private ECS.Components.TileType? DetermineForestVegetation(float probability)
+    private ECS.Components.TileType? DetermineForestVegetation(float probability, int worldX)
     {
         // Forest has 60% vegetation coverage
         if (probability < 0.40f)
@@ -126,7 +145,7 @@ public class VegetationGenerator
         else if (probability < 0.70f)
         {
             // 30% chance for trees
-            return random.Next(100) < 70 
+            return VegetationRoll(varietySeed, worldX) < 70 
                 ? ECS.Components.TileType.TreeOak 
                 : ECS.Components.TileType.TreePine;
         }
@@ -57,7 +57,11 @@ public class WorldFileService
 
         try
         {
-            var worldFile = JsonSerializer.Deserialize<WorldFile>(File.ReadAllText(filePath));
+            WorldFile? worldFile;
+            using (var stream = File.OpenRead(filePath))
+            {
+                worldFile = JsonSerializer.Deserialize<WorldFile>(stream);
+            }
             if (worldFile?.Tiles == null)
             {
                 Console.WriteLine("[WorldFileService] Invalid world file.");